@@ -0,0 +1,86 @@
+/*
+ * arena.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_ARENA_H_
+#define INC_ARENA_H_
+
+/*
+ *	bootloader 버퍼를 한 곳에 모은 static arena. CCMRAM(64K)에 두어 main SRAM은 DMA 버퍼와
+ *	큰 staging 버퍼용으로 남긴다. .ccmram section은 NOLOAD라 startup이 0으로 채우지 않으므로
+ *	사용하는 쪽이 처음 쓰기 전에 초기화한다.
+ *
+ *	CCMRAM은 CPU(D-bus)만 접근할 수 있다. DMA가 직접 읽고 쓰는 버퍼 (OLED 전송 queue 등)와
+ *	SRAM에서 실행하는 code는 여기 둘 수 없다.
+ *
+ *	protocol phase 한쪽에서만 쓰는 버퍼는 uPhase union으로 겹친다.
+ *	 - WAIT	: 수신 채널 고정 전, transport.c 채널별 줄 버퍼
+ *	 - UPDATE	: 채널 고정 후, DATA payload 버퍼와 LOADFILE parser 상태, write-combine 버퍼, 서명 대상 hash
+ */
+#include "display.h"
+#include "transport.h"
+#include "loadflash.h"
+#include "image.h"
+
+//define
+// CCMRAM, startup이 초기화하지 않는다
+#define ARENA_SECTION					__attribute__((section(".ccmram")))
+// main SRAM, startup이 초기화하지 않는다 (DMA가 접근해야 하는 큰 버퍼)
+#define NOINIT_SECTION					__attribute__((section(".noinit")))
+
+// UART Packet limit size
+#define	PACKETLIMITELENGTH				256
+// DATA 패킷 payload 최대 크기 (INFO 패킷 크기 상한)
+#define PACKET_PAYLOAD_MAX				256
+// 명령어 ("[" 와 "]" 사이) 최대 길이
+#define ARENA_COMMAND_SIZE				32
+// stack 최대 사용량 측정을 위해 시작 때 pattern으로 채우는 크기
+#define ARENA_STACK_PAINT_SIZE			4096
+#define ARENA_STACK_PAINT_PATTERN		0xA5A5A5A5
+
+/* RAM 사용량을 보고하는 protocol phase */
+typedef enum
+{
+	ARENA_PHASE_WAIT = 0,
+	ARENA_PHASE_UPDATE,
+	ARENA_PHASE_MAX
+} ArenaPhaseTypeDef;
+
+/* bootloader 버퍼 */
+typedef struct
+{
+	// 모든 phase: 그래픽 버퍼, UART 수신 버퍼, 명령어
+	uint8_t sDisplayBuffer[DISPLAY_BUFFER_SIZE];
+	uint8_t sReceiveBuffer[PACKETLIMITELENGTH];
+	char sCommand[ARENA_COMMAND_SIZE];
+
+	union
+	{
+		// WAIT: 채널 고정 전 채널별 줄 버퍼
+		uint8_t sTransportLine[TRANSPORT_COUNT][TRANSPORT_LINE_SIZE];
+		// UPDATE
+		struct
+		{
+			// 수신 interrupt가 바로 받고 flash_wrtie()가 그대로 기록하는 payload
+			uint32_t sPacketPayload[PACKET_PAYLOAD_MAX / 4];
+			// LOADFILE: ELF/HEX parser 상태와 write-combine 버퍼 (loadflash.c)
+			LoadFileTypeDef sLoadFile;
+			uint32_t sLoadCombine[LOADFLASH_COMBINE_SIZE / 4];
+			// INFO, RAMLOAD: DATA를 받으면서 계산하는 서명 대상 hash
+			ImageHashTypeDef sImageHash;
+		};
+	} uPhase;
+} ArenaTypeDef;
+
+//Global Variable
+extern ArenaTypeDef sArena;
+
+//function
+void fArenaInit(void);
+uint32_t fArenaStackPeak(void);
+void fArenaReport(ArenaPhaseTypeDef ePhase);
+
+#endif /* INC_ARENA_H_ */
@@ -0,0 +1,26 @@
+/*
+ * bkpsram.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_BKPSRAM_H_
+#define INC_BKPSRAM_H_
+
+//define
+/*
+ *	Backup SRAM(4KB) 영역 배치. 리셋이 걸려도 내용이 유지되므로 업데이트 진행 상태처럼
+ *	재부팅 후에도 알아야 하는 정보를 여기에 둔다.
+ */
+/* 업데이트 진행 journal 영역, 256 Bytes */
+#define BKPSRAM_JOURNAL_ADDRESS			(BKPSRAM_BASE + 0x000)
+/* Application 이미지 검증 결과 cache 영역, 256 Bytes */
+#define BKPSRAM_IMAGE_CACHE_ADDRESS		(BKPSRAM_BASE + 0x100)
+/* Bootloader -> Application 전달 정보 영역, 256 Bytes (handoff.h, application도 읽는다) */
+#define BKPSRAM_HANDOFF_ADDRESS			(BKPSRAM_BASE + 0x200)
+
+//function
+void fBackupSramInit(void);
+
+#endif /* INC_BKPSRAM_H_ */
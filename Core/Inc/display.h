@@ -0,0 +1,60 @@
+/*
+ * display.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_DISPLAY_H_
+#define INC_DISPLAY_H_
+
+/*
+ *	SSD1306 그래픽 버퍼에 글자를 그리는 부분. I2C 전송은 bootcode.c의 ssd1306_xxx가 하고
+ *	여기는 버퍼만 다루므로 HAL 없이 host에서도 compile 된다 (Tools/bench/glyph_bench.c).
+ *
+ *	버퍼는 SSD1306 메모리와 같은 page 단위: page(8행) x 128 column, byte의 bit n이 page 안의 n번째 행
+ *
+ *	그리기 함수는 실제로 값이 바뀐 byte만 page별 column 범위(dirty)로 기록한다. 화면 전송 쪽은
+ *	fDisplayTakeDirty()로 바뀐 범위만 가져가 보내면 된다. 여러 줄에 걸친 글자처럼 이웃 page의 범위가 같으면
+ *	fDisplayTakeDirtyPages()로 묶어서 주소 지정 한번에 보낼 수 있다.
+ */
+#include <stdint.h>
+
+//define
+// 화면 가로 pixel, SSD1306 column 수 이하 (compile 옵션 -DDISPLAY_WIDTH=로 변경)
+#ifndef DISPLAY_WIDTH
+#define DISPLAY_WIDTH					128
+#endif
+// 화면 세로 pixel (compile 옵션 -DDISPLAY_HEIGHT=로 변경). 진행 표시 (progress.h)는 48행 이상이 필요하다
+#ifndef DISPLAY_HEIGHT
+#define DISPLAY_HEIGHT					64
+#endif
+
+#if (DISPLAY_WIDTH < 1) || (DISPLAY_WIDTH > 128)
+#error "DISPLAY_WIDTH must be 1 ~ 128"
+#endif
+#if (DISPLAY_HEIGHT < 16) || (DISPLAY_HEIGHT > 64) || ((DISPLAY_HEIGHT % 8) != 0)
+#error "DISPLAY_HEIGHT must be a multiple of 8 in 16 ~ 64"
+#endif
+
+// 그래픽 버퍼 page 수 (1 page = 8행)
+#define DISPLAY_PAGES					(DISPLAY_HEIGHT / 8)
+#define DISPLAY_BUFFER_SIZE				(DISPLAY_WIDTH * DISPLAY_PAGES)
+
+/* page별 바뀐 column 범위, iFirst > iLast 이면 바뀐 곳 없음 */
+typedef struct
+{
+	int16_t iFirst;
+	int16_t iLast;
+} DisplayDirtyTypeDef;
+
+//function
+void fDisplayClear(uint8_t *displaybuffer);
+void fDisplayInvalidate(void);
+int fDisplayTakeDirty(int iPage, int *iFirst, int *iLast);
+int fDisplayTakeDirtyPages(int iPage, int iMaxPages, int *iFirst, int *iLast);
+void fDisplayChar(int iLocationX, int iLocationY, char cData, uint8_t *displaybuffer);
+void fDisplayString(int iLocationX, int iLocationY, uint8_t *displaybuffer, const char *p, ...);
+void fDisplayFillRect(int iLocationX, int iLocationY, int iWidth, int iHeight, int iOn, uint8_t *displaybuffer);
+
+#endif /* INC_DISPLAY_H_ */
@@ -0,0 +1,33 @@
+/*
+ * flashram.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_FLASHRAM_H_
+#define INC_FLASHRAM_H_
+
+//define
+/*
+ *	1이면 flash_wrtie()가 SRAM에 올라간 register 직접 제어 엔진을 사용하고
+ *	0이면 기존 HAL_FLASH_Program() 경로를 사용한다. 두 경로의 KB당 cycle은
+ *	END 때 "[MCU]PERF,FLASH_PROGRAM,..."으로 보고되므로 바꿔가며 비교할 수 있다.
+ */
+#define FLASH_USE_RAM_ENGINE			1
+
+//Global Variable
+// 세션 동안 0xFFFFFFFF라서 프로그래밍을 생략한 word 수
+extern uint32_t iFlashSkippedWords;
+// 세션 동안 프로그래밍 요청된 전체 word 수
+extern uint32_t iFlashTotalWords;
+
+//function
+void fFlashSessionBegin(void);
+void fFlashSessionEnd(void);
+HAL_StatusTypeDef fFlashProgramWords(uint32_t Address, const uint32_t *data, uint32_t iWordCount);
+HAL_StatusTypeDef fFlashEraseSector(uint32_t Sector);
+int fFlashIsBlank(uint32_t Address, uint32_t iSize);
+void fFlashReport(void);
+
+#endif /* INC_FLASHRAM_H_ */
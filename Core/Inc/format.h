@@ -0,0 +1,24 @@
+/*
+ * format.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_FORMAT_H_
+#define INC_FORMAT_H_
+
+/*
+ *	newlib printf 대신 쓰는 작은 formatter. heap을 쓰지 않고 호출한 쪽 버퍼에만 쓴다.
+ *	HAL에 의존하지 않으므로 host에서도 그대로 compile 된다 (Tools/bench/format_bench.c).
+ *
+ *	지원: %d %i %u %x %X %s %c %%, flag '0' '-', 자리수, 'l' (무시, 32bit 전용)
+ */
+#include <stdarg.h>
+#include <stdint.h>
+
+//function
+int fFormatStringV(char *sBuffer, uint32_t iSize, const char *sFormat, va_list ap);
+int fFormatString(char *sBuffer, uint32_t iSize, const char *sFormat, ...);
+
+#endif /* INC_FORMAT_H_ */
@@ -0,0 +1,119 @@
+/*
+ * glyph.h
+ *
+ *  Generated by Tools/gen_glyphs.py from font.h, do not edit.
+ */
+
+#ifndef INC_GLYPH_H_
+#define INC_GLYPH_H_
+
+//define
+// 첫 글자 (' ')
+#define GLYPH_FIRST_CHAR				32
+// 글자 수
+#define GLYPH_COUNT						95
+// 글자 가로, 세로 pixel
+#define GLYPH_WIDTH						8
+#define GLYPH_HEIGHT					12
+
+/* 글자별 column 데이터, bit n = n번째 행 (SSD1306 page 방향과 같다) */
+static const uint16_t sGlyphTable[GLYPH_COUNT][GLYPH_WIDTH] =
+{
+	{ 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 },	// ' '
+	{ 0x000, 0x000, 0x000, 0x13E, 0x000, 0x000, 0x000, 0x000 },	// '!'
+	{ 0x000, 0x00E, 0x002, 0x000, 0x00E, 0x002, 0x000, 0x000 },	// '"'
+	{ 0x000, 0x350, 0x0F8, 0x356, 0x0F8, 0x056, 0x000, 0x000 },	// '#'
+	{ 0x000, 0x0D8, 0x0A4, 0x3A6, 0x064, 0x000, 0x000, 0x000 },	// '$'
+	{ 0x000, 0x024, 0x02A, 0x0A4, 0x150, 0x090, 0x000, 0x000 },	// '%'
+	{ 0x000, 0x0C0, 0x130, 0x148, 0x088, 0x140, 0x000, 0x000 },	// '&'
+	{ 0x000, 0x000, 0x000, 0x01E, 0x000, 0x000, 0x000, 0x000 },	// '''
+	{ 0x000, 0x000, 0x000, 0x1F8, 0x606, 0x000, 0x000, 0x000 },	// '('
+	{ 0x000, 0x000, 0x606, 0x1F8, 0x000, 0x000, 0x000, 0x000 },	// ')'
+	{ 0x000, 0x004, 0x034, 0x00E, 0x034, 0x004, 0x000, 0x000 },	// '*'
+	{ 0x020, 0x020, 0x020, 0x1FC, 0x020, 0x020, 0x020, 0x000 },	// '+'
+	{ 0x000, 0x000, 0x600, 0x380, 0x080, 0x000, 0x000, 0x000 },	// ','
+	{ 0x000, 0x020, 0x020, 0x020, 0x020, 0x020, 0x000, 0x000 },	// '-'
+	{ 0x000, 0x000, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000 },	// '.'
+	{ 0x000, 0x200, 0x180, 0x060, 0x018, 0x006, 0x000, 0x000 },	// '/'
+	{ 0x000, 0x0FC, 0x102, 0x102, 0x102, 0x0FC, 0x000, 0x000 },	// '0'
+	{ 0x000, 0x100, 0x102, 0x1FE, 0x100, 0x100, 0x000, 0x000 },	// '1'
+	{ 0x000, 0x184, 0x142, 0x122, 0x112, 0x18C, 0x000, 0x000 },	// '2'
+	{ 0x000, 0x084, 0x102, 0x112, 0x112, 0x0EC, 0x000, 0x000 },	// '3'
+	{ 0x000, 0x060, 0x050, 0x04C, 0x142, 0x1FE, 0x140, 0x000 },	// '4'
+	{ 0x000, 0x080, 0x11E, 0x112, 0x112, 0x0E2, 0x000, 0x000 },	// '5'
+	{ 0x000, 0x0F8, 0x114, 0x112, 0x112, 0x0E2, 0x000, 0x000 },	// '6'
+	{ 0x000, 0x006, 0x002, 0x182, 0x072, 0x00E, 0x000, 0x000 },	// '7'
+	{ 0x000, 0x0EC, 0x112, 0x112, 0x112, 0x0EC, 0x000, 0x000 },	// '8'
+	{ 0x000, 0x11C, 0x122, 0x122, 0x0A2, 0x07C, 0x000, 0x000 },	// '9'
+	{ 0x000, 0x000, 0x198, 0x198, 0x000, 0x000, 0x000, 0x000 },	// ':'
+	{ 0x000, 0x000, 0x300, 0x198, 0x098, 0x000, 0x000, 0x000 },	// ';'
+	{ 0x020, 0x050, 0x050, 0x088, 0x104, 0x104, 0x000, 0x000 },	// '<'
+	{ 0x000, 0x050, 0x050, 0x050, 0x050, 0x050, 0x000, 0x000 },	// '='
+	{ 0x104, 0x104, 0x088, 0x050, 0x050, 0x020, 0x000, 0x000 },	// '>'
+	{ 0x000, 0x000, 0x108, 0x144, 0x024, 0x018, 0x000, 0x000 },	// '?'
+	{ 0x000, 0x1FE, 0x201, 0x231, 0x249, 0x17E, 0x000, 0x000 },	// '@'
+	{ 0x100, 0x1C0, 0x17A, 0x046, 0x178, 0x1C0, 0x100, 0x000 },	// 'A'
+	{ 0x102, 0x1FE, 0x112, 0x112, 0x112, 0x0EC, 0x000, 0x000 },	// 'B'
+	{ 0x000, 0x0FC, 0x102, 0x102, 0x102, 0x086, 0x000, 0x000 },	// 'C'
+	{ 0x102, 0x1FE, 0x102, 0x102, 0x084, 0x078, 0x000, 0x000 },	// 'D'
+	{ 0x102, 0x1FE, 0x112, 0x13A, 0x102, 0x186, 0x000, 0x000 },	// 'E'
+	{ 0x000, 0x102, 0x1FE, 0x112, 0x03A, 0x002, 0x006, 0x000 },	// 'F'
+	{ 0x000, 0x0FC, 0x102, 0x102, 0x122, 0x0E6, 0x020, 0x000 },	// 'G'
+	{ 0x102, 0x1FE, 0x112, 0x010, 0x112, 0x1FE, 0x102, 0x000 },	// 'H'
+	{ 0x000, 0x102, 0x102, 0x1FE, 0x102, 0x102, 0x000, 0x000 },	// 'I'
+	{ 0x000, 0x0E0, 0x102, 0x102, 0x0FE, 0x002, 0x000, 0x000 },	// 'J'
+	{ 0x102, 0x1FE, 0x122, 0x030, 0x04A, 0x186, 0x102, 0x000 },	// 'K'
+	{ 0x000, 0x102, 0x1FE, 0x102, 0x100, 0x1C0, 0x000, 0x000 },	// 'L'
+	{ 0x102, 0x1FE, 0x10E, 0x030, 0x10E, 0x1FE, 0x102, 0x000 },	// 'M'
+	{ 0x102, 0x1FE, 0x10E, 0x070, 0x182, 0x1FE, 0x002, 0x000 },	// 'N'
+	{ 0x000, 0x0FC, 0x102, 0x102, 0x102, 0x0FC, 0x000, 0x000 },	// 'O'
+	{ 0x000, 0x102, 0x1FE, 0x122, 0x022, 0x01C, 0x000, 0x000 },	// 'P'
+	{ 0x000, 0x0FC, 0x102, 0x302, 0x302, 0x2FC, 0x000, 0x000 },	// 'Q'
+	{ 0x102, 0x1FE, 0x122, 0x022, 0x062, 0x09C, 0x100, 0x000 },	// 'R'
+	{ 0x000, 0x18C, 0x092, 0x112, 0x114, 0x0E6, 0x000, 0x000 },	// 'S'
+	{ 0x006, 0x002, 0x102, 0x1FE, 0x102, 0x002, 0x006, 0x000 },	// 'T'
+	{ 0x002, 0x0FE, 0x102, 0x100, 0x102, 0x0FE, 0x002, 0x000 },	// 'U'
+	{ 0x002, 0x00E, 0x072, 0x180, 0x072, 0x00E, 0x002, 0x000 },	// 'V'
+	{ 0x002, 0x0FE, 0x102, 0x0F0, 0x102, 0x0FE, 0x002, 0x000 },	// 'W'
+	{ 0x102, 0x186, 0x048, 0x030, 0x048, 0x186, 0x102, 0x000 },	// 'X'
+	{ 0x002, 0x006, 0x11A, 0x1E0, 0x11A, 0x006, 0x002, 0x000 },	// 'Y'
+	{ 0x000, 0x186, 0x142, 0x132, 0x10A, 0x186, 0x000, 0x000 },	// 'Z'
+	{ 0x000, 0x000, 0x7FE, 0x402, 0x402, 0x000, 0x000, 0x000 },	// '['
+	{ 0x000, 0x002, 0x01C, 0x060, 0x380, 0x000, 0x000, 0x000 },	// 'backslash'
+	{ 0x000, 0x000, 0x402, 0x402, 0x7FE, 0x000, 0x000, 0x000 },	// ']'
+	{ 0x000, 0x010, 0x008, 0x006, 0x008, 0x010, 0x000, 0x000 },	// '^'
+	{ 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x000 },	// '_'
+	{ 0x000, 0x000, 0x000, 0x002, 0x004, 0x000, 0x000, 0x000 },	// '`'
+	{ 0x000, 0x0D0, 0x128, 0x128, 0x128, 0x1F0, 0x100, 0x000 },	// 'a'
+	{ 0x102, 0x1FE, 0x110, 0x108, 0x108, 0x0F0, 0x000, 0x000 },	// 'b'
+	{ 0x000, 0x0F0, 0x108, 0x108, 0x108, 0x098, 0x000, 0x000 },	// 'c'
+	{ 0x000, 0x0F0, 0x108, 0x108, 0x112, 0x1FE, 0x100, 0x000 },	// 'd'
+	{ 0x000, 0x0F0, 0x128, 0x128, 0x128, 0x130, 0x000, 0x000 },	// 'e'
+	{ 0x000, 0x108, 0x1FC, 0x10A, 0x10A, 0x10A, 0x000, 0x000 },	// 'f'
+	{ 0x000, 0x0F0, 0x508, 0x508, 0x510, 0x3F8, 0x008, 0x000 },	// 'g'
+	{ 0x102, 0x1FE, 0x110, 0x008, 0x108, 0x1F0, 0x100, 0x000 },	// 'h'
+	{ 0x000, 0x108, 0x108, 0x1FA, 0x100, 0x100, 0x000, 0x000 },	// 'i'
+	{ 0x000, 0x408, 0x408, 0x40A, 0x3F8, 0x000, 0x000, 0x000 },	// 'j'
+	{ 0x102, 0x1FE, 0x020, 0x168, 0x198, 0x108, 0x000, 0x000 },	// 'k'
+	{ 0x000, 0x100, 0x102, 0x1FE, 0x100, 0x100, 0x000, 0x000 },	// 'l'
+	{ 0x108, 0x1F8, 0x108, 0x1F0, 0x108, 0x1F0, 0x100, 0x000 },	// 'm'
+	{ 0x108, 0x1F8, 0x110, 0x008, 0x108, 0x1F0, 0x100, 0x000 },	// 'n'
+	{ 0x000, 0x0F0, 0x108, 0x108, 0x108, 0x0F0, 0x000, 0x000 },	// 'o'
+	{ 0x408, 0x7F8, 0x510, 0x108, 0x108, 0x0F0, 0x000, 0x000 },	// 'p'
+	{ 0x000, 0x0F0, 0x108, 0x108, 0x510, 0x7F8, 0x408, 0x000 },	// 'q'
+	{ 0x000, 0x108, 0x1F8, 0x110, 0x108, 0x108, 0x000, 0x000 },	// 'r'
+	{ 0x000, 0x190, 0x128, 0x128, 0x128, 0x0D8, 0x000, 0x000 },	// 's'
+	{ 0x000, 0x008, 0x0FC, 0x108, 0x108, 0x108, 0x080, 0x000 },	// 't'
+	{ 0x008, 0x0F8, 0x100, 0x100, 0x088, 0x1F8, 0x100, 0x000 },	// 'u'
+	{ 0x008, 0x038, 0x0C8, 0x100, 0x0C8, 0x038, 0x008, 0x000 },	// 'v'
+	{ 0x008, 0x0F8, 0x108, 0x0E0, 0x108, 0x0F8, 0x008, 0x000 },	// 'w'
+	{ 0x108, 0x198, 0x060, 0x060, 0x198, 0x108, 0x000, 0x000 },	// 'x'
+	{ 0x008, 0x418, 0x468, 0x780, 0x4C8, 0x038, 0x008, 0x000 },	// 'y'
+	{ 0x000, 0x198, 0x148, 0x128, 0x118, 0x188, 0x000, 0x000 },	// 'z'
+	{ 0x000, 0x000, 0x040, 0x3BC, 0x402, 0x000, 0x000, 0x000 },	// '{'
+	{ 0x000, 0x000, 0x000, 0x3FE, 0x000, 0x000, 0x000, 0x000 },	// '|'
+	{ 0x000, 0x000, 0x402, 0x3BC, 0x040, 0x000, 0x000, 0x000 },	// '}'
+	{ 0x000, 0x040, 0x020, 0x040, 0x040, 0x020, 0x000, 0x000 },	// '~'
+};
+
+#endif /* INC_GLYPH_H_ */
@@ -0,0 +1,69 @@
+/*
+ * handoff.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_HANDOFF_H_
+#define INC_HANDOFF_H_
+
+#include "bkpsram.h"
+
+//define
+/*
+ *	Bootloader가 Application으로 넘어가면서 Backup SRAM(BKPSRAM_HANDOFF_ADDRESS)에 남기는 정보.
+ *	Application은 이 파일과 bkpsram.h를 그대로 가져가 include 해서 SystemClock_Config() 전에 아래처럼 확인한다.
+ *
+ *		__HAL_RCC_BKPSRAM_CLK_ENABLE();
+ *		if (fHandoffClockConfigured() == 1)
+ *		{
+ *			// PLL은 이미 동작중, clock 설정 생략
+ *			SystemCoreClockUpdate();
+ *			HAL_InitTick(TICK_INT_PRIORITY);
+ *		}
+ *
+ *	기록은 bootloader만 하고 application은 읽기만 하므로 backup domain write 허용은 필요 없다.
+ */
+// 전달 정보 유효 표시 -> "HOFF"
+#define HANDOFF_MAGIC					((uint32_t)0x46464F48)
+// clock tree(PLL 168MHz)를 설정된 그대로 두고 넘어감
+#define HANDOFF_FLAG_CLOCK_CONFIGURED	(1U << 0)
+
+// 1이면 clock을 그대로 두고 넘어간다, 0이면 reset 상태(HSI 16MHz)로 되돌린다
+#define HANDOFF_KEEP_CLOCK				1
+
+/* 전달 정보 */
+typedef struct
+{
+	// HANDOFF_MAGIC
+	uint32_t iMagic;
+	// HANDOFF_FLAG_xxx
+	uint32_t iFlags;
+	// 넘어갈 때의 SystemCoreClock (Hz)
+	uint32_t iSystemCoreClock;
+	// 위 필드 검증 값
+	uint32_t iCheck;
+} HandoffTypeDef;
+
+// Backup SRAM에 위치한 전달 정보
+#define HANDOFF		((volatile HandoffTypeDef *)BKPSRAM_HANDOFF_ADDRESS)
+
+/*
+ *  @brief	Bootloader가 clock을 설정한 채로 넘겨줬는지 확인. Application에서 사용
+ *  @param	None
+ *  @retval	clock 설정 생략 가능하면 1, 아니면 0
+ */
+static inline int fHandoffClockConfigured(void)
+{
+	if ((HANDOFF->iMagic != HANDOFF_MAGIC) || (HANDOFF->iCheck != ~(HANDOFF->iMagic ^ HANDOFF->iFlags ^ HANDOFF->iSystemCoreClock)))
+	{
+		return 0;
+	}
+	return ((HANDOFF->iFlags & HANDOFF_FLAG_CLOCK_CONFIGURED) != 0) ? 1 : 0;
+}
+
+//function
+void fHandoffPrepare(uint32_t VectorAddress);
+
+#endif /* INC_HANDOFF_H_ */
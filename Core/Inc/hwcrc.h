@@ -0,0 +1,25 @@
+/*
+ * hwcrc.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_HWCRC_H_
+#define INC_HWCRC_H_
+
+//define
+/*
+ *	STM32 CRC 유닛 결과 = CRC-32/MPEG-2 (poly 0x04C11DB7, init 0xFFFFFFFF, 반사 없음,
+ *	최종 XOR 없음). 메모리의 little endian word 단위로 계산하므로 host에서는 word마다
+ *	byte 순서를 뒤집어서 (b3,b2,b1,b0) CRC-32/MPEG-2에 넣으면 같은 값이 나온다
+ */
+// DMA 한번에 보낼 수 있는 최대 word 수 (NDTR 16bit)
+#define CRC_DMA_MAX_WORDS				0xFFFF
+
+//function
+void fCrcInit(void);
+void fCrcDeInit(void);
+uint32_t fCrcCalculate(uint32_t Address, uint32_t iSize);
+
+#endif /* INC_HWCRC_H_ */
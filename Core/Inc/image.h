@@ -0,0 +1,100 @@
+/*
+ * image.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_IMAGE_H_
+#define INC_IMAGE_H_
+
+#include "sha256.h"
+
+//define
+/*
+ *	Application partition 맨 앞에 host tool(Tools/mkimage.py)이 붙이는 이미지 header.
+ *	Application은 header 바로 뒤(partition 시작 + IMAGE_HEADER_SIZE)에 link 되어야 하며
+ *	vector table이 그 위치에 온다. VTOR 정렬(512 Bytes) 때문에 header 크기는 0x200.
+ *
+ *	CRC는 모두 hwcrc.h의 CRC 유닛 방식(CRC-32/MPEG-2, little endian word 단위)으로 계산한다.
+ *
+ *	서명은 header 앞 IMAGE_SIGNED_HEADER_SIZE Byte (iMagic ~ iHeaderCrc)와 header 뒤 이미지 전체를 이어 붙인
+ *	SHA-256에 대한 ECDSA P-256 서명이다 (Tools/mkimage.py --key). 공개키는 signkey.h.
+ *	INFO, RAMLOAD 업데이트는 DATA를 받으면서 hash를 계산해 두므로 END에서는 서명 검증만 남는다.
+ *	검증을 통과하면 cache에 기록되어 다음 부팅부터는 다시 검증하지 않는다. Application 영역은
+ *	bootloader만 기록하고 기록을 시작할 때 cache를 지운다는 전제이다.
+ */
+// header 시작 표시 -> "BIMG"
+#define IMAGE_MAGIC						((uint32_t)0x474D4942)
+// header 크기 = vector table 시작 offset
+#define IMAGE_HEADER_SIZE				0x200
+// 검증 결과 cache 유효 표시 -> "ICAC"
+#define IMAGE_CACHE_MAGIC				((uint32_t)0x43414349)
+// 1이면 서명이 맞는 이미지만 실행한다. 0이면 서명 field는 무시하고 CRC만 확인
+#define IMAGE_SIGNATURE_REQUIRED		1
+// 서명 크기 (r || s)
+#define IMAGE_SIGNATURE_SIZE			64
+// 서명 대상인 header 앞부분 크기 (iMagic ~ iHeaderCrc)
+#define IMAGE_SIGNED_HEADER_SIZE		(7 * 4)
+
+/* 이미지 header, Flash에 그대로 놓인다 */
+typedef struct
+{
+	// IMAGE_MAGIC
+	uint32_t iMagic;
+	// header 크기, IMAGE_HEADER_SIZE
+	uint32_t iHeaderSize;
+	// header 뒤 이미지 크기 (Byte), 4의 배수
+	uint32_t iImageLength;
+	// 이미지 version, host가 정한다
+	uint32_t iVersion;
+	// header 뒤 이미지 전체 CRC
+	uint32_t iImageCrc;
+	// Application vector table 주소 (초기 SP, Reset_Handler 위치)
+	uint32_t iEntryPoint;
+	// 위 필드 6개의 CRC
+	uint32_t iHeaderCrc;
+	// ECDSA P-256 서명 r || s (각 32 Byte big endian), 서명하지 않은 이미지는 0xFF
+	uint8_t  sSignature[IMAGE_SIGNATURE_SIZE];
+	// 예약, 0xFF로 채운다
+	uint8_t  sReserved[IMAGE_HEADER_SIZE - IMAGE_SIGNED_HEADER_SIZE - IMAGE_SIGNATURE_SIZE];
+} ImageHeaderTypeDef;
+
+/* DATA를 받으면서 계산하는 서명 대상 hash */
+typedef struct
+{
+	Sha256TypeDef sSha;
+	// 다음에 받을 partition 기준 offset, 이어지지 않으면 iValid = 0
+	uint32_t iNextOffset;
+	// header 뒤 이미지 크기, header 앞부분을 받은 뒤에 정해진다
+	uint32_t iImageLength;
+	int iValid;
+	// 서명 대상 header 앞부분, 다 모이면 hash에 넣는다
+	uint8_t sHeader[IMAGE_SIGNED_HEADER_SIZE];
+} ImageHashTypeDef;
+
+/* 검증 결과 cache, Backup SRAM에 둔다 */
+typedef struct
+{
+	// IMAGE_CACHE_MAGIC
+	uint32_t iMagic;
+	// 검증한 header 위치
+	uint32_t iAddress;
+	// 검증한 header의 iHeaderCrc, iImageCrc (header가 바뀌면 cache가 맞지 않게 된다)
+	uint32_t iHeaderCrc;
+	uint32_t iImageCrc;
+	// 위 필드 검증 값
+	uint32_t iCheck;
+} ImageCacheTypeDef;
+
+//function
+int fImageValidate(uint32_t Address, uint32_t iPartitionSize);
+int fImageValidateDigest(uint32_t Address, uint32_t iPartitionSize, const uint8_t *sDigest);
+void fImageHashStart(ImageHashTypeDef *pHash);
+void fImageHashDiscard(ImageHashTypeDef *pHash);
+void fImageHashFeed(ImageHashTypeDef *pHash, uint32_t iOffset, const uint8_t *sData, uint32_t iLength);
+int fImageHashFinish(ImageHashTypeDef *pHash, uint8_t *sDigest);
+void fImageCacheInvalidate(void);
+uint32_t fImageGetEntryPoint(uint32_t Address);
+
+#endif /* INC_IMAGE_H_ */
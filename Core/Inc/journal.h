@@ -0,0 +1,58 @@
+/*
+ * journal.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_JOURNAL_H_
+#define INC_JOURNAL_H_
+
+//define
+// journal 유효 표시 -> "JRNL"
+#define JOURNAL_MAGIC					((uint32_t)0x4A524E4C)
+
+/*
+ *	기록 완료 개수 slot. 개수와 그 보수를 같이 두어 둘 중 하나만 써진 slot은 무효로 본다
+ */
+typedef struct
+{
+	// 처음부터 연속으로 Flash에 기록 완료된 패킷 수
+	uint32_t iCommittedCount;
+	// ~iCommittedCount
+	uint32_t iCommittedCheck;
+} JournalSlotTypeDef;
+
+/*
+ *	업데이트 진행 journal. Backup SRAM에 두고 DATA 패킷이 ACK 될때마다 기록 완료
+ *	개수만 앞으로 늘려간다(append only). 링크가 끊기거나 리셋되어도 RESUME으로
+ *	마지막으로 기록된 다음 패킷부터 다시 받을 수 있다.
+ *	기록 완료 개수는 두 slot에 번갈아 쓰므로 쓰는 도중 리셋되어도 다른 slot의 직전 값이 남는다.
+ */
+typedef struct
+{
+	// journal 유효 여부
+	uint32_t iMagic;
+	// INFO로 받은 패킷 크기
+	uint32_t iPacketSize;
+	// INFO로 받은 패킷 개수
+	uint32_t iPacketCount;
+	// INFO에 이미지 CRC가 있었으면 1
+	uint32_t iHasImageCrc;
+	// INFO로 받은 이미지 CRC, 다른 이미지에 RESUME하지 않도록 비교한다
+	uint32_t iImageCrc;
+	// 위 필드 검증 값. INFO 때 한번만 쓴다
+	uint32_t iCheck;
+	// 기록 완료 개수, 홀수 번째는 sSlot[1], 짝수 번째는 sSlot[0]
+	JournalSlotTypeDef sSlot[2];
+} JournalTypeDef;
+
+//function
+void fJournalInit(void);
+void fJournalStart(uint32_t iPacketSize, uint32_t iPacketCount, int iHasImageCrc, uint32_t iImageCrc);
+void fJournalCommit(uint32_t iPacketIndex);
+void fJournalClear(void);
+int fJournalIsActive(void);
+int fJournalResume(uint32_t iPacketSize, uint32_t iPacketCount, int iHasImageCrc, uint32_t iImageCrc, uint32_t *iCommittedCount);
+
+#endif /* INC_JOURNAL_H_ */
@@ -0,0 +1,122 @@
+/*
+ * loadfile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_LOADFILE_H_
+#define INC_LOADFILE_H_
+
+/*
+ *	DATA payload로 나눠 들어오는 ELF 또는 Intel HEX 파일을 앞에서부터 한번만 읽으며 segment 단위로
+ *	(주소, data)를 넘겨주는 streaming parser. 파일 전체를 버퍼에 두지 않고 header, program header
+ *	한 개, HEX record 한 개만 state에 둔다. 형식은 첫 byte로 정한다 (0x7F "ELF" 또는 ':').
+ *
+ *	 - ELF	: 32bit little endian만 지원. program header table은 ELF header 뒤, segment data보다
+ *			  앞에 있어야 한다 (linker 기본 배치). PT_LOAD segment의 file 부분만 p_paddr(LMA)에 넘기고
+ *			  section header, debug 정보 등 나머지와 segment 사이 빈 곳은 읽고 버린다.
+ *	 - HEX	: record type 00, 01, 02, 04를 처리하고 03, 05 (시작 주소)는 무시한다. EOF record 뒤는 무시.
+ *
+ *	기록은 fLoadFileStart로 넘긴 함수가 한다. HAL에 의존하지 않으므로 host에서도 compile 된다
+ *	(Tools/sim/loadfile_sim.c).
+ */
+#include <stdint.h>
+
+//define
+// 파일 형식
+#define LOADFILE_FORMAT_UNKNOWN			0
+#define LOADFILE_FORMAT_ELF				1
+#define LOADFILE_FORMAT_HEX				2
+
+// 처리할 수 있는 PT_LOAD segment 수
+#define LOADFILE_ELF_SEGMENT_MAX		8
+// ELF32 header, program header 크기
+#define LOADFILE_ELF_HEADER_SIZE		52
+#define LOADFILE_ELF_PHDR_SIZE			32
+// HEX record 최대 byte 수 (길이, 주소 2, type, data 255, checksum)
+#define LOADFILE_HEX_RECORD_MAX			(5 + 255)
+
+// 결과, fLoadFileStart로 넘긴 기록 함수도 실패하면 아래 값 중 하나를 돌려준다
+#define LOADFILE_OK						0
+// 알 수 없는 형식, 깨진 header 또는 record
+#define LOADFILE_ERROR_FORMAT			(-1)
+// HEX record checksum 불일치
+#define LOADFILE_ERROR_CHECKSUM			(-2)
+// 지원하지 않는 ELF (64bit, big endian, segment 수 초과) 또는 HEX record type
+#define LOADFILE_ERROR_UNSUPPORTED		(-3)
+// program header가 segment data 뒤에 있거나 segment file 범위가 겹침
+#define LOADFILE_ERROR_ORDER			(-4)
+// 기록할 수 없는 주소 (Application partition 밖, image header 영역)
+#define LOADFILE_ERROR_ADDRESS			(-5)
+// 파일이 끝나지 않았는데 END (HEX EOF record 또는 segment data가 아직 안 옴)
+#define LOADFILE_ERROR_INCOMPLETE		(-6)
+// Flash erase, 프로그래밍 실패
+#define LOADFILE_ERROR_FLASH			(-7)
+// 패킷 번호가 건너뜀
+#define LOADFILE_ERROR_SEQUENCE			(-8)
+// 기록한 이미지 CRC가 host가 보낸 CRC와 다름
+#define LOADFILE_ERROR_CRC				(-9)
+// vector table (reset vector)이 기록되지 않음
+#define LOADFILE_ERROR_ENTRY			(-10)
+
+/* 기록 함수, 성공하면 LOADFILE_OK */
+typedef int (*LoadFileWriteTypeDef)(uint32_t Address, const uint8_t *sData, uint32_t iLength);
+
+/* PT_LOAD segment 중 file에 있는 부분 */
+typedef struct
+{
+	uint32_t iOffset;
+	uint32_t iFileSize;
+	uint32_t iAddress;
+} LoadFileSegmentTypeDef;
+
+/* parser 상태 */
+typedef struct
+{
+	LoadFileWriteTypeDef fWrite;
+	int iFormat;
+	// HEX EOF record를 받았거나 ELF segment를 모두 기록했으면 1
+	int iDone;
+	// 다음에 들어올 byte의 file offset
+	uint32_t iOffset;
+
+	union
+	{
+		struct
+		{
+			// header, program header 한 개를 모으는 버퍼와 채운 byte 수
+			uint8_t sBuffer[LOADFILE_ELF_HEADER_SIZE];
+			uint32_t iFill;
+			uint32_t iPhOffset;
+			uint32_t iPhEntrySize;
+			uint32_t iPhCount;
+			// 읽은 program header 수
+			uint32_t iPhIndex;
+			LoadFileSegmentTypeDef sSegment[LOADFILE_ELF_SEGMENT_MAX];
+			uint32_t iSegmentCount;
+			// 기록 중인 segment
+			uint32_t iSegmentIndex;
+		} sElf;
+
+		struct
+		{
+			// 읽고 있는 record, 16진수 두 글자를 한 byte로 바꿔 넣는다
+			uint8_t sRecord[LOADFILE_HEX_RECORD_MAX];
+			uint32_t iFill;
+			// record 안이면 1
+			int iInRecord;
+			// 앞 글자(상위 nibble)를 읽었으면 0x10 | nibble, 아니면 0
+			uint8_t iNibble;
+			// type 02, 04 record로 정한 기준 주소
+			uint32_t iBase;
+		} sHex;
+	} uFormat;
+} LoadFileTypeDef;
+
+//function
+void fLoadFileStart(LoadFileTypeDef *pLoad, LoadFileWriteTypeDef fWrite);
+int fLoadFileFeed(LoadFileTypeDef *pLoad, const uint8_t *sData, uint32_t iLength);
+int fLoadFileFinish(LoadFileTypeDef *pLoad);
+
+#endif /* INC_LOADFILE_H_ */
@@ -0,0 +1,38 @@
+/*
+ * loadflash.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_LOADFLASH_H_
+#define INC_LOADFLASH_H_
+
+/*
+ *	"[LOADFILE]"로 시작한 업데이트에서 loadfile.c가 넘겨주는 segment를 Application partition에 기록한다.
+ *
+ *	 - 주소가 이어지는 data는 write-combine 버퍼(arena)에 모아서 LOADFLASH_COMBINE_SIZE 단위로
+ *	   flash_wrtie()에 넘긴다. HEX의 16 Byte record도 한번에 기록된다.
+ *	 - 주소가 끊기면 버퍼를 비운다. 마지막 word의 남는 byte는 0xFF로 채우고, 다음 data가 같은 word면
+ *	   이어 붙여서 같은 word를 두번 프로그래밍하지 않는다.
+ *	 - partition 전체를 미리 지우지 않고 처음 기록하는 sector만 지운다 (이미 비어 있으면 생략).
+ *	   image header가 있는 첫 sector는 시작할 때 지워서 중간에 끊기면 부팅하지 않게 한다.
+ *	 - END에서 data가 없던 중간 sector를 지우고, 기록된 범위의 CRC로 image header를 만들어 기록한다.
+ *	   Application은 INFO 업데이트와 같이 partition 시작 + IMAGE_HEADER_SIZE에 link 되어야 한다.
+ *	 - header는 bootloader가 만들기 때문에 서명은 마지막 DATA 전에 "[SIGNATURE]"로 따로 받아 header에 같이 기록한다.
+ */
+#include "loadfile.h"
+
+//define
+// write-combine 버퍼 크기 (Byte), 4의 배수
+#define LOADFLASH_COMBINE_SIZE			256
+
+//function
+int fLoadFlashStart(void);
+int fLoadFlashFeed(const uint8_t *sData, uint32_t iLength);
+void fLoadFlashSetSignature(const uint8_t *sSignature);
+int fLoadFlashFinish(int iHasImageCrc, uint32_t iImageCrc, uint32_t *iFlashCrc);
+uint32_t fLoadFlashErrorAddress(void);
+uint32_t fLoadFlashImageLength(void);
+
+#endif /* INC_LOADFLASH_H_ */
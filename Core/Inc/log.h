@@ -0,0 +1,39 @@
+/*
+ * log.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_LOG_H_
+#define INC_LOG_H_
+
+//define
+/*
+ *	상태, 오류 메세지 전송. 문자열 대신 logtable.h의 ID와 인자만 보낸다.
+ *
+ *	frame: LOG_FRAME_SYNC, ID, 인자 개수, 인자(uint32, 7bit씩 낮은 자리부터, 상위 bit 1이면 다음 byte 이어짐)
+ *	예) "[MCU]DATA,ACK\r\n" 15 Bytes -> A5 02 00 3 Bytes
+ *
+ *	문자열은 ASCII만 쓰므로 0xA5는 frame 시작에만 나온다. host는 Tools/logdecode.py로 복원한다.
+ */
+// 1이면 ID frame 전송, 0이면 기존처럼 문자열 전송
+#define LOG_TOKENIZED					1
+// frame 시작 byte
+#define LOG_FRAME_SYNC					0xA5
+// 메세지 하나의 최대 인자 수
+#define LOG_MAX_ARGS					4
+
+/* 메세지 ID, logtable.h 순서 */
+typedef enum
+{
+#define LOG_MESSAGE(id, format)		id,
+#include "logtable.h"
+#undef LOG_MESSAGE
+	LOG_MESSAGE_MAX
+} LogIdTypeDef;
+
+//function
+void fLog(LogIdTypeDef eId, int iArgc, ...);
+
+#endif /* INC_LOG_H_ */
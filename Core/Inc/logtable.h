@@ -0,0 +1,53 @@
+/*
+ * logtable.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	Log 문자열 목록. LOG_MESSAGE(ID, "format")을 정의한 뒤 include 해서 쓰는 X-macro 파일이라
+ *	include guard가 없다. ID 번호는 목록 순서 그대로이므로 새 항목은 항상 끝에 추가하고
+ *	쓰지 않는 항목도 지우지 않는다. Tools/logdecode.py가 이 파일을 읽어 host에서 문자열을 복원한다.
+ *
+ *	format은 %d, %u, %X(%08X 처럼 0 채움 자리수 가능)만 사용하며 끝의 "\r\n"은 붙이지 않는다.
+ */
+LOG_MESSAGE(LOG_READY_ACK,			"[MCU]READY,ACK")
+LOG_MESSAGE(LOG_INFO_ACK,			"[MCU]INFO,ACK")
+LOG_MESSAGE(LOG_DATA_ACK,			"[MCU]DATA,ACK")
+LOG_MESSAGE(LOG_DATA_NACK,			"[MCU]DATA,NACK")
+LOG_MESSAGE(LOG_RESUME_ACK,			"[MCU]RESUME,ACK,%u,%u")
+LOG_MESSAGE(LOG_RESUME_NACK,		"[MCU]RESUME,NACK")
+LOG_MESSAGE(LOG_END_ACK,			"[MCU]END,ACK,%08X")
+LOG_MESSAGE(LOG_END_NACK,			"[MCU]END,NACK,%08X")
+LOG_MESSAGE(LOG_ERASE_SKIP,			"[MCU]ERASE,SKIP,%d")
+LOG_MESSAGE(LOG_FLASH_SKIP,			"[MCU]FLASH,SKIP,%u,%u")
+LOG_MESSAGE(LOG_PERF_FLASH_PROGRAM,	"[MCU]PERF,FLASH_PROGRAM,%u,%u")
+LOG_MESSAGE(LOG_PERF_FLASH_VERIFY,	"[MCU]PERF,FLASH_VERIFY,%u,%u")
+LOG_MESSAGE(LOG_IMAGE_INVALID,		"[MCU]IMAGE,INVALID,%d")
+LOG_MESSAGE(LOG_FLASH_ERASE_ERROR,	"[MCU][Error]HAL_FLASHEx_Erase=%d")
+LOG_MESSAGE(LOG_FLASH_PROGRAM_ERROR,	"[MCU][ERROR]%d")
+LOG_MESSAGE(LOG_FLASH_WRITE_ERROR,	"flash_wrtie Err")
+LOG_MESSAGE(LOG_I2C_COMMAND_ERROR,	"Err:%d")
+LOG_MESSAGE(LOG_I2C_DATA_ERROR,		"i2C Err:%d")
+LOG_MESSAGE(LOG_HARD_FAULT,			"HardFault_Handler")
+LOG_MESSAGE(LOG_MEM_MANAGE_FAULT,	"MemManage_Handler")
+LOG_MESSAGE(LOG_BUS_FAULT,			"BusFault_Handler")
+LOG_MESSAGE(LOG_USAGE_FAULT,		"UsageFault_Handler")
+LOG_MESSAGE(LOG_PERF_FORMAT,		"[MCU]PERF,FORMAT,%u,%u")
+LOG_MESSAGE(LOG_DISPLAY_READY,		"[MCU]DISPLAY,READY,%u")
+LOG_MESSAGE(LOG_TRANSPORT_BAUD,		"[MCU]BAUD,%u,%u")
+LOG_MESSAGE(LOG_PERF_PACKET_PARSE,	"[MCU]PERF,PACKET_PARSE,%u,%u")
+LOG_MESSAGE(LOG_RAM_USAGE,			"[MCU]RAM,%u,%u,%u,%u")
+LOG_MESSAGE(LOG_RAM_STACK,			"[MCU]RAM,STACK,%u")
+LOG_MESSAGE(LOG_RAMLOAD_ACK,		"[MCU]RAMLOAD,ACK,%u")
+LOG_MESSAGE(LOG_RAMLOAD_NACK,		"[MCU]RAMLOAD,NACK,%u")
+LOG_MESSAGE(LOG_RAMLOAD_RUN,		"[MCU]RAMLOAD,RUN,%08X,%u")
+LOG_MESSAGE(LOG_LOADFILE_ACK,		"[MCU]LOADFILE,ACK")
+LOG_MESSAGE(LOG_LOADFILE_NACK,		"[MCU]LOADFILE,NACK")
+LOG_MESSAGE(LOG_LOADFILE_ERROR,		"[MCU]LOADFILE,ERROR,%d,%08X")
+LOG_MESSAGE(LOG_PERF_IMAGE_HASH,	"[MCU]PERF,IMAGE_HASH,%u,%u")
+LOG_MESSAGE(LOG_IMAGE_SIGNATURE,	"[MCU]IMAGE,SIGNATURE,%d,%u")
+LOG_MESSAGE(LOG_SIGNATURE_ACK,		"[MCU]SIGNATURE,ACK")
+LOG_MESSAGE(LOG_SIGNATURE_NACK,		"[MCU]SIGNATURE,NACK")
+LOG_MESSAGE(LOG_PERF_PACKET_RECEIVE,	"[MCU]PERF,PACKET_RECEIVE,%u,%u")
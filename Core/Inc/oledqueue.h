@@ -0,0 +1,44 @@
+/*
+ * oledqueue.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_OLEDQUEUE_H_
+#define INC_OLEDQUEUE_H_
+
+//define
+/*
+ *	SSD1306 I2C 전송 queue. main loop는 frame(control byte + 내용)을 queue에 복사만 하고 바로
+ *	돌아가며, 실제 전송은 I2C2 TX DMA(DMA1 Stream7 Channel7)와 전송 완료 인터럽트가 이어서 처리한다.
+ *
+ *	queue 안의 frame: 길이(2 Bytes, control byte 포함), control byte, 내용
+ *	끝에 자리가 없으면 길이 0을 남기고 처음부터 이어 쓴다
+ */
+// queue 크기, 전체 화면 1번(약 620 Bytes) + 초기화 명령이 들어가는 크기
+#define OLED_QUEUE_SIZE					1024
+// SSD1306 I2C 주소 (7bit 0x3C)
+#define OLED_I2C_ADDRESS				(0x3C << 1)
+// control byte: 뒤가 모두 명령 / 모두 GDDRAM 데이터
+#define OLED_CONTROL_COMMAND			0x00
+#define OLED_CONTROL_DATA				0x40
+// I2C 전송 인터럽트 우선순위, USART2 수신(0)보다 낮게
+#define OLED_IRQ_PRIORITY				5
+// queue가 가득 찼을 때 명령 전송 최대 대기 시간 (ms)
+#define OLED_QUEUE_WAIT_TIMEOUT			100
+
+//Global Variable
+extern DMA_HandleTypeDef hdma_i2c2_tx;
+
+//function
+void fOledQueueInit(void);
+void fOledQueueDeInit(void);
+int fOledQueueSubmit(uint8_t iControl, const uint8_t *sData, uint16_t iLength);
+int fOledQueueHasRoom(uint32_t iBytes);
+int fOledQueueIsIdle(void);
+int fOledQueueFlush(uint32_t iTimeout);
+uint32_t fOledQueueIdleCycle(void);
+uint32_t fOledQueueErrorCount(void);
+
+#endif /* INC_OLEDQUEUE_H_ */
@@ -0,0 +1,26 @@
+/*
+ * p256.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_P256_H_
+#define INC_P256_H_
+
+/*
+ *	이미지 서명 검증용 ECDSA P-256 (secp256r1) 서명 검증. 서명하는 쪽은 host tool(Tools/p256.py)이다.
+ *	공개키, digest, 서명만 다루므로 constant time으로 만들 필요가 없다.
+ *	HAL에 의존하지 않으므로 host에서도 compile 된다 (Tools/bench/sign_bench.c).
+ */
+#include <stdint.h>
+
+//define
+// 공개키 x || y, 서명 r || s (각 32 Byte big endian)
+#define P256_PUBLIC_KEY_SIZE			64
+#define P256_SIGNATURE_SIZE				64
+
+//function
+int fP256Verify(const uint8_t *sPublicKey, const uint8_t *sDigest, const uint8_t *sSignature);
+
+#endif /* INC_P256_H_ */
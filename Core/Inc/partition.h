@@ -0,0 +1,94 @@
+/*
+ * partition.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_PARTITION_H_
+#define INC_PARTITION_H_
+
+/*
+ *	STM32F429ZI Flash(2MB) 배치를 한곳에서 정의한다. HAL에 의존하지 않으므로 host 프로그램에서도
+ *	그대로 include 해서 쓸 수 있다. 배치를 바꾸면 STM32F429ZITX_FLASH.ld의 FLASH 영역 크기도
+ *	PARTITION_BOOTLOADER_SIZE와 같게 맞춰야 한다.
+ */
+#include <stdint.h>
+
+//define
+#define PARTITION_FLASH_BASE				((uint32_t)0x08000000)
+#define PARTITION_FLASH_BANK_SIZE		((uint32_t)0x00100000)
+#define PARTITION_FLASH_SIZE				(PARTITION_FLASH_BANK_SIZE * 2)
+// Bank마다 16KB x4, 64KB x1, 128KB x7
+#define PARTITION_SECTORS_PER_BANK			12
+#define PARTITION_SECTOR_TOTAL				(PARTITION_SECTORS_PER_BANK * 2)
+
+/* sector 번호로 bank 안에서의 offset과 크기 계산, 상수식이라 정적 초기화에 사용 가능 */
+#define PARTITION_SECTOR_OFFSET_IN_BANK(s)	(((s) < 4) ? ((uint32_t)(s) * 0x4000) : (((s) == 4) ? (uint32_t)0x10000 : ((uint32_t)((s) - 4) * 0x20000)))
+#define PARTITION_SECTOR_SIZE_IN_BANK(s)	(((s) < 4) ? (uint32_t)0x4000 : (((s) == 4) ? (uint32_t)0x10000 : (uint32_t)0x20000))
+#define PARTITION_SECTOR_ADDRESS(n)			(PARTITION_FLASH_BASE + (((n) / PARTITION_SECTORS_PER_BANK) * PARTITION_FLASH_BANK_SIZE) + PARTITION_SECTOR_OFFSET_IN_BANK((n) % PARTITION_SECTORS_PER_BANK))
+#define PARTITION_SECTOR_SIZE(n)			PARTITION_SECTOR_SIZE_IN_BANK((n) % PARTITION_SECTORS_PER_BANK)
+
+/* Partition 배치, sector 번호 기준 (처음과 마지막 포함) */
+// Bootloader 코드, 48KB (printf, heap 없이). 서명 검증 (p256.c, sha256.c)이 들어가면서 32KB에서 늘렸다
+#define PARTITION_BOOTLOADER_FIRST_SECTOR	0
+#define PARTITION_BOOTLOADER_LAST_SECTOR	2
+// 설정, 이미지 정보 등 보관용 (journal과 검증 cache는 Backup SRAM이라 아직 쓰는 곳이 없다)
+#define PARTITION_METADATA_FIRST_SECTOR		3
+#define PARTITION_METADATA_LAST_SECTOR		3
+// Application, 빌드 옵션(-DPARTITION_APPLICATION_FIRST_SECTOR=n)으로 시작 sector 변경 가능
+#ifndef PARTITION_APPLICATION_FIRST_SECTOR
+#define PARTITION_APPLICATION_FIRST_SECTOR	4
+#endif
+#define PARTITION_APPLICATION_LAST_SECTOR	23
+
+#define PARTITION_ADDRESS(first)			PARTITION_SECTOR_ADDRESS(first)
+#define PARTITION_SIZE(first, last)			(PARTITION_SECTOR_ADDRESS(last) + PARTITION_SECTOR_SIZE(last) - PARTITION_SECTOR_ADDRESS(first))
+
+#define PARTITION_BOOTLOADER_ADDRESS		PARTITION_ADDRESS(PARTITION_BOOTLOADER_FIRST_SECTOR)
+#define PARTITION_BOOTLOADER_SIZE			PARTITION_SIZE(PARTITION_BOOTLOADER_FIRST_SECTOR, PARTITION_BOOTLOADER_LAST_SECTOR)
+#define PARTITION_METADATA_ADDRESS			PARTITION_ADDRESS(PARTITION_METADATA_FIRST_SECTOR)
+#define PARTITION_METADATA_SIZE				PARTITION_SIZE(PARTITION_METADATA_FIRST_SECTOR, PARTITION_METADATA_LAST_SECTOR)
+#define PARTITION_APPLICATION_ADDRESS		PARTITION_ADDRESS(PARTITION_APPLICATION_FIRST_SECTOR)
+#define PARTITION_APPLICATION_SIZE			PARTITION_SIZE(PARTITION_APPLICATION_FIRST_SECTOR, PARTITION_APPLICATION_LAST_SECTOR)
+
+#if (PARTITION_APPLICATION_FIRST_SECTOR <= PARTITION_METADATA_LAST_SECTOR) || (PARTITION_APPLICATION_FIRST_SECTOR > PARTITION_APPLICATION_LAST_SECTOR)
+#error "PARTITION_APPLICATION_FIRST_SECTOR must be after the metadata partition"
+#endif
+
+/* sector 정보 */
+typedef struct
+{
+	uint32_t iAddress;
+	uint32_t iSize;
+} FlashSectorTypeDef;
+
+/* partition 종류 */
+typedef enum
+{
+	PARTITION_BOOTLOADER = 0,
+	PARTITION_METADATA,
+	PARTITION_APPLICATION,
+	PARTITION_MAX
+} PartitionIdTypeDef;
+
+/* partition 정보 */
+typedef struct
+{
+	const char *sName;
+	uint32_t iFirstSector;
+	uint32_t iLastSector;
+	uint32_t iAddress;
+	uint32_t iSize;
+} PartitionTypeDef;
+
+//Global Variable
+extern const FlashSectorTypeDef sFlashSectorTable[PARTITION_SECTOR_TOTAL];
+extern const PartitionTypeDef sPartitionTable[PARTITION_MAX];
+
+//function
+int32_t fPartitionGetSector(uint32_t Address);
+const PartitionTypeDef *fPartitionGet(PartitionIdTypeDef ePartition);
+int fPartitionContains(PartitionIdTypeDef ePartition, uint32_t Address, uint32_t iSize);
+
+#endif /* INC_PARTITION_H_ */
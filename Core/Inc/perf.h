@@ -0,0 +1,36 @@
+/*
+ * perf.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_PERF_H_
+#define INC_PERF_H_
+
+//define
+/*
+ *	DWT cycle counter 기반 성능 측정 항목. 항목마다 누적 cycle과 처리한 byte 수를
+ *	모아 두었다가 KB당 cycle로 보고한다.
+ */
+typedef enum
+{
+	PERF_FLASH_PROGRAM = 0,		// flash_wrtie() 프로그래밍
+	PERF_FLASH_VERIFY,			// END 때 기록 영역 CRC 검증
+	PERF_FORMAT,				// fUartPrintFormat() 문자열 생성, byte는 생성된 글자 수
+	PERF_PACKET_PARSE,			// DATA 패킷 번호 변환과 checksum 계산, byte는 payload 크기
+	PERF_IMAGE_HASH,			// 서명 대상 SHA-256 계산 (DATA 수신 중 또는 메모리에서)
+	PERF_PACKET_RECEIVE,		// DATA 패킷 수신 interrupt (fTransportRxIsr + getRxBuffer), byte는 payload 크기
+	PERF_COUNTER_MAX
+} PerfCounterTypeDef;
+
+//function
+void fPerfInit(void);
+void fPerfReset(void);
+uint32_t fPerfStart(void);
+void fPerfStop(PerfCounterTypeDef eCounter, uint32_t iStartCycle, uint32_t iBytes);
+void fPerfAdd(PerfCounterTypeDef eCounter, uint32_t iCycles, uint32_t iBytes);
+uint32_t fPerfCyclesPerKB(PerfCounterTypeDef eCounter);
+void fPerfReport(void);
+
+#endif /* INC_PERF_H_ */
@@ -0,0 +1,60 @@
+/*
+ * progress.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_PROGRESS_H_
+#define INC_PROGRESS_H_
+
+/*
+ *	업데이트 진행 상황 (패킷 번호/개수, 진행률, bytes/s, 남은 시간)을 그래픽 버퍼 아래쪽 32행에 그린다.
+ *
+ *	 행 0 ~ 11	"123/456      27%"
+ *	 행 12 ~ 23	"10.9KB/s   1m05s"
+ *	 행 24 ~ 31	진행 막대
+ *
+ *	글자 줄은 항상 16자로 채워 쓰고 막대는 늘어난 column만 바뀌므로 display.c dirty 범위에는
+ *	실제로 바뀐 글자와 막대 끝부분만 들어간다. 다시 그리는 간격은 PROGRESS_REFRESH_INTERVAL로 제한.
+ *
+ *	시간은 호출한 쪽이 ms 단위로 넘겨준다. HAL에 의존하지 않으므로 host에서도 compile 된다
+ *	(Tools/sim/display_sim.c).
+ */
+#include <stdint.h>
+
+#include "display.h"
+
+//define
+// 화면 다시 그리는 최소 간격 (ms)
+#define PROGRESS_REFRESH_INTERVAL		250
+// 진행 표시가 시작하는 행, 화면 아래쪽 32행을 사용
+#define PROGRESS_TOP					(DISPLAY_HEIGHT - 32)
+
+// 위쪽 16행은 "Boot Loader" 제목 줄 (GLYPH_HEIGHT 12행)이 쓴다. 그보다 낮은 화면에서는 겹친다
+#if (DISPLAY_HEIGHT < 48)
+#error "progress.h needs DISPLAY_HEIGHT >= 48 (title 16 rows + progress 32 rows)"
+#endif
+
+/* 진행 상황 */
+typedef struct
+{
+	uint32_t iPacketSize;
+	uint32_t iPacketCount;
+	// 시작할 때 이미 기록되어 있던 패킷 수 (RESUME)
+	uint32_t iStartPacket;
+	// 마지막으로 기록 완료된 패킷 번호 (1부터)
+	uint32_t iPacketIndex;
+	uint32_t iStartTick;
+	uint32_t iLastDrawTick;
+	uint32_t iBytesPerSecond;
+	uint32_t iEtaSeconds;
+} ProgressTypeDef;
+
+//function
+void fProgressStart(uint32_t iPacketSize, uint32_t iPacketCount, uint32_t iCommittedCount, uint32_t iTick);
+int fProgressUpdate(uint32_t iPacketIndex, uint32_t iTick);
+void fProgressDraw(uint8_t *displaybuffer);
+const ProgressTypeDef *fProgressGet(void);
+
+#endif /* INC_PROGRESS_H_ */
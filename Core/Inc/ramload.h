@@ -0,0 +1,31 @@
+/*
+ * ramload.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_RAMLOAD_H_
+#define INC_RAMLOAD_H_
+
+/*
+ *	개발용 RAM load-and-run. host가 "[RAMLOAD]"로 시작하면 DATA payload를 Flash 대신 SRAM의
+ *	RAM load 영역에 받고, END에서 image header와 CRC가 맞으면 Flash를 건드리지 않고 바로 실행한다.
+ *
+ *	영역은 linker script의 RAMLOAD memory(_sramload ~ _eramload)이며 bootloader의 .data, .bss,
+ *	stack은 그 위쪽 RAM memory에 놓인다. Application은 Flash 이미지와 같은 형식으로 만들되
+ *	RAMLOAD_ADDRESS + IMAGE_HEADER_SIZE에 link 한다 (Tools/mkimage.py --ram).
+ *	리셋하면 내용이 사라지므로 Flash에 있던 application은 그대로 남는다.
+ */
+#include <stdint.h>
+
+//define
+// RAM load 영역 시작 주소, linker script RAMLOAD memory ORIGIN과 같아야 한다
+#define RAMLOAD_ADDRESS					((uint32_t)0x20000000)
+
+//function
+uint32_t fRamLoadSize(void);
+int fRamLoadContains(uint32_t Address, uint32_t iSize);
+int fRamLoadWrite(uint32_t Address, const uint32_t *data, uint32_t iSize);
+
+#endif /* INC_RAMLOAD_H_ */
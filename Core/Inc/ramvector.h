@@ -0,0 +1,20 @@
+/*
+ * ramvector.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_RAMVECTOR_H_
+#define INC_RAMVECTOR_H_
+
+//define
+// Cortex-M4 시스템 예외 16개 + STM32F429 외부 인터럽트 91개
+#define VECTOR_TABLE_SIZE				(16 + 91)
+
+//function
+void fVectorTableToRam(void);
+void fVectorTableSetHandler(IRQn_Type IRQn, void (*handler)(void));
+void fVectorTableRestore(void);
+
+#endif /* INC_RAMVECTOR_H_ */
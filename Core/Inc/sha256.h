@@ -0,0 +1,37 @@
+/*
+ * sha256.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_SHA256_H_
+#define INC_SHA256_H_
+
+/*
+ *	이미지 서명 검증용 SHA-256. 데이터를 나눠서 넣을 수 있어 DATA 패킷이 들어올 때마다 이어서 계산한다.
+ *	HAL에 의존하지 않으므로 host에서도 compile 된다 (Tools/bench/sign_bench.c).
+ */
+#include <stdint.h>
+
+//define
+#define SHA256_BLOCK_SIZE				64
+#define SHA256_DIGEST_SIZE				32
+
+/* 계산 상태 */
+typedef struct
+{
+	uint32_t iState[8];
+	// 지금까지 넣은 전체 byte 수
+	uint64_t iLength;
+	// 64 Byte가 안 되어 남겨 둔 data
+	uint8_t sBlock[SHA256_BLOCK_SIZE];
+	uint32_t iFill;
+} Sha256TypeDef;
+
+//function
+void fSha256Init(Sha256TypeDef *pSha);
+void fSha256Update(Sha256TypeDef *pSha, const uint8_t *sData, uint32_t iLength);
+void fSha256Final(Sha256TypeDef *pSha, uint8_t *sDigest);
+
+#endif /* INC_SHA256_H_ */
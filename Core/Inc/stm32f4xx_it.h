@@ -58,6 +58,13 @@ void PendSV_Handler(void);
 void SysTick_Handler(void);
 void USART2_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void USART2_RamIRQHandler(void);
+void USART3_IRQHandler(void);
+void USART3_RamIRQHandler(void);
+void SysTick_RamHandler(void);
+void DMA1_Stream7_IRQHandler(void);
+void I2C2_EV_IRQHandler(void);
+void I2C2_ER_IRQHandler(void);
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,73 @@
+/*
+ * transport.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_TRANSPORT_H_
+#define INC_TRANSPORT_H_
+
+/*
+ *	업데이트 패킷을 받는 UART 채널 관리. USART2 (PD5/PD6, 외부 adapter)와 USART3 (ST-LINK VCP)를
+ *	동시에 듣다가 처음으로 올바른 INFO/RESUME/RAMLOAD/LOADFILE을 보낸 채널에 고정(lock)한다.
+ *
+ *	- lock 전: 채널마다 따로 있는 줄 버퍼에 RXNE 인터럽트로 받는다. bootcode가 fTransportTakeLine()으로
+ *	  완성된 줄을 검사하고 맞으면 fTransportLock()으로 고정한다. 송신은 모든 채널로 보낸다.
+ *	- lock 후: 고정된 채널만 RXNE를 켜 두고 바로 getRxBuffer()로 넘긴다. 송신도 고정된 채널로만.
+ *
+ *	채널마다 IRQ와 버퍼가 따로라 한쪽 수신이 다른 쪽을 기다리게 하지 않는다.
+ *	수신 handler는 Flash erase 중에도 돌 수 있게 SRAM에서 실행된다 (__RAM_FUNC).
+ *
+ *	자동 baud rate (TRANSPORT_AUTOBAUD): host는 원하는 속도로 port를 열고 READY가 올 때까지 sync byte
+ *	(0x55)를 보낸다. USART2/3 RX pin에는 timer 입력이 없어서 READY 사이 대기 시간 동안 RX pin을 직접
+ *	읽고 DWT cycle counter로 0x55의 edge 간격 (모두 1 bit)을 잰다. 9개 간격이 고르면 그 채널 BRR을 바꾼다.
+ *	고정 전 줄 버퍼는 '['로 시작하는 줄만 받으므로 sync byte와 속도가 맞기 전 쓰레기 값은 버려진다.
+ */
+
+//define
+// 채널 번호
+#define TRANSPORT_UART2					0
+#define TRANSPORT_UART3					1
+#define TRANSPORT_COUNT					2
+// lock 전 채널별 줄 버퍼 크기, INFO/RESUME/RAMLOAD/LOADFILE 한 줄이 들어가면 된다
+#define TRANSPORT_LINE_SIZE				64
+// 아직 고정된 채널 없음
+#define TRANSPORT_NONE					(-1)
+// 1이면 고정 전 READY 대기 시간 동안 sync byte로 baud rate 측정
+#define TRANSPORT_AUTOBAUD				1
+// sync byte, 시작 bit 포함 모든 bit 경계에 edge가 생긴다
+#define TRANSPORT_SYNC_BYTE				0x55
+// 측정 가능한 최저 baud rate
+#define TRANSPORT_AUTOBAUD_MIN_RATE		9600
+// 표준 baud rate와 이 비율(%) 안이면 표준 값을 사용
+#define TRANSPORT_AUTOBAUD_SNAP_PERCENT	3
+
+/* 채널 하나 */
+typedef struct
+{
+	UART_HandleTypeDef *pHandle;
+	IRQn_Type iIrq;
+	// 자동 baud rate 측정용 RX pin
+	GPIO_TypeDef *pRxPort;
+	uint16_t iRxPin;
+	// lock 전 수신 줄 버퍼 (TRANSPORT_LINE_SIZE, arena.h WAIT phase), iLineReady가 1이면 main loop가 가져갈 때까지 더 받지 않는다
+	uint8_t *pLine;
+	volatile uint16_t iLineLength;
+	volatile uint8_t iLineReady;
+} TransportChannelTypeDef;
+
+//function
+void fTransportInit(void);
+void fTransportEnableRx(void);
+int fTransportTakeLine(uint8_t *sData, int iSize, int *iLength);
+void fTransportLock(int iChannel);
+int fTransportActive(void);
+UART_HandleTypeDef *fTransportHandle(void);
+void fTransportWrite(const uint8_t *sData, uint16_t iLength, uint32_t iTimeout);
+int fTransportAutoBaud(uint32_t iWindow);
+void fTransportSetBaudRate(int iChannel, uint32_t iBaudRate);
+uint32_t fTransportTakeRxCycles(void);
+void fTransportRxIsr(int iChannel);
+
+#endif /* INC_TRANSPORT_H_ */
@@ -0,0 +1,22 @@
+/*
+ * uartio.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+#ifndef INC_UARTIO_H_
+#define INC_UARTIO_H_
+
+//define
+// UART 송신 timeout (ms)
+#define UARTIO_TX_TIMEOUT				0xFFFF
+// fUartPrintFormat 한번에 보낼 수 있는 최대 길이 (stack 사용)
+#define UARTIO_FORMAT_BUFFER_SIZE		96
+
+//function
+void fUartWrite(const uint8_t *sData, uint16_t iLength);
+void fUartPrint(const char *sData);
+void fUartPrintFormat(const char *sFormat, ...);
+
+#endif /* INC_UARTIO_H_ */
@@ -0,0 +1,93 @@
+/*
+ * arena.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "arena.h"
+#include "log.h"
+
+#include <stddef.h>
+
+// bootloader 버퍼
+ArenaTypeDef sArena ARENA_SECTION;
+
+// linker script 심볼
+extern uint32_t _sdata;
+extern uint32_t _ebss;
+extern uint32_t _snoinit;
+extern uint32_t _enoinit;
+extern uint32_t _estack;
+
+// phase별로 사용하는 arena 크기, 공통 부분 + 해당 phase의 union member
+static const uint32_t sArenaPhaseBytes[ARENA_PHASE_MAX] =
+{
+	offsetof(ArenaTypeDef, uPhase) + sizeof(sArena.uPhase.sTransportLine),
+	offsetof(ArenaTypeDef, uPhase.sImageHash) + sizeof(sArena.uPhase.sImageHash),
+};
+
+// stack pattern을 채운 가장 낮은 주소
+static uint32_t *pArenaStackPaintBottom = NULL;
+
+/*
+ *  @brief	stack 최대 사용량 측정 준비. 현재 stack 아래 ARENA_STACK_PAINT_SIZE 만큼을 pattern으로 채운다
+ *			(전체 빈 RAM이 아니라 정해진 크기만 채워서 시작 시간을 늘리지 않는다)
+ *  @param	None
+ *  @retval	None
+ */
+void fArenaInit(void)
+{
+	uint32_t *pStack = (uint32_t *)__get_MSP();
+	uint32_t *pBottom = pStack - (ARENA_STACK_PAINT_SIZE / 4);
+
+	// 현재 함수 frame 아래 여유를 두고 채운다
+	pStack -= 16;
+	if (pBottom < &_enoinit)
+	{
+		pBottom = &_enoinit;
+	}
+	pArenaStackPaintBottom = pBottom;
+
+	while (pBottom < pStack)
+	{
+		*pBottom++ = ARENA_STACK_PAINT_PATTERN;
+	}
+}
+
+/*
+ *  @brief	지금까지 stack 최대 사용량
+ *  @param	None
+ *  @retval	byte 수, fArenaInit() 전이면 0
+ */
+uint32_t fArenaStackPeak(void)
+{
+	uint32_t *p = pArenaStackPaintBottom;
+
+	if (p == NULL)
+	{
+		return 0;
+	}
+	// pattern이 남아 있는 곳은 한번도 쓰이지 않았다
+	while ((p < &_estack) && (*p == ARENA_STACK_PAINT_PATTERN))
+	{
+		p++;
+	}
+	return (uint32_t)&_estack - (uint32_t)p;
+}
+
+/*
+ *  @brief	phase별 RAM 사용량 보고. "[MCU]RAM,phase,phase arena byte,arena 전체 byte,SRAM static byte"와
+ *			"[MCU]RAM,STACK,stack 최대 byte"
+ *  @param	ePhase	보고할 phase
+ *  @retval	None
+ */
+void fArenaReport(ArenaPhaseTypeDef ePhase)
+{
+	// .data(RamFunc 포함) + .bss + .noinit
+	uint32_t iStatic = ((uint32_t)&_ebss - (uint32_t)&_sdata) + ((uint32_t)&_enoinit - (uint32_t)&_snoinit);
+
+	fLog(LOG_RAM_USAGE, 4, ePhase, sArenaPhaseBytes[ePhase], sizeof(ArenaTypeDef), iStatic);
+	fLog(LOG_RAM_STACK, 1, fArenaStackPeak());
+}
@@ -0,0 +1,27 @@
+/*
+ * bkpsram.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "bkpsram.h"
+
+/*
+ *  @brief	Backup SRAM 접근 허용. 클럭 활성 후 backup domain write protect 해제
+ *  @param	None
+ *  @retval	None
+ */
+void fBackupSramInit(void)
+{
+	// PWR 클럭과 backup domain 접근 허용
+	__HAL_RCC_PWR_CLK_ENABLE();
+	HAL_PWR_EnableBkUpAccess();
+
+	// Backup SRAM 클럭 활성
+	__HAL_RCC_BKPSRAM_CLK_ENABLE();
+
+	// VBAT만 남아 있어도 내용 유지하도록 backup regulator 활성
+	HAL_PWREx_EnableBkUpReg();
+}
@@ -9,52 +9,86 @@
 #include "usart.h"
 #include "gpio.h"
 
-#include "font.h"
+#include "display.h"
 #include "bootcode.h"
+#include "journal.h"
+#include "flashram.h"
+#include "perf.h"
+#include "ramvector.h"
+#include "hwcrc.h"
+#include "partition.h"
+#include "image.h"
+#include "handoff.h"
+#include "log.h"
+#include "oledqueue.h"
+#include "progress.h"
+#include "transport.h"
+#include "arena.h"
+#include "ramload.h"
+#include "loadflash.h"
+#include "stm32f4xx_it.h"
 
 #include <string.h>
 
 /* Start @ of user Flash area */
-#define FLASH_USER_START_ADDR					ADDR_FLASH_SECTOR_6	
-/* End @ of user Flash area : sector start address + sector size -1 */
-#define FLASH_USER_END_ADDR						ADDR_FLASH_SECTOR_23  +  GetSectorSize(ADDR_FLASH_SECTOR_23) -1
+#define FLASH_USER_START_ADDR					PARTITION_APPLICATION_ADDRESS
+/* End @ of user Flash area : partition start address + partition size -1 */
+#define FLASH_USER_END_ADDR						(PARTITION_APPLICATION_ADDRESS + PARTITION_APPLICATION_SIZE - 1)
 
 //flash write Test Data
 #define DATA_32									((uint32_t)0x00000000)
 
-// UART Packet limit size
-#define	PACKETLIMITELENGTH						256
+// UART Packet limit size (PACKETLIMITELENGTH)와 DATA payload 최대 크기는 arena.h
 
-// Wait update signal -> 5000ms (5초)
-#define APPLICATION_UPDATE_WAITING_TIME_VALU	5000
-
-// jump address 
-#define APPLICATION_ADDRESS						FLASH_USER_START_ADDR
-
-//Graphic buffer
-uint8_t gpubuffer[512] = "";
+// 수신 interrupt 상태, DATA 패킷은 "[DATA]번호," 뒤 패킷 크기만큼을 payload 버퍼로 받는다
+#define RX_STATE_HEADER							0
+#define RX_STATE_PAYLOAD						1
+#define RX_STATE_TRAILER						2
 
-// UART Rx DMA Buffer
-uint8_t sUART_DMA_ReceiveBuffer[PACKETLIMITELENGTH];
+// SSD1306 COM pin 배치, 64행 panel은 alternative (0x12), 32행 이하는 sequential (0x02)
+#if DISPLAY_HEIGHT > 32
+#define SSD1306_COM_PINS						0x12
+#else
+#define SSD1306_COM_PINS						0x02
+#endif
 
-// uart 수신 받고 나서 임시 저장하는 변수 -> 정리 대상
-uint8_t sTempStringData[PACKETLIMITELENGTH] = "";
+// Wait update signal -> 5000ms (5초)
+#define APPLICATION_UPDATE_WAITING_TIME_VALU	5000
 
-// Data 패킷 index 저장용 변수
-char sPacketIndex[32] = "";
-// 실제 업데이트 내용 담을 변수
-char sPacketData[PACKETLIMITELENGTH] = "";
+// jump address, image header 바로 뒤의 application vector table
+#define APPLICATION_ADDRESS						(FLASH_USER_START_ADDR + IMAGE_HEADER_SIZE)
 
-// info 패킷으로 받은 패킷 크기 정보 배열 형식
-char sPacketSize[32] = "";
-// info 패킷으로 받은 패킷 개수 정보 배열 형식
-char sPacketCount[32] = "";
+// 그래픽 버퍼, UART 수신 버퍼, 명령어, DATA payload는 CCMRAM arena (arena.h)
 
-// i2C OLED에 표현할 데이터 임시 변수
-char sDisplayLogData[32] ="";
+// payload로 받을 길이 (INFO, RESUME, RAMLOAD, LOADFILE의 패킷 크기), 0이면 payload를 따로 받지 않는다
+volatile int iRxPayloadLength = 0;
+// 지금까지 받은 payload byte 수
+volatile int iRxPayloadIndex = 0;
+// 받은 payload의 XOR, checksum 계산에 사용
+volatile uint8_t iRxPayloadXor = 0;
+// 수신 interrupt 상태
+volatile int iRxState = RX_STATE_HEADER;
 
-// command
-char command[32] = "";
+// Init sequence for SSD1306 OLED module, 화면 크기는 display.h DISPLAY_WIDTH, DISPLAY_HEIGHT
+static const uint8_t sSsd1306InitSequence[] =
+{
+	0xAE,			//display off
+	0xD5, 0x80,		//clock divide, the suggested ratio 0x80
+	0xA8, DISPLAY_HEIGHT - 1,		//multiplex ratio
+	0xD3, 0x00,		//display offset, no offset
+	0x40,			//line #0
+	0x8D, 0x14,		//charge pump, using internal VCC
+	0x20, 0x00,		//memory mode, 0x00 horizontal addressing
+	0xA0 | 0x1,		//rotate screen 180
+	0xC8,			//rotate screen 180
+	0xDA, SSD1306_COM_PINS,		//COM pins
+	0x81, 0xCF,		//contrast
+	0xD9, 0xF1,		//pre-charge
+	0xDB, 0x40,		//VCOMH
+	0xA4,			//display from RAM
+	0xA6,			//normal (not inverted)
+	0xAF,			//switch on OLED
+};
 
 // uart 수신 버퍼 index
 int iUartRxCallbackIndex = 0;
@@ -72,6 +106,14 @@ union uIntegerConvert
 	char uStringData[4];
 };
 
+// static function
+static int fParseInfoPacket(char *sData, int iLength, int *iPacketSize, int *iPacketCount, uint32_t *iImageCrc, int *iHasImageCrc);
+static void fUpdateVectorTableToRam(void);
+static void init_display(void);
+static HAL_StatusTypeDef ssd1306_Submit(uint8_t iControl, const uint8_t *sData, uint16_t iLength);
+static int fTransportSelect(void);
+static int fParseSignaturePacket(char *sData, int iLength, uint8_t *sSignature);
+
 /*
  *  @brief	Bootloader Main Code
  *  @param	None
@@ -107,6 +149,20 @@ int bootcode(void)
 	//수신된 패킷의 순번
 	int iPacketIndex = 0;
 
+	// INFO, RESUME, RAMLOAD, LOADFILE 패킷 분석 결과
+	int iParseResult = 0;
+
+	// journal에 기록 완료된 패킷 수
+	uint32_t iCommittedCount = 0;
+
+	// host가 INFO로 보낸 이미지 CRC와 그 유무
+	uint32_t iImageCrc = 0;
+	int iHasImageCrc = 0;
+	// 기록이 끝난 Flash에서 읽어 계산한 CRC
+	uint32_t iFlashCrc = 0;
+	// 검증 시간 측정 시작 시점
+	uint32_t iStartCycle = 0;
+
 	//write 할 Flash 시작주소와 마지막 주소 
 	int iFlashMemoryAddress = FLASH_USER_START_ADDR;
 	int iFlashMemoryBackupAddress = FLASH_USER_START_ADDR;
@@ -118,42 +174,206 @@ int bootcode(void)
 	//info 패킷 처리여부
 	int iInfopacketFlag = 0;
 
+	// Application 이미지 검증 결과
+	int iImageResult = 0;
+
+	// 화면 초기화 시작 시점, 첫 화면 전송이 끝나면 걸린 시간(us) 보고
+	uint32_t iDisplayStartCycle = 0;
+	int iDisplayReported = 0;
+
+	// DATA 패킷 번호, checksum 처리 시작 시점
+	uint32_t iParseCycle = 0;
+
+	// RAMLOAD로 시작한 RAM load-and-run 여부, 1이면 DATA를 Flash 대신 RAM load 영역에 받는다
+	int iRamLoadFlag = 0;
+	// RAMLOAD를 받은 시점 (ms), 실행할 때 전송에 걸린 시간 보고
+	uint32_t iRamLoadStartTick = 0;
+
+	// LOADFILE로 시작한 ELF/HEX 파일 업데이트 여부, 1이면 DATA payload를 loadflash.c parser에 넘긴다
+	int iLoadFileFlag = 0;
+	// parser에 넘길 다음 패킷 번호
+	int iLoadFileNextIndex = 0;
+	// parser, Flash 기록 결과
+	int iLoadFileResult = 0;
+
+	// DATA를 받으면서 계산한 서명 대상 hash, 중간이 빠졌으면 pImageDigest는 NULL (메모리에서 다시 계산)
+	uint8_t sImageDigest[SHA256_DIGEST_SIZE];
+	const uint8_t *pImageDigest = NULL;
+	// "[SIGNATURE]" 패킷의 서명
+	uint8_t sSignature[IMAGE_SIGNATURE_SIZE];
+
+	// 업데이트 진행 journal 준비
+	fJournalInit();
+
+	// 성능 측정용 cycle counter 시작
+	fPerfInit();
+
+	// stack 최대 사용량 측정 준비 (RAM 사용량 보고)
+	fArenaInit();
+
+	// 기록 검증용 CRC 유닛 준비
+	fCrcInit();
+
+	// 이전 업데이트가 중간에 끊긴 상태면 깨진 Application으로 넘어가지 않고 RESUME을 기다린다
+	if (fJournalIsActive() == 1)
+	{
+		iUpdateStartFlag = 1;
+	}
+
 	//UART 수신 버퍼 index 0으로 초기화
 	iUartRxCallbackIndex = 0;
 	// UART 수신 버퍼 초기화
-	memset(sUART_DMA_ReceiveBuffer,0x00,sizeof(sUART_DMA_ReceiveBuffer));
+	memset(sArena.sReceiveBuffer,0x00,sizeof(sArena.sReceiveBuffer));
 
-	//i2C OLED Display init
+	//i2C OLED 전송 queue 준비 후 Display init
+	iDisplayStartCycle = fPerfStart();
+	fOledQueueInit();
 	init_display();
 
-	//i2C OLED 버퍼 초기화
-	memset(gpubuffer,0x00,sizeof(gpubuffer));
+	//i2C OLED 버퍼 초기화, 처음에는 전체 전송
+	fDisplayClear(sArena.sDisplayBuffer);
 	//i2C OLED 버퍼 (0,0)위치에 "Boot Loader" 표시
-	fDisplayString(0,0,gpubuffer,"Boot Loader");
+	fDisplayString(0,0,sArena.sDisplayBuffer,"Boot Loader");
 	//i2C OLED 버퍼 적용
-	ssd1306_drawingbuffer(gpubuffer);
+	ssd1306_drawingbuffer(sArena.sDisplayBuffer);
+
+	// USART2, USART3 둘 다 수신 interrupt 사용, 처음 올바른 INFO/RESUME/RAMLOAD/LOADFILE이 온 쪽으로 고정
+	fTransportInit();
+	fTransportEnableRx();
 
-	// UART2 수신 interrupt 사용
-	__HAL_UART_ENABLE_IT(&huart2,UART_IT_RXNE);
+	// 대기 phase RAM 사용량 보고
+	fArenaReport(ARENA_PHASE_WAIT);
 
 	// 업데이트 여부 카운트 시작
 	iGlobalTimerStart = 1;
 
 	while (1)
 	{
+		// 초기화 명령과 첫 화면이 모두 전송되면 한번 보고. 100 kHz I2C wire time으로 계산한 추정치는
+		// 명령을 하나씩 보낼 때 init 7.3 ms, 묶어 보내면 2.5 ms이고 실제 값은 이 보고로 확인한다
+		if ((iDisplayReported == 0) && (fOledQueueIsIdle() == 1))
+		{
+			fLog(LOG_DISPLAY_READY, 1, (fOledQueueIdleCycle() - iDisplayStartCycle) / (SystemCoreClock / 1000000));
+			iDisplayReported = 1;
+		}
+
 		//info 패킷에 대해 오류없이 처리하면
 		if (iInfopacketFlag == 1)
 		{
-			printf("[MCU]INFO,ACK\r\n");
+			fLog(LOG_INFO_ACK, 0);
 			z++;
 			iInfopacketFlag = 0;
 		}
 
+		// RAM load 완료되면 Flash는 그대로 두고 받은 이미지를 검증해 바로 실행
+		if ((z == -1) && (iRamLoadFlag == 1))
+		{
+			iFlashCrc = fCrcCalculate(RAMLOAD_ADDRESS, iPacketSize * iPacketCount);
+			iImageResult = -2;
+			if ((iHasImageCrc == 0) || (iFlashCrc == iImageCrc))
+			{
+				// hash는 받으면서 계산했으므로 서명 검증만 남는다
+				pImageDigest = (fImageHashFinish(&sArena.uPhase.sImageHash, sImageDigest) == 0) ? sImageDigest : NULL;
+				iImageResult = fImageValidateDigest(RAMLOAD_ADDRESS, fRamLoadSize(), pImageDigest);
+			}
+			if (iImageResult == 0)
+			{
+				fLog(LOG_END_ACK, 1, iFlashCrc);
+				fLog(LOG_RAMLOAD_RUN, 2, fImageGetEntryPoint(RAMLOAD_ADDRESS), HAL_GetTick() - iRamLoadStartTick);
+				jump_to_application(fImageGetEntryPoint(RAMLOAD_ADDRESS));
+			}
+
+			// 받은 내용이 다르거나 실행할 수 없는 이미지면 RAMLOAD부터 다시 받는다
+			fLog(LOG_END_NACK, 1, iFlashCrc);
+			fLog(LOG_IMAGE_INVALID, 1, iImageResult);
+			z = 1;
+		}
+
+		// 파일 업데이트 완료되면 남은 data 기록, image header 작성
+		if ((z == -1) && (iLoadFileFlag == 1))
+		{
+			iStartCycle = fPerfStart();
+			iLoadFileResult = fLoadFlashFinish(iHasImageCrc, iImageCrc, &iFlashCrc);
+			fPerfStop(PERF_FLASH_VERIFY, iStartCycle, fLoadFlashImageLength());
+			fFlashSessionEnd();
+			iLoadFileFlag = 0;
+
+			if (iLoadFileResult == LOADFILE_OK)
+			{
+				// header는 bootloader가 만들었으므로 서명은 기록이 끝난 Flash에서 hash를 계산해 확인한다
+				iImageResult = fImageValidate(FLASH_USER_START_ADDR, FLASH_USER_END_ADDR - FLASH_USER_START_ADDR + 1);
+				if (iImageResult == 0)
+				{
+					fVectorTableRestore();
+					fLog(LOG_END_ACK, 1, iFlashCrc);
+					fPerfReport();
+					fFlashReport();
+					fArenaReport(ARENA_PHASE_UPDATE);
+					NVIC_SystemReset();
+				}
+				fLog(LOG_END_NACK, 1, iFlashCrc);
+				fLog(LOG_IMAGE_INVALID, 1, iImageResult);
+			}
+			else
+			{
+				// 파일이 덜 왔거나 CRC가 다르면 리셋하지 않고 처음 명령부터 다시 받는다
+				fLog(LOG_END_NACK, 1, iFlashCrc);
+				fLog(LOG_LOADFILE_ERROR, 2, iLoadFileResult, fLoadFlashErrorAddress());
+			}
+			fPerfReport();
+			fFlashReport();
+			iRxPayloadLength = 0;
+			z = 1;
+		}
+
 		//update 완료되면
 		if (z == -1)
 		{
-			printf("[MCU]END,ACK\r\n");
-			NVIC_SystemReset();
+			fFlashSessionEnd();
+
+			// 기록된 영역을 Flash에서 다시 읽어 CRC 계산
+			iStartCycle = fPerfStart();
+			iFlashCrc = 0;
+			if (fPartitionContains(PARTITION_APPLICATION, FLASH_USER_START_ADDR, iPacketSize * iPacketCount) == 1)
+			{
+				iFlashCrc = fCrcCalculate(FLASH_USER_START_ADDR, iPacketSize * iPacketCount);
+			}
+			fPerfStop(PERF_FLASH_VERIFY, iStartCycle, iPacketSize * iPacketCount);
+
+			// host가 보낸 CRC가 없으면 계산 값만 알려준다
+			iImageResult = -2;
+			if ((iHasImageCrc == 0) || (iFlashCrc == iImageCrc))
+			{
+				// 리셋 전에 이미지와 서명을 확인해 cache에 남긴다. hash는 받으면서 계산했으므로 서명 검증만 남고
+				// RESUME으로 이어 받았으면 Flash에서 다시 계산한다
+				pImageDigest = (fImageHashFinish(&sArena.uPhase.sImageHash, sImageDigest) == 0) ? sImageDigest : NULL;
+				iImageResult = fImageValidateDigest(FLASH_USER_START_ADDR, FLASH_USER_END_ADDR - FLASH_USER_START_ADDR + 1, pImageDigest);
+			}
+
+			if (iImageResult == 0)
+			{
+				// 업데이트 완료, journal 무효화
+				fJournalClear();
+				fVectorTableRestore();
+				fLog(LOG_END_ACK, 1, iFlashCrc);
+				fPerfReport();
+				fFlashReport();
+				fArenaReport(ARENA_PHASE_UPDATE);
+				NVIC_SystemReset();
+			}
+			else
+			{
+				// 기록된 내용이 다르거나 서명이 맞지 않으면 리셋하지 않고 INFO부터 다시 받는다
+				fLog(LOG_END_NACK, 1, iFlashCrc);
+				if ((iHasImageCrc == 0) || (iFlashCrc == iImageCrc))
+				{
+					fLog(LOG_IMAGE_INVALID, 1, iImageResult);
+				}
+				fPerfReport();
+				fFlashReport();
+				fArenaReport(ARENA_PHASE_UPDATE);
+				z = 1;
+			}
 		}
 
 		// waiting이 5초가 안되고 업데이트 시작 플래그가 1이면 처리
@@ -162,15 +382,22 @@ int bootcode(void)
 			// 서버에 업로드 준비 완료 메세지 0.5초 간격으로 전송. 전송 간격 도중에 업데이트 시작되면 자동 차단
 			if (z == 0)
 			{
-				printf("[MCU]READY,ACK\r\n");
-				HAL_Delay(500);
+				fLog(LOG_READY_ACK, 0);
+				// 대기하는 동안 sync byte로 채널 baud rate를 맞춘다
+				fTransportAutoBaud(500);
+			}
+
+			// 채널이 정해지기 전이면 각 채널에 들어온 줄 중 올바른 INFO/RESUME/RAMLOAD/LOADFILE을 찾는다
+			if (fTransportActive() == TRANSPORT_NONE)
+			{
+				fTransportSelect();
 			}
 
-			//패킷 검사 상위바이트 -> 하위바이트 검색
-			for (x = PACKETLIMITELENGTH; x > 0; x--)
+			//패킷 검사 상위바이트 -> 하위바이트 검색. [x - 1], [x]를 같이 보므로 마지막 byte부터 시작
+			for (x = PACKETLIMITELENGTH - 1; x > 0; x--)
 			{
 				// "\r\n"이 연속으로 최초 검출 되면 메세지 날라온걸로 판별
-				if ((sUART_DMA_ReceiveBuffer[x - 1] == '\r') && (sUART_DMA_ReceiveBuffer[x] == '\n'))
+				if ((sArena.sReceiveBuffer[x - 1] == '\r') && (sArena.sReceiveBuffer[x] == '\n'))
 				{
 					//명령어 마지막 부분 index 초기화
 					iCommandEndIndex = 0;
@@ -178,92 +405,248 @@ int bootcode(void)
 					iPaketEndIndex = x;
 
 					// 명령어 버퍼 초기화
-					memset(command, 0x00, sizeof(command));
+					memset(sArena.sCommand, 0x00, sizeof(sArena.sCommand));
 
 					// 명령어 분류 하기 위해 명령어 마지막 부분 찾기
 					for (i = 0; i < x; i++)
 					{
-						if (sUART_DMA_ReceiveBuffer[i] == ']')
+						if (sArena.sReceiveBuffer[i] == ']')
 						{
 							//명령어 마지막 부분 index 잡고
 							iCommandEndIndex = i;
 							for (y = 0; y < iCommandEndIndex - 1; y++)
 							{
-								command[y] = sUART_DMA_ReceiveBuffer[y + 1];
+								sArena.sCommand[y] = sArena.sReceiveBuffer[y + 1];
 							}
 							i = x + 1;
 						}
 					}
 
 					// 명령어 구별
-					if (fCompareFunction(command, "INFO", 4) == 0)
+					if (fCompareFunction(sArena.sCommand, "INFO", 4) == 0)
 					{
 						// update 시작
 						iUpdateStartFlag = 1;
 
-						// Application 영역 포맷
-						app_Partition_erase();
+						// 패킷 크기, 개수, checksum 확인. 처리가 끝날 때까지 버퍼를 지우지 않으므로 수신 버퍼에서 바로 읽는다
+						iParseResult = fParseInfoPacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1), &iPacketSize, &iPacketCount, &iImageCrc, &iHasImageCrc);
+						if (iParseResult != -2)
+						{
+							//패킷 crc와 계산한 crc 비교. 잘못된 INFO는 Application과 journal을 그대로 둔다
+							if (iParseResult == 0)
+							{
+								// Flash erase 중에도 UART 수신이 멈추지 않도록 SRAM vector table 사용
+								fUpdateVectorTableToRam();
 
-						//command 부분을 제외한 부분을 임시 버퍼로 복사
-						memset(sTempStringData, 0x00, sizeof(sTempStringData));
-						memcpy(sTempStringData, sUART_DMA_ReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1));
+								// erase 도중 리셋되어도 지워진 영역에 RESUME하지 않도록 journal을 먼저 지운다
+								fJournalClear();
 
-						// ','부분 개수 파악 변수 초기화
-						iCommaIndex_index = 0;
+								// Application 영역 포맷
+								app_Partition_erase();
 
-						// ','위치 파악, info에서는 ','가 2개 오는데 가운데 데이터에 숫자형태 외 들어올 
-						//데이터가 없기 때문에 순차적으로 찾는다
-						for (y = 0; y < iPaketEndIndex - (iCommandEndIndex + 1); y++)
+								iInfopacketFlag = 1;
+								iRamLoadFlag = 0;
+								iLoadFileFlag = 0;
+								iRxPayloadLength = iPacketSize;
+
+								// 처음부터 기록
+								iFlashMemoryAddress = FLASH_USER_START_ADDR;
+								fJournalStart(iPacketSize, iPacketCount, iHasImageCrc, iImageCrc);
+								fImageHashStart(&sArena.uPhase.sImageHash);
+
+								// 세션 동안 Flash unlock 유지
+								fFlashSessionBegin();
+								// 측정 값 초기화, 명령 줄을 받는 동안의 수신 cycle은 버린다
+								fPerfReset();
+								fTransportTakeRxCycles();
+
+								// 진행 표시 시작
+								fProgressStart(iPacketSize, iPacketCount, 0, HAL_GetTick());
+								fProgressDraw(sArena.sDisplayBuffer);
+							}
+							else
+							{
+								iInfopacketFlag = 0;
+							}
+
+							//UART 수신 버퍼 초기화
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+							iUartRxCallbackIndex = 0;
+
+							// UART 수신 인터럽트 시작
+							fTransportEnableRx();
+						}
+					}
+					else if (fCompareFunction(sArena.sCommand, "RESUME", 6) == 0)
+					{
+						// INFO와 같은 형식. 패킷 크기, 개수, 이미지 CRC가 journal과 같으면 지우지 않고 이어서 받는다
+						iParseResult = fParseInfoPacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1), &iPacketSize, &iPacketCount, &iImageCrc, &iHasImageCrc);
+						if (iParseResult != -2)
 						{
-							if (sTempStringData[y] == ',')
+							if ((iParseResult == 0) && (fJournalResume(iPacketSize, iPacketCount, iHasImageCrc, iImageCrc, &iCommittedCount) == 0))
 							{
-								iCommaIndex[iCommaIndex_index] = y;
-								iCommaIndex_index++;
+								// update 이어서 진행
+								iUpdateStartFlag = 1;
+								iRamLoadFlag = 0;
+								iLoadFileFlag = 0;
+								iRxPayloadLength = iPacketSize;
+								z = 1;
+								fUpdateVectorTableToRam();
+
+								// 기록 안된 첫 패킷 위치부터 다시 기록
+								iFlashMemoryAddress = FLASH_USER_START_ADDR + (iCommittedCount * iPacketSize);
+
+								// 앞부분은 이미 기록되어 있어 hash가 이어지지 않는다. END에서 Flash로 다시 계산
+								fImageHashStart(&sArena.uPhase.sImageHash);
+
+								// 세션 동안 Flash unlock 유지
+								fFlashSessionBegin();
+
+								// 진행 표시는 이미 기록된 패킷부터 이어서
+								fProgressStart(iPacketSize, iPacketCount, iCommittedCount, HAL_GetTick());
+								fProgressDraw(sArena.sDisplayBuffer);
+
+								// 다음에 보낼 패킷 번호와 Application 영역 기준 offset 전달
+								fLog(LOG_RESUME_ACK, 2, iCommittedCount + 1, iCommittedCount * iPacketSize);
+							}
+							else
+							{
+								// 이어 받을 수 없으면 host가 INFO부터 다시 보낸다
+								fLog(LOG_RESUME_NACK, 0);
 							}
+
+							//UART 수신 버퍼 초기화
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+							iUartRxCallbackIndex = 0;
+
+							// UART 수신 인터럽트 시작
+							fTransportEnableRx();
 						}
-						// ','가 2개 검출된게 맞다면
-						if (iCommaIndex_index == 2)
+					}
+					else if (fCompareFunction(sArena.sCommand, "RAMLOAD", 7) == 0)
+					{
+						// INFO와 같은 형식. Flash는 지우지 않고 DATA를 RAM load 영역에 받아 END에서 바로 실행한다
+						iParseResult = fParseInfoPacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1), &iPacketSize, &iPacketCount, &iImageCrc, &iHasImageCrc);
+						if (iParseResult != -2)
 						{
-							// 패킷 크기와 개수 받을 배열 변수
-							memset(sPacketSize, 0x00, sizeof(sPacketSize));
-							memset(sPacketCount, 0x00, sizeof(sPacketCount));
+							// 이미지 전체가 RAM load 영역에 들어가야 한다
+							if ((iParseResult == 0) && (iPacketCount > 0) && (fRamLoadContains(RAMLOAD_ADDRESS, (uint32_t)iPacketSize * iPacketCount) == 1))
+							{
+								iUpdateStartFlag = 1;
+								iRamLoadFlag = 1;
+								iLoadFileFlag = 0;
+								iRamLoadStartTick = HAL_GetTick();
+								iRxPayloadLength = iPacketSize;
+								z = 1;
+
+								// RAM load 영역 처음부터 기록
+								iFlashMemoryAddress = RAMLOAD_ADDRESS;
+								fImageHashStart(&sArena.uPhase.sImageHash);
+								// 측정 값 초기화, 명령 줄을 받는 동안의 수신 cycle은 버린다
+								fPerfReset();
+								fTransportTakeRxCycles();
+
+								// 진행 표시 시작
+								fProgressStart(iPacketSize, iPacketCount, 0, HAL_GetTick());
+								fProgressDraw(sArena.sDisplayBuffer);
+
+								// 받을 수 있는 최대 크기도 같이 알려준다
+								fLog(LOG_RAMLOAD_ACK, 1, fRamLoadSize());
+							}
+							else
+							{
+								fLog(LOG_RAMLOAD_NACK, 1, fRamLoadSize());
+							}
 
-							// 패킷 크기
-							memcpy(sPacketSize, sTempStringData, iCommaIndex[0]);
+							//UART 수신 버퍼 초기화
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+							iUartRxCallbackIndex = 0;
 
-							// 패킷 개수
-							memcpy(sPacketCount, sTempStringData + (iCommaIndex[0] + 1), (iCommaIndex[1] - (iCommaIndex[0] + 1)));
+							// UART 수신 인터럽트 시작
+							fTransportEnableRx();
+						}
+					}
+					else if (fCompareFunction(sArena.sCommand, "LOADFILE", 8) == 0)
+					{
+						// INFO와 같은 형식. DATA payload는 ELF 또는 Intel HEX 파일을 나눈 것이고 segment마다 제 주소에 기록한다.
+						// 이미지 CRC는 header 뒤부터 빈 곳을 0xFF로 채운 이미지 기준
+						iParseResult = fParseInfoPacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1), &iPacketSize, &iPacketCount, &iImageCrc, &iHasImageCrc);
+						if (iParseResult != -2)
+						{
+							if ((iParseResult == 0) && (iPacketCount > 0))
+							{
+								iUpdateStartFlag = 1;
+								iRamLoadFlag = 0;
+								iRxPayloadLength = iPacketSize;
+								z = 1;
+
+								// 필요한 sector만 지우면서 기록하므로 erase 중 수신용 SRAM vector table 사용
+								fUpdateVectorTableToRam();
+
+								// 이전 INFO 업데이트 journal은 더 이상 맞지 않는다
+								fJournalClear();
+
+								// 세션 동안 Flash unlock 유지, image header sector를 먼저 지운다
+								fFlashSessionBegin();
+								// 측정 값 초기화, 명령 줄을 받는 동안의 수신 cycle은 버린다
+								fPerfReset();
+								fTransportTakeRxCycles();
+								iLoadFileResult = fLoadFlashStart();
+							}
+							else
+							{
+								iLoadFileResult = LOADFILE_ERROR_FORMAT;
+							}
 
-							// 패킷에 있던 Checksum
-							crc_xor = sTempStringData[iCommaIndex[1] + 1];
+							if (iLoadFileResult == LOADFILE_OK)
+							{
+								iLoadFileFlag = 1;
+								iLoadFileNextIndex = 1;
 
-							//패킷 크기 와 개수 배열변수 데이터를 정수형으로 변환
-							iPacketSize = fConvertStringToInt32(sPacketSize);
-							iPacketCount = fConvertStringToInt32(sPacketCount);
+								// 진행 표시 시작
+								fProgressStart(iPacketSize, iPacketCount, 0, HAL_GetTick());
+								fProgressDraw(sArena.sDisplayBuffer);
+								fLog(LOG_LOADFILE_ACK, 0);
+							}
+							else
+							{
+								iLoadFileFlag = 0;
+								fLog(LOG_LOADFILE_NACK, 0);
+							}
 
-							// 패킷 데이터 Checksum
-							memcpy(sTempStringData, sTempStringData, (iCommaIndex[1]));
-							crc_xor_calres = crc_xor_calculation(sTempStringData, (iCommaIndex[1]));
+							//UART 수신 버퍼 초기화
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+							iUartRxCallbackIndex = 0;
 
-							//패킷 crc와 계산한 crc 비교
-							if (crc_xor_calres == crc_xor)
+							// UART 수신 인터럽트 시작
+							fTransportEnableRx();
+						}
+					}
+					else if (fCompareFunction(sArena.sCommand, "SIGNATURE", 9) == 0)
+					{
+						// LOADFILE 이미지 서명, 마지막 DATA 전에 보낸다. INFO, RAMLOAD 이미지는 header에 서명이 들어 있다
+						iParseResult = fParseSignaturePacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), iPaketEndIndex - (iCommandEndIndex + 1), sSignature);
+						if (iParseResult != -2)
+						{
+							if ((iParseResult == 0) && (iLoadFileFlag == 1))
 							{
-								iInfopacketFlag = 1;
+								fLoadFlashSetSignature(sSignature);
+								fLog(LOG_SIGNATURE_ACK, 0);
 							}
 							else
 							{
-								iInfopacketFlag = 0;
+								fLog(LOG_SIGNATURE_NACK, 0);
 							}
 
 							//UART 수신 버퍼 초기화
-							memset(sUART_DMA_ReceiveBuffer, 0x00, sizeof(sUART_DMA_ReceiveBuffer));
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
 							iUartRxCallbackIndex = 0;
 
 							// UART 수신 인터럽트 시작
-							__HAL_UART_ENABLE_IT(&huart2, UART_IT_RXNE);
+							fTransportEnableRx();
 						}
 					}
-					else if (fCompareFunction(command, "DATA", 4) == 0)
+					else if (fCompareFunction(sArena.sCommand, "DATA", 4) == 0)
 					{
 						//현재 기록할 Flash Address 백업
 						iFlashMemoryBackupAddress = iFlashMemoryAddress;
@@ -275,7 +658,7 @@ int bootcode(void)
 						//배열까지 순차적 검색
 						for (y = 0; y < iPaketEndIndex; y++)
 						{
-							if (sUART_DMA_ReceiveBuffer[y] == 0x2c)
+							if (sArena.sReceiveBuffer[y] == 0x2c)
 							{
 								iCommaIndex[0] = y;
 								y = PACKETLIMITELENGTH;
@@ -288,7 +671,7 @@ int bootcode(void)
 						// \r,\n,CRC 구역을 제외하고 검색한다
 						for (y = iPaketEndIndex - 3; y > 0; y--)
 						{
-							if (sUART_DMA_ReceiveBuffer[y] == 0x2c)
+							if (sArena.sReceiveBuffer[y] == 0x2c)
 							{
 								iCommaIndex[1] = y;
 								y = -1;
@@ -296,20 +679,23 @@ int bootcode(void)
 							}
 						}
 
-						// 데이터 패킷도 ','가 2개 나와야 처리 한다
-						if (iCommaIndex_index == 2)
+						// 데이터 패킷도 ','가 2개 나와야 처리 한다. payload는 수신 interrupt가 sPacketPayload에 받아
+						// 수신 버퍼에는 "[DATA]번호,,checksum\r\n"만 남는다
+						if ((iCommaIndex_index == 2) && (iRxState == RX_STATE_TRAILER))
 						{
-							// 패킷에 있는 현재 데이터 패킷 번호 문자열
-							memcpy(sPacketIndex, sUART_DMA_ReceiveBuffer + iCommandEndIndex + 1, iCommaIndex[0]);
-
-							// 패킷 데이터
-							memcpy(sPacketData, sUART_DMA_ReceiveBuffer + (iCommaIndex[0] + 1 + iCommandEndIndex), (iCommaIndex[1] - (iCommaIndex[0] + 1)));
+							iParseCycle = fPerfStart();
 
 							// 패킷에 있는 Checksum
-							crc_xor = sUART_DMA_ReceiveBuffer[iCommaIndex[1] + 1];
+							crc_xor = sArena.sReceiveBuffer[iCommaIndex[1] + 1];
 
-							// 현재 데이터 패킷 번호 문자열을 정수로 변환
-							iPacketIndex = fConvertStringToInt32(sPacketIndex);
+							// 현재 데이터 패킷 번호 문자열을 정수로 변환, ','에서 멈추므로 수신 버퍼에서 바로 읽는다
+							iPacketIndex = fConvertStringToInt32((char *)sArena.sReceiveBuffer + iCommandEndIndex + 1);
+
+							// "번호," 부분과 interrupt에서 계산해 둔 payload XOR로 전체 Checksum 계산
+							crc_xor_calres = crc_xor_calculation((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), (iCommaIndex[1] - (iCommandEndIndex + 1))) ^ iRxPayloadXor;
+							fPerfStop(PERF_PACKET_PARSE, iParseCycle, iPacketSize);
+							// 이 패킷을 받는 동안 수신 interrupt가 쓴 cycle, 위 PACKET_PARSE와 더하면 수신 경로 전체
+							fPerfAdd(PERF_PACKET_RECEIVE, fTransportTakeRxCycles(), iPacketSize);
 
 							//패킷 크기만큼 Falsh Address 증가
 							for (z = 0; z < iPacketSize; z++)
@@ -317,28 +703,82 @@ int bootcode(void)
 								iFlashMemoryAddress++;
 							}
 
-							// 패킷에 있던 데이터 Flash에 저장
-							res = flash_wrtie(iFlashMemoryBackupAddress, iFlashMemoryAddress, sUART_DMA_ReceiveBuffer + (iCommaIndex[0] + 1));
+							// checksum이 맞는 payload만 payload 버퍼에서 바로 Flash에 저장, RAM load면 RAM load 영역에 복사.
+							// NACK한 payload가 남아 재전송분과 AND되면 기록된 내용과 hash (fImageHashFeed)가 달라진다
+							res = HAL_OK;
+							if (crc_xor_calres == crc_xor)
+							{
+								if (iRamLoadFlag == 1)
+								{
+									res = fRamLoadWrite(iFlashMemoryBackupAddress, sArena.uPhase.sPacketPayload, iPacketSize);
+								}
+								// 파일은 아래에서 parser에 넘긴다
+								else if (iLoadFileFlag == 0)
+								{
+									res = flash_wrtie(iFlashMemoryBackupAddress, iFlashMemoryAddress, sArena.uPhase.sPacketPayload);
+								}
+							}
 							if (res != 0)
 							{
-								//Flash 쓰기 에러
-								printf("flash_wrtie Err\r\n");
+								//Flash 쓰기 에러. 일부만 기록되었을 수 있으므로 END에서 메모리로 hash를 다시 계산한다
+								fLog(LOG_FLASH_WRITE_ERROR, 0);
+								fImageHashDiscard(&sArena.uPhase.sImageHash);
 							}
 
-							// 전체 데이터 기반으로 Checksum 계산
-							crc_xor_calres = crc_xor_calculation(sUART_DMA_ReceiveBuffer + (iCommandEndIndex + 1), (iCommaIndex[1] - (iCommandEndIndex + 1)));
-
 							//UART 수신 버퍼 초기화
-							memset(sUART_DMA_ReceiveBuffer, 0x00, sizeof(sUART_DMA_ReceiveBuffer));
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
 							iUartRxCallbackIndex = 0;
 
 							// UART 수신 인터럽트 활성
-							__HAL_UART_ENABLE_IT(&huart2, UART_IT_RXNE);
+							fTransportEnableRx();
 
-							// Chaecksum이 같다면
-							if (crc_xor_calres == crc_xor)
+							// 파일은 parser 상태를 되돌릴 수 없으므로 checksum이 맞는 패킷을 순서대로 한번씩만 넘긴다.
+							// ACK를 놓쳐 다시 온 패킷은 ACK만 다시 보낸다
+							iLoadFileResult = LOADFILE_OK;
+							if ((iLoadFileFlag == 1) && (crc_xor_calres == crc_xor))
+							{
+								if (iPacketIndex == iLoadFileNextIndex)
+								{
+									iLoadFileResult = fLoadFlashFeed((const uint8_t *)sArena.uPhase.sPacketPayload, iPacketSize);
+									iLoadFileNextIndex++;
+								}
+								else if (iPacketIndex > iLoadFileNextIndex)
+								{
+									iLoadFileResult = LOADFILE_ERROR_SEQUENCE;
+								}
+							}
+
+							if (iLoadFileResult != LOADFILE_OK)
 							{
-								printf("[MCU]DATA,ACK\r\n");
+								// 형식, 주소가 잘못된 파일은 더 받지 않는다. host는 처음 명령부터 다시 보낸다
+								fLog(LOG_LOADFILE_ERROR, 2, iLoadFileResult, fLoadFlashErrorAddress());
+								fFlashSessionEnd();
+								iLoadFileFlag = 0;
+								iRxPayloadLength = 0;
+							}
+							// Chaecksum이 같고 기록도 되었다면
+							else if ((crc_xor_calres == crc_xor) && (res == HAL_OK))
+							{
+								fLog(LOG_DATA_ACK, 0);
+
+								// 기록 완료된 패킷 journal에 반영. RAM load는 리셋하면 사라지고 파일은 이어 받을 수 없으므로 기록하지 않는다
+								if ((iRamLoadFlag == 0) && (iLoadFileFlag == 0))
+								{
+									fJournalCommit(iPacketIndex);
+								}
+
+								// 받은 이미지 그대로 서명 대상 hash 계산, END에서는 서명 검증만 남는다
+								if (iLoadFileFlag == 0)
+								{
+									fImageHashFeed(&sArena.uPhase.sImageHash, iFlashMemoryBackupAddress - ((iRamLoadFlag == 1) ? RAMLOAD_ADDRESS : FLASH_USER_START_ADDR),
+										(const uint8_t *)sArena.uPhase.sPacketPayload, iPacketSize);
+								}
+
+								// 진행 표시는 정해진 간격마다만 다시 그린다. 전송은 아래 ssd1306_drawingbuffer가 바뀐 부분만
+								if (fProgressUpdate(iPacketIndex, HAL_GetTick()) == 1)
+								{
+									fProgressDraw(sArena.sDisplayBuffer);
+								}
 
 								// 마지막 패킷이면
 								if (iPacketIndex >= iPacketCount)
@@ -346,28 +786,228 @@ int bootcode(void)
 									z = -1;
 								}
 							}
-							//checksum이 다르면
+							//checksum이 다르거나 기록에 실패하면
 							else
 							{
 								//시작 주소로 롤백
 								iFlashMemoryAddress = iFlashMemoryBackupAddress;
-								printf("[MCU]DATA,NACK\r\n");
+								fLog(LOG_DATA_NACK, 0);
 							}
 						}
+						else
+						{
+							// INFO 전에 온 DATA처럼 payload를 따로 받지 않은 패킷은 버린다
+							memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+							iUartRxCallbackIndex = 0;
+							fTransportEnableRx();
+							fLog(LOG_DATA_NACK, 0);
+						}
 					}
 				}
 			}
-			HAL_Delay(75);
+			// 다 보내지 못한 화면 변경분 이어서 전송
+			ssd1306_drawingbuffer(sArena.sDisplayBuffer);
+
+			// RAM load 중에는 다음 DATA를 바로 처리하도록 쉬지 않는다 (전송 시간만 걸리도록)
+			if (iRamLoadFlag == 0)
+			{
+				HAL_Delay(75);
+			}
+		}
+		else
+		{
+			// header와 이미지 CRC가 맞을 때만 application으로 넘어간다
+			iImageResult = fImageValidate(FLASH_USER_START_ADDR, FLASH_USER_END_ADDR - FLASH_USER_START_ADDR + 1);
+			if (iImageResult == 0)
+			{
+				// jump to application
+				jump_to_application(fImageGetEntryPoint(FLASH_USER_START_ADDR));
+			}
+
+			// 깨진 이미지로 넘어가지 않고 업데이트를 기다린다
+			fLog(LOG_IMAGE_INVALID, 1, iImageResult);
+			iUpdateStartFlag = 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ *  @brief	INFO, RESUME, RAMLOAD, LOADFILE 패킷의 "패킷크기,패킷개수[,이미지CRC],checksum\r" 부분 분석.
+ *			이미지 CRC는 16진수 문자열이며 없어도 된다
+ *  @param	sData			command 부분을 제외한 패킷 시작 주소
+ *			iLength			sData 길이 ('\r' 포함)
+ *			iPacketSize		패킷 크기를 돌려 줄 변수 주소
+ *			iPacketCount	패킷 개수를 돌려 줄 변수 주소
+ *			iImageCrc		이미지 CRC를 돌려 줄 변수 주소
+ *			iHasImageCrc	이미지 CRC가 있으면 1, 없으면 0을 돌려 줄 변수 주소
+ *  @retval	0은 성공, -1은 checksum 불일치, -2는 형식 오류
+ */
+static int fParseInfoPacket(char *sData, int iLength, int *iPacketSize, int *iPacketCount, uint32_t *iImageCrc, int *iHasImageCrc)
+{
+	// ','개수와 위치
+	int iCommaIndex_index = 0;
+	int iCommaIndex[3] = {0x00,};
+	// checksum 앞 ','위치, checksum 문자 자체가 ','일 수 있으므로 위치로 구한다
+	int iChecksumCommaIndex = iLength - 3;
+
+	if ((iChecksumCommaIndex <= 0) || (sData[iChecksumCommaIndex] != ','))
+	{
+		return -2;
+	}
+
+	// checksum 앞부분에서 ','위치 파악, 숫자형태 외 들어올 데이터가 없기 때문에 순차적으로 찾는다
+	for (int y = 0; y < iChecksumCommaIndex; y++)
+	{
+		if (sData[y] == ',')
+		{
+			if (iCommaIndex_index < 2)
+			{
+				iCommaIndex[iCommaIndex_index] = y;
+			}
+			iCommaIndex_index++;
+		}
+	}
+	iCommaIndex[iCommaIndex_index < 3 ? iCommaIndex_index : 2] = iChecksumCommaIndex;
+
+	// 필드는 2개 (크기, 개수) 또는 3개 (크기, 개수, 이미지 CRC)
+	if ((iCommaIndex_index != 1) && (iCommaIndex_index != 2))
+	{
+		return -2;
+	}
+
+	//패킷 크기 와 개수를 정수형으로 변환, 숫자가 아닌 ','에서 멈추므로 복사하지 않고 바로 읽는다
+	*iPacketSize = fConvertStringToInt32(sData);
+	*iPacketCount = fConvertStringToInt32(sData + (iCommaIndex[0] + 1));
+
+	// 이미지 CRC
+	*iHasImageCrc = 0;
+	if (iCommaIndex_index == 2)
+	{
+		*iImageCrc = fConvertHexStringToUInt32(sData + (iCommaIndex[1] + 1));
+		*iHasImageCrc = 1;
+	}
+
+	//패킷 crc와 계산한 crc 비교
+	if (crc_xor_calculation(sData, iChecksumCommaIndex) != sData[iChecksumCommaIndex + 1])
+	{
+		return -1;
+	}
+
+	// payload는 PACKET_PAYLOAD_MAX 크기 버퍼에 받는다
+	if ((*iPacketSize <= 0) || (*iPacketSize > PACKET_PAYLOAD_MAX))
+	{
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ *  @brief	SIGNATURE 패킷의 "서명 128자리 16진수,checksum\r" 부분 분석
+ *  @param	sData		command 부분을 제외한 패킷 시작 주소
+ *			iLength		sData 길이 ('\r' 포함)
+ *			sSignature	서명 64 Byte를 돌려 줄 버퍼
+ *  @retval	0은 성공, -1은 checksum 불일치, -2는 형식 오류
+ */
+static int fParseSignaturePacket(char *sData, int iLength, uint8_t *sSignature)
+{
+	// checksum 앞 ','위치, checksum 문자 자체가 ','일 수 있으므로 위치로 구한다
+	int iChecksumCommaIndex = iLength - 3;
+	uint8_t iNibble;
+
+	if ((iChecksumCommaIndex != IMAGE_SIGNATURE_SIZE * 2) || (sData[iChecksumCommaIndex] != ','))
+	{
+		return -2;
+	}
+
+	for (int i = 0; i < IMAGE_SIGNATURE_SIZE * 2; i++)
+	{
+		if ((sData[i] >= '0') && (sData[i] <= '9'))
+		{
+			iNibble = (uint8_t)(sData[i] - '0');
+		}
+		else if ((sData[i] >= 'A') && (sData[i] <= 'F'))
+		{
+			iNibble = (uint8_t)(sData[i] - 'A' + 10);
+		}
+		else if ((sData[i] >= 'a') && (sData[i] <= 'f'))
+		{
+			iNibble = (uint8_t)(sData[i] - 'a' + 10);
 		}
 		else
 		{
-			// jump to application
-			jump_to_application(FLASH_USER_START_ADDR);
+			return -2;
 		}
+		sSignature[i / 2] = (uint8_t)((i % 2 == 0) ? (iNibble << 4) : (sSignature[i / 2] | iNibble));
+	}
+
+	//패킷 crc와 계산한 crc 비교
+	if (crc_xor_calculation(sData, iChecksumCommaIndex) != sData[iChecksumCommaIndex + 1])
+	{
+		return -1;
 	}
 	return 0;
 }
 
+/*
+ *  @brief	채널 고정 전, 채널에 들어온 줄이 checksum까지 맞는 INFO, RESUME, RAMLOAD 또는 LOADFILE이면 그 채널로 고정하고
+ *			줄을 UART 수신 버퍼로 넘긴다. 처리는 이후 main loop의 명령어 구별 부분이 그대로 한다
+ *  @param	None
+ *  @retval	고정한 채널 번호, 고정하지 않았으면 TRANSPORT_NONE
+ */
+static int fTransportSelect(void)
+{
+	int iChannel;
+	int iLength = 0;
+	int iCommandEndIndex;
+	int iPacketSize, iPacketCount, iHasImageCrc;
+	uint32_t iImageCrc;
+
+	// 고정 전에는 수신 버퍼에 쓰는 interrupt가 없으므로 줄을 바로 수신 버퍼로 가져온다
+	iChannel = fTransportTakeLine(sArena.sReceiveBuffer, sizeof(sArena.sReceiveBuffer), &iLength);
+	if (iChannel == TRANSPORT_NONE)
+	{
+		return TRANSPORT_NONE;
+	}
+
+	// 명령어 마지막 ']' 위치
+	if (fCompareFunction((char *)sArena.sReceiveBuffer, "[INFO]", 6) == 0)
+	{
+		iCommandEndIndex = 5;
+	}
+	else if (fCompareFunction((char *)sArena.sReceiveBuffer, "[RESUME]", 8) == 0)
+	{
+		iCommandEndIndex = 7;
+	}
+	else if (fCompareFunction((char *)sArena.sReceiveBuffer, "[RAMLOAD]", 9) == 0)
+	{
+		iCommandEndIndex = 8;
+	}
+	else if (fCompareFunction((char *)sArena.sReceiveBuffer, "[LOADFILE]", 10) == 0)
+	{
+		iCommandEndIndex = 9;
+	}
+	else
+	{
+		iCommandEndIndex = -1;
+	}
+
+	// main loop와 같이 ']' 다음부터 '\n' 앞까지 ('\r' 포함) 검사
+	if ((iCommandEndIndex < 0) || (iLength < iCommandEndIndex + 4)
+		|| (fParseInfoPacket((char *)sArena.sReceiveBuffer + (iCommandEndIndex + 1), (iLength - 1) - (iCommandEndIndex + 1), &iPacketSize, &iPacketCount, &iImageCrc, &iHasImageCrc) != 0))
+	{
+		// main loop가 처리하지 않도록 지운다
+		memset(sArena.sReceiveBuffer, 0x00, sizeof(sArena.sReceiveBuffer));
+		return TRANSPORT_NONE;
+	}
+
+	// 고정 후 들어오는 byte는 getRxBuffer()가 이어서 받는다
+	iUartRxCallbackIndex = iLength;
+	fTransportLock(iChannel);
+
+	return iChannel;
+}
+
 /*
  *  @brief	Application 영역 섹터 지우는 함수
  *  @param	None
@@ -377,33 +1017,42 @@ int app_Partition_erase(void)
 {
 	HAL_StatusTypeDef res = HAL_OK;
 
-	uint32_t FirstSector = 0;
-	uint32_t NbOfSectors = 0;
-	uint32_t SECTORError = 0;
+	const PartitionTypeDef *pPartition = fPartitionGet(PARTITION_APPLICATION);
+	const FlashSectorTypeDef *pSector;
 
-	static FLASH_EraseInitTypeDef EraseInitStruct;
+	// 이미 지워져 있어서 건너뛴 sector 수
+	int iSkipCount = 0;
+
+	// 지우기 시작하면 이전 검증 결과는 더 이상 맞지 않는다
+	fImageCacheInvalidate();
 
 	//flash unlock
 	HAL_FLASH_Unlock();
 
-	/* Get the 1st sector to erase */
-	FirstSector = GetSector(FLASH_USER_START_ADDR);
-
-	/* Get the number of sector to erase from 1st sector*/
-	NbOfSectors = GetSector(FLASH_USER_END_ADDR) - FirstSector + 1;
-
-	EraseInitStruct.TypeErase     = FLASH_TYPEERASE_SECTORS;
-	EraseInitStruct.VoltageRange  = FLASH_VOLTAGE_RANGE_3;
-	EraseInitStruct.Sector        = FirstSector;
-	EraseInitStruct.NbSectors     = NbOfSectors;
-
-	//flash Erase
-	res = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-	if(res != HAL_OK)
+	// sector 단위로 SRAM에서 erase, 그동안 UART 수신 인터럽트는 SRAM handler로 계속 처리된다
+	for (uint32_t Sector = pPartition->iFirstSector; Sector <= pPartition->iLastSector; Sector++)
 	{
-		printf("[MCU][Error]HAL_FLASHEx_Erase=%d\r\n",res);
-		return res;
+		pSector = &sFlashSectorTable[Sector];
+
+		// 전부 0xFF인 sector는 erase 생략. 읽어서 확인하는게 erase 보다 훨씬 빠르다
+		if (fFlashIsBlank(pSector->iAddress, pSector->iSize) == 1)
+		{
+			iSkipCount++;
+		}
+		else
+		{
+			res = fFlashEraseSector(Sector);
+			if(res != HAL_OK)
+			{
+				fLog(LOG_FLASH_ERASE_ERROR, 1, res);
+				break;
+			}
+		}
 	}
+	fLog(LOG_ERASE_SKIP, 1, iSkipCount);
+
+	// erase 된 영역이 cache에 남아 있지 않도록 정리
+	FLASH_FlushCaches();
 
 	//flash unlock
 	HAL_FLASH_Lock();
@@ -430,7 +1079,7 @@ int write_test(void)
 		res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, Address, DATA_32);
 		if(res != HAL_OK)
 		{
-			printf("[MCU][Error]HAL_FLASHEx_Erase=%d\r\n",res);
+			fLog(LOG_FLASH_ERASE_ERROR, 1, res);
 		}
 		Address = Address + 4;
 	}
@@ -448,9 +1097,28 @@ int write_test(void)
  *			data		쓸 데이터 배열 시작 주소
  *  @retval	쓰기 성공 여부, 0은 성공, 나머지는 실패
  */
-int flash_wrtie(uint32_t Address, uint32_t end_address, char *data)
+int flash_wrtie(uint32_t Address, uint32_t end_address, const uint32_t *data)
 {
 	HAL_StatusTypeDef res = HAL_OK;
+	// 프로그래밍 시간 측정 시작
+	uint32_t iStartCycle = fPerfStart();
+	uint32_t iLength = end_address - Address;
+
+	// Application partition 밖은 쓰지 않는다
+	if (fPartitionContains(PARTITION_APPLICATION, Address, iLength) == 0)
+	{
+		fLog(LOG_FLASH_PROGRAM_ERROR, 1, HAL_ERROR);
+		return HAL_ERROR;
+	}
+#if FLASH_USE_RAM_ENGINE
+	// SRAM 엔진으로 패킷 전체를 한번에 기록, unlock은 세션 시작 때 이미 되어 있다
+	res = fFlashProgramWords(Address, data, (iLength + 3) / 4);
+	if(res != HAL_OK)
+	{
+		fLog(LOG_FLASH_PROGRAM_ERROR, 1, res);
+		return res;
+	}
+#else
 	int index = 0;
 	int buffer = 0;
 
@@ -459,156 +1127,56 @@ int flash_wrtie(uint32_t Address, uint32_t end_address, char *data)
 
 	while(Address < end_address)
 	{
-		buffer=fConvertString4BytesToInteger32Type(data + index);
+		buffer = (int)data[index];
 
-		res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, Address, buffer);
-		//res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, Address, data[index]);
-		if(res != HAL_OK)
+		iFlashTotalWords++;
+		// 지워진 Flash에 0xFFFFFFFF는 쓸 필요 없다
+		if(buffer == (int)0xFFFFFFFF)
+		{
+			iFlashSkippedWords++;
+		}
+		else
 		{
-			printf("[MCU][ERROR]%d\r\n",res);
-			return res;
+			res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, Address, buffer);
+			//res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, Address, data[index]);
+			if(res != HAL_OK)
+			{
+				fLog(LOG_FLASH_PROGRAM_ERROR, 1, res);
+				return res;
+			}
 		}
 		Address = Address + 4;
-		index = index + 4;
+		index++;
 	}
 
 	//flash unlock
 	HAL_FLASH_Lock();
+#endif
+	fPerfStop(PERF_FLASH_PROGRAM, iStartCycle, iLength);
 
 	return res;
 }
 
 /*
- *  @brief	Gets sector Size
- *  @param	Sector	select sector
- *  @retval	The size of a given sector
+ *  @brief	i2C OLED 전송 queue에 frame 추가. 보통은 복사만 하고 바로 돌아오며
+ *			queue가 가득 찼을 때만 자리가 날 때까지 기다린다
+ *  @param	iControl	control byte
+ *			sData		보낼 내용
+ *			iLength		내용 길이
+ *  @retval	넣었으면 HAL_OK, 자리가 나지 않으면 HAL_TIMEOUT
  */
-static uint32_t GetSectorSize(uint32_t Sector)
+static HAL_StatusTypeDef ssd1306_Submit(uint8_t iControl, const uint8_t *sData, uint16_t iLength)
 {
-	uint32_t sectorsize = 0x00;
-	if((Sector == FLASH_SECTOR_0) || (Sector == FLASH_SECTOR_1) || (Sector == FLASH_SECTOR_2) ||\
-		 (Sector == FLASH_SECTOR_3) || (Sector == FLASH_SECTOR_12) || (Sector == FLASH_SECTOR_13) ||\
-		 (Sector == FLASH_SECTOR_14) || (Sector == FLASH_SECTOR_15))
-	{
-		sectorsize = 16 * 1024;
-	}
-	else if((Sector == FLASH_SECTOR_4) || (Sector == FLASH_SECTOR_16))
-	{
-		sectorsize = 64 * 1024;
-	}
-	else
-	{
-		sectorsize = 128 * 1024;
-	}
-	return sectorsize;
-}
+	uint32_t iStart = HAL_GetTick();
 
-/*
- *	@brief	Gets the sector of a given address
- *	@param	Address	select flash sector
- *	@retval	The sector of a given address
- */
-static uint32_t GetSector(uint32_t Address)
-{
-	uint32_t sector = 0;
-
-	if((Address < ADDR_FLASH_SECTOR_1) && (Address >= ADDR_FLASH_SECTOR_0))
-	{
-		sector = FLASH_SECTOR_0;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_2) && (Address >= ADDR_FLASH_SECTOR_1))
-	{
-		sector = FLASH_SECTOR_1;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_3) && (Address >= ADDR_FLASH_SECTOR_2))
-	{
-		sector = FLASH_SECTOR_2;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_4) && (Address >= ADDR_FLASH_SECTOR_3))
-	{
-		sector = FLASH_SECTOR_3;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_5) && (Address >= ADDR_FLASH_SECTOR_4))
-	{
-		sector = FLASH_SECTOR_4;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_6) && (Address >= ADDR_FLASH_SECTOR_5))
-	{
-		sector = FLASH_SECTOR_5;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_7) && (Address >= ADDR_FLASH_SECTOR_6))
-	{
-		sector = FLASH_SECTOR_6;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_8) && (Address >= ADDR_FLASH_SECTOR_7))
-	{
-		sector = FLASH_SECTOR_7;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_9) && (Address >= ADDR_FLASH_SECTOR_8))
-	{
-		sector = FLASH_SECTOR_8;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_10) && (Address >= ADDR_FLASH_SECTOR_9))
-	{
-		sector = FLASH_SECTOR_9;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_11) && (Address >= ADDR_FLASH_SECTOR_10))
-	{
-		sector = FLASH_SECTOR_10;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_12) && (Address >= ADDR_FLASH_SECTOR_11))
-	{
-		sector = FLASH_SECTOR_11;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_13) && (Address >= ADDR_FLASH_SECTOR_12))
-	{
-		sector = FLASH_SECTOR_12;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_14) && (Address >= ADDR_FLASH_SECTOR_13))
-	{
-		sector = FLASH_SECTOR_13;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_15) && (Address >= ADDR_FLASH_SECTOR_14))
-	{
-		sector = FLASH_SECTOR_14;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_16) && (Address >= ADDR_FLASH_SECTOR_15))
-	{
-		sector = FLASH_SECTOR_15;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_17) && (Address >= ADDR_FLASH_SECTOR_16))
-	{
-		sector = FLASH_SECTOR_16;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_18) && (Address >= ADDR_FLASH_SECTOR_17))
-	{
-		sector = FLASH_SECTOR_17;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_19) && (Address >= ADDR_FLASH_SECTOR_18))
-	{
-		sector = FLASH_SECTOR_18;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_20) && (Address >= ADDR_FLASH_SECTOR_19))
-	{
-		sector = FLASH_SECTOR_19;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_21) && (Address >= ADDR_FLASH_SECTOR_20))
-	{
-		sector = FLASH_SECTOR_20;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_22) && (Address >= ADDR_FLASH_SECTOR_21))
-	{
-		sector = FLASH_SECTOR_21;
-	}
-	else if((Address < ADDR_FLASH_SECTOR_23) && (Address >= ADDR_FLASH_SECTOR_22))
-	{
-		sector = FLASH_SECTOR_22;
-	}
-	else /* (Address < FLASH_END_ADDR) && (Address >= ADDR_FLASH_SECTOR_23) */
+	while (fOledQueueSubmit(iControl, sData, iLength) != 0)
 	{
-		sector = FLASH_SECTOR_23;
+		if (HAL_GetTick() - iStart > OLED_QUEUE_WAIT_TIMEOUT)
+		{
+			return HAL_TIMEOUT;
+		}
 	}
-	return sector;
+	return HAL_OK;
 }
 
 /*
@@ -620,16 +1188,29 @@ void ssd1306_W_Command(uint8_t c)
 {
     HAL_StatusTypeDef res;
 
-    uint8_t buffer[2]={0};		//Control Byte + Command Byte
-    buffer[0]=(0<<7)|(0<<6);	//Co=0 , D/C=0
-    buffer[1]=c;
-
-    res = HAL_I2C_Master_Transmit(&hi2c2,(uint16_t)(0x3C)<<1,(uint8_t*)buffer,2,9999);
+    //Control Byte(Co=0 , D/C=0) + Command Byte
+    res = ssd1306_Submit(OLED_CONTROL_COMMAND, &c, 1);
     if(res != HAL_OK)
     {
-    	printf("Err:%d\r\n",res);
+    	fLog(LOG_I2C_COMMAND_ERROR, 1, res);
     }
-	while (HAL_I2C_GetState(&hi2c2) != HAL_I2C_STATE_READY);
+}
+
+/*
+ *  @brief	i2C OLED Command 여러개를 한번의 전송으로 보낸다 (Co=0 control byte 뒤는 모두 명령)
+ *  @param	sCommands	Command 배열
+ *			iCount		Command 개수
+ *  @retval	None
+ */
+void ssd1306_W_Commands(const uint8_t *sCommands, uint16_t iCount)
+{
+	HAL_StatusTypeDef res;
+
+	res = ssd1306_Submit(OLED_CONTROL_COMMAND, sCommands, iCount);
+	if(res != HAL_OK)
+	{
+		fLog(LOG_I2C_COMMAND_ERROR, 1, res);
+	}
 }
 
 /*
@@ -641,12 +1222,13 @@ void ssd1306_W_Command(uint8_t c)
 void ssd1306_W_Data(uint8_t* data_buffer, uint16_t buffer_size)
 {
 	HAL_StatusTypeDef res;
-	res = HAL_I2C_Mem_Write(&hi2c2,(uint16_t)(0x3C<<1),0x40,1,data_buffer,buffer_size,9999);
+
+	//Control Byte(Co=0 , D/C=1) + Data
+	res = ssd1306_Submit(OLED_CONTROL_DATA, data_buffer, buffer_size);
 	if(res != HAL_OK)
 	{
-		printf("i2C Err:%d\r\n",res);
+		fLog(LOG_I2C_DATA_ERROR, 1, res);
 	}
-	while (HAL_I2C_GetState(&hi2c2) != HAL_I2C_STATE_READY);
 }
 
 /*
@@ -654,184 +1236,61 @@ void ssd1306_W_Data(uint8_t* data_buffer, uint16_t buffer_size)
  *  @param	None
  *  @retval	None
  */
-void init_display(void)
+static void init_display(void)
 {
-    // Init sequence for 128x64 OLED module
-	ssd1306_W_Command(0xAE);		// 0xAE
-    ssd1306_W_Command(0xD5);		// 0xD5
-    ssd1306_W_Command(0x80);		// the suggested ratio 0x80
-    ssd1306_W_Command(0xA8);		// 0xA8
-    ssd1306_W_Command(0x3F);
-    ssd1306_W_Command(0xD3);		// 0xD3
-    ssd1306_W_Command(0x00);		// no offset
-    ssd1306_W_Command(0x40);		// line #0
-    ssd1306_W_Command(0x8D); 		// 0x8D
-    ssd1306_W_Command(0x14); 		// using internal VCC
-    ssd1306_W_Command(0x20);		// 0x20
-    ssd1306_W_Command(0x00);		// 0x00 horizontal addressing
-    ssd1306_W_Command(0xA0 | 0x1); 	// rotate screen 180
-    ssd1306_W_Command(0xC8); 		// rotate screen 180
-    ssd1306_W_Command(0xDA);    	// 0xDA
-    ssd1306_W_Command(0x02);
-    ssd1306_W_Command(0x81);		// 0x81
-    ssd1306_W_Command(0xCF);
-    ssd1306_W_Command(0xd9); 		// 0xd9
-    ssd1306_W_Command(0xF1);
-    ssd1306_W_Command(0xDB);		// 0xDB
-    ssd1306_W_Command(0x40);
-    ssd1306_W_Command(0xA4);		// 0xA4
-    ssd1306_W_Command(0xA6); 		// 0xA6
-    ssd1306_W_Command(0xAF);		//switch on OLED
+	// 한번의 I2C 전송(control byte 0x00 뒤에 명령 연속)으로 보낸다
+	ssd1306_W_Commands(sSsd1306InitSequence, sizeof(sSsd1306InitSequence));
 }
 
 /*
- *  @brief	i2C OLED에 그래픽 버퍼 전달 함수
+ *  @brief	i2C OLED에 그래픽 버퍼 전달 함수. 지난 전송 이후 바뀐 page, column 범위만 queue에 넣고
+ *			전송은 DMA로 진행되므로 기다리지 않는다
  *  @param	sdata	그래픽 버퍼 시작 주소
  *  @retval	None
  */
-void ssd1306_drawingbuffer(char *sdata)
+void ssd1306_drawingbuffer(uint8_t *sdata)
 {
-	ssd1306_W_Command(0x00);
-	ssd1306_W_Command(0x10);
-
-	for(uint8_t i=4;i<8;i++)
+	int iFirst = 0;
+	int iLast = 0;
+	int iPages = 0;
+	int iMaxPages;
+	int i = 0;
+	// column 범위(0x21, 시작, 끝), page 범위(0x22, 시작, 끝)
+	uint8_t sAddress[6] = { 0x21, 0x00, 0x00, 0x22, 0x00, 0x00 };
+
+	while (i < DISPLAY_PAGES)
 	{
-		ssd1306_W_Command(0xB0+i);
-		ssd1306_W_Data(sdata + (128 * (i-4)),128);
-	}
-}
-
-/*
- *  @brief	display 버퍼에 문자 삽입 역할 함수
- *  @param	iLocationX		표기를 시작할 X 좌표
- *			iLocationY		표기를 시작할 Y 좌표
- *			cData			표기 할 문자
- *			displaybuffer	디스플레이 버퍼 배열 시작 주소
- *  @retval	None
- */
-void fDisplayChar(int iLocationX, int iLocationY, char cData, char* displaybuffer)
-{
-	/*
-	 *	사용하는 폰트는 세로가 바이트로 구별 (개별 앨리먼트)되어 있는데 가로는 비트단위로
-	 *	제작되어 있다. 문제는 사용하는 OLED 드라이버칩 특성상 가로가 바이트 단위고 세로가
-	 *	비트 단위라 변환해줘야 한다
-	 */
-
-	 // 입력하는 문자를 사용하는 폰트 데이터 index에 맞게 변환
-	int iIndexChar = (cData - 32) * 12;
-	//For문 사용 변수
-	int x, y, z;
-	// 실제 좌표와 드라이버칩의 메모리 위치 환산 위한 변수
-	int iLocationSumY = 0;
-	char buf = 0b00000001;
-	char nbuf = 0b00000001;
-
-	//특이하게 byte by byte로 픽셀이 매칭이 아닌 행은 Bit로, 열은 Byte로 구분 되어 있다.
-	//참고 자료 : http://www.datasheet.kr/ic/1017173/SSD1309-datasheet-pdf.html
-
-	// 폰트 세로크기
-	for (y = 0; y < 12; y++)
-	{
-		// 폰트 가로크기
-		for (x = 0; x < 1; x++)
+		// 주소 명령 frame 뒤에 page별 데이터 frame이 몇 개 들어가는지 확인, 못 들어가면 다음 호출 때 보낸다
+		for (iMaxPages = 0; iMaxPages < DISPLAY_PAGES - i; iMaxPages++)
 		{
-			//폰트 가로는 비트로 구성
-			for (z = 7; z >= 0; z--)
+			if (fOledQueueHasRoom((3 + sizeof(sAddress)) + ((iMaxPages + 1) * (3 + DISPLAY_WIDTH))) == 0)
 			{
-				//폰트 가로축을 1비트씩 읽어서 On해야 되는 픽셀이 있다면
-				if (((Font12_Table[iIndexChar + (y + x)] >> z) & 0x1) == 1)
-				{
-					// 문자의 시작하려는 y좌표와 현재 읽어들인 문자의 y좌표 합 계산
-					//0~31까지의 실제 OLED 좌표와 드라이버칩 메모리 위치 환산 하기 위해 계산해야 한다
-					iLocationSumY = y + iLocationY;
-
-					//즉 iLocationSumY가 0~7,8~15,16~23,24~31 각각 메모리상으로는 1개의 char 형태로
-					//묶여있는 형태다
-					if (iLocationSumY < 8)
-					{
-						//각 영역 내부에 표시하기 위한 shift
-						buf = 0b00000001 << iLocationSumY;
-						//버퍼 메모리에 해당 위치 변환된 부분에 1을 기록
-						displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] = displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] | buf;
-					}
-					else if ((iLocationSumY >= 8) && (iLocationSumY < 16))
-					{
-						iLocationSumY = iLocationSumY - 8;
-						buf = 0b00000001 << iLocationSumY;
-						displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] | buf;
-					}
-					else if ((iLocationSumY >= 16) && (iLocationSumY < 24))
-					{
-						iLocationSumY = iLocationSumY - 16;
-						buf = 0b00000001 << iLocationSumY;
-						displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] | buf;
-					}
-					else if ((iLocationSumY >= 24) && (iLocationSumY < 32))
-					{
-						iLocationSumY = iLocationSumY - 24;
-						buf = 0b00000001 << iLocationSumY;
-						displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] | buf;
-					}
-				}
-				// 0으로 처리되는 픽셀이면
-				else if (((Font12_Table[iIndexChar + (y + x)] >> z) & 0x1) == 0)
-				{
-					iLocationSumY = y + iLocationY;
-					if (iLocationSumY < 8)
-					{
-						buf = 0b00000001 << iLocationSumY;
-						// 해당 부분 픽셀은 Off이므로 Not연산으로 비트 반전
-						nbuf = ~buf;
-						//And연산으로 꺼버린다
-						displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] = (displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
-					}
-					else if ((iLocationSumY >= 8) && (iLocationSumY < 16))
-					{
-						iLocationSumY = iLocationSumY - 8;
-						buf = 0b00000001 << iLocationSumY;
-						nbuf = ~buf;
-						displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
-					}
-					else if ((iLocationSumY >= 16) && (iLocationSumY < 24))
-					{
-						iLocationSumY = iLocationSumY - 16;
-						buf = 0b00000001 << iLocationSumY;
-						nbuf = ~buf;
-						displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
-					}
-					else if ((iLocationSumY >= 24) && (iLocationSumY < 32))
-					{
-						iLocationSumY = iLocationSumY - 24;
-						buf = 0b00000001 << iLocationSumY;
-						nbuf = ~buf;
-						displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
-					}
-				}
+				break;
 			}
 		}
-	}
-}
+		if (iMaxPages == 0)
+		{
+			break;
+		}
 
-/*
- *  @brief	display에 string 뿌리기 위한 함수
- *  @param	iLocationX		표기를 시작할 X 좌표
- *			iLocationY		표기를 시작할 Y 좌표
- *			displaybuffer	디스플레이 버퍼 배열 시작 주소
- *			p				문자열 주소
- *  @retval	None
- */
-void fDisplayString(int iLocationX, int iLocationY, char *displaybuffer, const char *p, ...)
-{
-	// 문자열 내부 행 좌표
-	int x = 0;
-	// NULL문자 나올때까비 반복
-	while (*p != '\0')
-	{
-		fDisplayChar(iLocationX + x, iLocationY, *p, displaybuffer);
-		//문자"열"이므로 다음 문자는 폰트의 가로 크기인 8만큼 더해준다
-		x = x + 8;
-		//다음 문자 호출
-		p++;
+		// 바뀐 범위가 같은 이웃 page는 주소 지정 한번으로 묶는다 (2~3 page에 걸친 글자)
+		iPages = fDisplayTakeDirtyPages(i, iMaxPages, &iFirst, &iLast);
+		if (iPages == 0)
+		{
+			i++;
+			continue;
+		}
+
+		// horizontal addressing mode라 column, page 범위를 지정하면 그 안에서 page 순서로 이어서 써진다
+		sAddress[1] = (uint8_t)iFirst;
+		sAddress[2] = (uint8_t)iLast;
+		sAddress[4] = (uint8_t)i;
+		sAddress[5] = (uint8_t)(i + iPages - 1);
+		ssd1306_W_Commands(sAddress, sizeof(sAddress));
+		for (; iPages > 0; iPages--, i++)
+		{
+			ssd1306_W_Data(sdata + (DISPLAY_WIDTH * i) + iFirst, iLast - iFirst + 1);
+		}
 	}
 }
 
@@ -881,6 +1340,38 @@ int fConvertStringToInt32(char *source)
 	return res;
 }
 
+/*
+ *  @brief  16진수 문자열을 uint32값으로 변환, 16진수가 아닌 문자가 나오면 멈춘다
+ *  @param  source  변환할 문자열 시작 주소
+ *  @retval uint32로 변환 된 값
+ */
+uint32_t fConvertHexStringToUInt32(char *source)
+{
+	uint32_t res = 0;
+	int i = 0;
+	while(1)
+	{
+		if((source[i] >= '0')&&(source[i] <= '9'))
+		{
+			res = (res << 4) | (uint32_t)(source[i] - '0');
+		}
+		else if((source[i] >= 'A')&&(source[i] <= 'F'))
+		{
+			res = (res << 4) | (uint32_t)(source[i] - 'A' + 10);
+		}
+		else if((source[i] >= 'a')&&(source[i] <= 'f'))
+		{
+			res = (res << 4) | (uint32_t)(source[i] - 'a' + 10);
+		}
+		else
+		{
+			break;
+		}
+		i++;
+	}
+	return res;
+}
+
 /*
  *  @brief  CheckSum8 Xor 연산 함수
  *  @param  sData       연산 대상 문자열 시작 주소
@@ -922,9 +1413,22 @@ int fConvertString4BytesToInteger32Type(unsigned char* sData)
 	return uint.uIntegerData;
 }
 
+/*
+ *  @brief	업데이트 동안 사용할 SRAM vector table 준비. UART2, UART3 수신과 SysTick을 SRAM handler로 교체
+ *  @param	None
+ *  @retval	None
+ */
+static void fUpdateVectorTableToRam(void)
+{
+	fVectorTableToRam();
+	fVectorTableSetHandler(USART2_IRQn, USART2_RamIRQHandler);
+	fVectorTableSetHandler(USART3_IRQn, USART3_RamIRQHandler);
+	fVectorTableSetHandler(SysTick_IRQn, SysTick_RamHandler);
+}
+
 /*
  *  @brief	Application으로 jump하기 위한 함수
- *  @param	application_start_address	jump할 주소
+ *  @param	application_start_address	jump할 application vector table 주소 (image header의 iEntryPoint)
  *  @retval None
  */
 void jump_to_application(uint32_t application_start_address)
@@ -932,9 +1436,12 @@ void jump_to_application(uint32_t application_start_address)
 	typedef void (*fptr)(void);
 	fptr jump_to_app;
 	uint32_t jump_addr;
-	jump_addr = *(__IO uint32_t*) (APPLICATION_ADDRESS + 4);
+	// 인터럽트, 주변장치 정리 후 VTOR을 application으로 변경
+	fHandoffPrepare(application_start_address);
+
+	jump_addr = *(__IO uint32_t*) (application_start_address + 4);
 	jump_to_app = (fptr)jump_addr;
-	__set_MSP(*(__IO uint32_t*) APPLICATION_ADDRESS);
+	__set_MSP(*(__IO uint32_t*) application_start_address);
 	jump_to_app();
 }
 
@@ -943,9 +1450,39 @@ void jump_to_application(uint32_t application_start_address)
  *  @param	data	intterupt쪽에서 데이터 받아오기 위한 파라미터
  *  @retval	None
  */
-void getRxBuffer(uint8_t data)
+__RAM_FUNC void getRxBuffer(uint8_t data)
 {
-	sUART_DMA_ReceiveBuffer[iUartRxCallbackIndex] = data;
-	iUartRxCallbackIndex++;
-}
+	// main loop가 index를 0으로 되돌렸으면 새 패킷
+	if (iUartRxCallbackIndex == 0)
+	{
+		iRxState = RX_STATE_HEADER;
+	}
+
+	// payload는 수신 버퍼를 거치지 않고 word 정렬된 payload 버퍼로, checksum용 XOR도 여기서 같이 계산
+	if (iRxState == RX_STATE_PAYLOAD)
+	{
+		((uint8_t *)sArena.uPhase.sPacketPayload)[iRxPayloadIndex++] = data;
+		iRxPayloadXor ^= data;
+		if (iRxPayloadIndex >= iRxPayloadLength)
+		{
+			iRxState = RX_STATE_TRAILER;
+		}
+		return;
+	}
 
+	// 버퍼 끝을 넘어가면 더 받지 않는다
+	if (iUartRxCallbackIndex < PACKETLIMITELENGTH)
+	{
+		sArena.sReceiveBuffer[iUartRxCallbackIndex] = data;
+		iUartRxCallbackIndex++;
+	}
+
+	// "[DATA]번호," 까지 받았으면 이후 패킷 크기만큼은 payload. Flash 함수는 부를 수 없으므로 직접 비교
+	if ((iRxState == RX_STATE_HEADER) && (data == ',') && (iRxPayloadLength > 0)
+		&& (sArena.sReceiveBuffer[0] == '[') && (sArena.sReceiveBuffer[1] == 'D') && (sArena.sReceiveBuffer[2] == 'A'))
+	{
+		iRxPayloadIndex = 0;
+		iRxPayloadXor = 0;
+		iRxState = RX_STATE_PAYLOAD;
+	}
+}
@@ -0,0 +1,267 @@
+/*
+ * display.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "display.h"
+#include "glyph.h"
+
+#include <string.h>
+
+// page별 바뀐 column 범위
+static DisplayDirtyTypeDef sDisplayDirty[DISPLAY_PAGES];
+
+/*
+ *  @brief	column 하나를 바뀐 범위에 추가
+ *  @param	iPage	page 번호
+ *			iColumn	column 번호
+ *  @retval	None
+ */
+static void fDisplayMarkDirty(int iPage, int iColumn)
+{
+	DisplayDirtyTypeDef *pDirty = &sDisplayDirty[iPage];
+
+	if (pDirty->iFirst > pDirty->iLast)
+	{
+		pDirty->iFirst = (int16_t)iColumn;
+		pDirty->iLast = (int16_t)iColumn;
+	}
+	else if (iColumn < pDirty->iFirst)
+	{
+		pDirty->iFirst = (int16_t)iColumn;
+	}
+	else if (iColumn > pDirty->iLast)
+	{
+		pDirty->iLast = (int16_t)iColumn;
+	}
+}
+
+/*
+ *  @brief	화면 전체를 다시 보내도록 표시. 버퍼를 직접 고친 뒤 호출
+ *  @param	None
+ *  @retval	None
+ */
+void fDisplayInvalidate(void)
+{
+	for (int i = 0; i < DISPLAY_PAGES; i++)
+	{
+		sDisplayDirty[i].iFirst = 0;
+		sDisplayDirty[i].iLast = DISPLAY_WIDTH - 1;
+	}
+}
+
+/*
+ *  @brief	버퍼 전체 지우기
+ *  @param	displaybuffer	디스플레이 버퍼 배열 시작 주소
+ *  @retval	None
+ */
+void fDisplayClear(uint8_t *displaybuffer)
+{
+	memset(displaybuffer, 0x00, DISPLAY_BUFFER_SIZE);
+	fDisplayInvalidate();
+}
+
+/*
+ *  @brief	page의 바뀐 column 범위를 가져오고 해당 page는 바뀐 곳 없음으로 되돌린다
+ *  @param	iPage	page 번호
+ *			iFirst	바뀐 첫 column을 돌려 줄 변수 주소
+ *			iLast	바뀐 마지막 column을 돌려 줄 변수 주소
+ *  @retval	바뀐 곳이 있으면 1, 없으면 0
+ */
+int fDisplayTakeDirty(int iPage, int *iFirst, int *iLast)
+{
+	DisplayDirtyTypeDef *pDirty = &sDisplayDirty[iPage];
+
+	if (pDirty->iFirst > pDirty->iLast)
+	{
+		return 0;
+	}
+
+	*iFirst = pDirty->iFirst;
+	*iLast = pDirty->iLast;
+	pDirty->iFirst = DISPLAY_WIDTH;
+	pDirty->iLast = -1;
+	return 1;
+}
+
+/*
+ *  @brief	iPage부터 바뀐 column 범위가 같은 page들을 한꺼번에 가져온다
+ *  @param	iPage		시작 page 번호
+ *			iMaxPages	최대로 가져올 page 수
+ *			iFirst		바뀐 첫 column을 돌려 줄 변수 주소
+ *			iLast		바뀐 마지막 column을 돌려 줄 변수 주소
+ *  @retval	가져온 page 수, iPage가 바뀐 곳이 없으면 0
+ */
+int fDisplayTakeDirtyPages(int iPage, int iMaxPages, int *iFirst, int *iLast)
+{
+	int iCount = 0;
+
+	if ((iMaxPages < 1) || (fDisplayTakeDirty(iPage, iFirst, iLast) == 0))
+	{
+		return 0;
+	}
+
+	// 다음 page 범위가 완전히 같을 때만 묶는다. 더 넓게 보내는 byte가 생기지 않도록
+	for (iCount = 1; (iCount < iMaxPages) && (iPage + iCount < DISPLAY_PAGES); iCount++)
+	{
+		if ((sDisplayDirty[iPage + iCount].iFirst != *iFirst) || (sDisplayDirty[iPage + iCount].iLast != *iLast))
+		{
+			break;
+		}
+		sDisplayDirty[iPage + iCount].iFirst = DISPLAY_WIDTH;
+		sDisplayDirty[iPage + iCount].iLast = -1;
+	}
+	return iCount;
+}
+
+/*
+ *  @brief	display 버퍼에 문자 삽입 역할 함수
+ *  @param	iLocationX		표기를 시작할 X 좌표 (pixel)
+ *			iLocationY		표기를 시작할 Y 좌표 (pixel, 0 ~ DISPLAY_HEIGHT - 1)
+ *			cData			표기 할 문자
+ *			displaybuffer	디스플레이 버퍼 배열 시작 주소
+ *  @retval	None
+ */
+void fDisplayChar(int iLocationX, int iLocationY, char cData, uint8_t *displaybuffer)
+{
+	/*
+	 *	글자 column 데이터는 gen_glyphs.py가 미리 OLED 방향(세로 bit)으로 바꿔 두었으므로
+	 *	column마다 시작 행만큼 shift 해서 page 단위로 mask/OR 하면 된다.
+	 *	12행 글자는 시작 행에 따라 최대 3 page에 걸친다
+	 */
+	const uint16_t *pGlyph;
+	// 글자가 차지하는 행 mask (시작 행 기준 shift)
+	uint32_t iMask;
+	uint32_t iColumn;
+	int iPage = iLocationY >> 3;
+	int iShift = iLocationY & 0x7;
+	// 글자가 걸치는 page 수 (시작 행에 따라 2 또는 3)
+	int iPageCount = (iShift + GLYPH_HEIGHT + 7) >> 3;
+	int x, p;
+	uint8_t *pByte;
+	uint8_t iByte;
+
+	// 폰트에 없는 문자는 공백으로
+	if ((cData < GLYPH_FIRST_CHAR) || (cData >= GLYPH_FIRST_CHAR + GLYPH_COUNT))
+	{
+		cData = ' ';
+	}
+	if ((iLocationY < 0) || (iLocationY >= DISPLAY_HEIGHT))
+	{
+		return;
+	}
+	pGlyph = sGlyphTable[cData - GLYPH_FIRST_CHAR];
+	iMask = ((1UL << GLYPH_HEIGHT) - 1) << iShift;
+	if (iPage + iPageCount > DISPLAY_PAGES)
+	{
+		iPageCount = DISPLAY_PAGES - iPage;
+	}
+
+	for (x = 0; x < GLYPH_WIDTH; x++)
+	{
+		// 화면 밖 column은 그리지 않는다
+		if ((iLocationX + x < 0) || (iLocationX + x >= DISPLAY_WIDTH))
+		{
+			continue;
+		}
+
+		iColumn = (uint32_t)pGlyph[x] << iShift;
+		pByte = &displaybuffer[(iPage * DISPLAY_WIDTH) + iLocationX + x];
+
+		// 글자 영역의 픽셀은 새로 쓰고 나머지는 그대로 둔다. 값이 바뀐 byte만 dirty
+		for (p = 0; p < iPageCount; p++)
+		{
+			iByte = (uint8_t)((*pByte & ~(iMask >> (p * 8))) | (iColumn >> (p * 8)));
+			if (iByte != *pByte)
+			{
+				*pByte = iByte;
+				fDisplayMarkDirty(iPage + p, iLocationX + x);
+			}
+			pByte += DISPLAY_WIDTH;
+		}
+	}
+}
+
+/*
+ *  @brief	display에 string 뿌리기 위한 함수
+ *  @param	iLocationX		표기를 시작할 X 좌표
+ *			iLocationY		표기를 시작할 Y 좌표
+ *			displaybuffer	디스플레이 버퍼 배열 시작 주소
+ *			p				문자열 주소
+ *  @retval	None
+ */
+void fDisplayString(int iLocationX, int iLocationY, uint8_t *displaybuffer, const char *p, ...)
+{
+	// 문자열 내부 행 좌표
+	int x = 0;
+	// NULL문자 나올때까비 반복
+	while (*p != '\0')
+	{
+		fDisplayChar(iLocationX + x, iLocationY, *p, displaybuffer);
+		//문자"열"이므로 다음 문자는 폰트의 가로 크기인 8만큼 더해준다
+		x = x + GLYPH_WIDTH;
+		//다음 문자 호출
+		p++;
+	}
+}
+
+/*
+ *  @brief	사각형 영역을 켜거나 끈다. 값이 바뀐 byte만 dirty로 기록
+ *  @param	iLocationX		사각형 왼쪽 X 좌표 (pixel)
+ *			iLocationY		사각형 위쪽 Y 좌표 (pixel)
+ *			iWidth			가로 pixel 수
+ *			iHeight			세로 pixel 수
+ *			iOn				1이면 켜고 0이면 끈다
+ *			displaybuffer	디스플레이 버퍼 배열 시작 주소
+ *  @retval	None
+ */
+void fDisplayFillRect(int iLocationX, int iLocationY, int iWidth, int iHeight, int iOn, uint8_t *displaybuffer)
+{
+	int iBottom = iLocationY + iHeight;
+	int iRight = iLocationX + iWidth;
+	int iPage, iRow, x;
+	uint8_t iMask;
+	uint8_t iByte;
+	uint8_t *pByte;
+
+	// 화면 밖 부분은 잘라낸다
+	if (iLocationX < 0)
+	{
+		iLocationX = 0;
+	}
+	if (iLocationY < 0)
+	{
+		iLocationY = 0;
+	}
+	if (iRight > DISPLAY_WIDTH)
+	{
+		iRight = DISPLAY_WIDTH;
+	}
+	if (iBottom > DISPLAY_HEIGHT)
+	{
+		iBottom = DISPLAY_HEIGHT;
+	}
+
+	// page 단위로 해당 행 mask를 만들어 column마다 한 byte씩 처리
+	for (iRow = iLocationY; iRow < iBottom; iRow = (iPage + 1) << 3)
+	{
+		iPage = iRow >> 3;
+		iMask = (uint8_t)(0xFF << (iRow & 0x7));
+		if (iBottom < ((iPage + 1) << 3))
+		{
+			iMask &= (uint8_t)(0xFF >> (((iPage + 1) << 3) - iBottom));
+		}
+
+		pByte = &displaybuffer[(iPage * DISPLAY_WIDTH) + iLocationX];
+		for (x = iLocationX; x < iRight; x++, pByte++)
+		{
+			iByte = iOn ? (uint8_t)(*pByte | iMask) : (uint8_t)(*pByte & ~iMask);
+			if (iByte != *pByte)
+			{
+				*pByte = iByte;
+				fDisplayMarkDirty(iPage, x);
+			}
+		}
+	}
+}
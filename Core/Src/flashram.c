@@ -0,0 +1,177 @@
+/*
+ * flashram.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "flashram.h"
+
+#include "log.h"
+
+// 프로그래밍 중 발생할 수 있는 에러 flag
+#define FLASH_PROGRAM_ERROR_FLAGS	(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+// 세션 동안 0xFFFFFFFF라서 프로그래밍을 생략한 word 수
+uint32_t iFlashSkippedWords;
+// 세션 동안 프로그래밍 요청된 전체 word 수
+uint32_t iFlashTotalWords;
+
+/*
+ *  @brief	업데이트 세션 시작. Flash unlock은 세션마다 한번만 한다
+ *  @param	None
+ *  @retval	None
+ */
+void fFlashSessionBegin(void)
+{
+	HAL_FLASH_Unlock();
+
+	// 이전 동작에서 남은 에러 flag 정리
+	__HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_PROGRAM_ERROR_FLAGS);
+
+	iFlashSkippedWords = 0;
+	iFlashTotalWords = 0;
+}
+
+/*
+ *  @brief	업데이트 세션 종료, Flash lock
+ *  @param	None
+ *  @retval	None
+ */
+void fFlashSessionEnd(void)
+{
+	HAL_FLASH_Lock();
+}
+
+/*
+ *	@brief	Flash 영역이 지워진 상태(전부 0xFF)인지 확인. 4 word씩 AND로 모아서 비교하고
+ *			0xFF가 아닌 값이 나오면 바로 끝낸다
+ *	@param	Address	확인 시작 주소, 4Byte 정렬
+ *			iSize	확인할 크기 (Byte), 16의 배수
+ *	@retval	전부 0xFF면 1, 아니면 0
+ */
+int fFlashIsBlank(uint32_t Address, uint32_t iSize)
+{
+	const uint32_t *pData = (const uint32_t *)Address;
+	const uint32_t *pEnd = (const uint32_t *)(Address + iSize);
+
+	while (pData < pEnd)
+	{
+		if ((pData[0] & pData[1] & pData[2] & pData[3]) != 0xFFFFFFFF)
+		{
+			return 0;
+		}
+		pData = pData + 4;
+	}
+	return 1;
+}
+
+/*
+ *	@brief	버퍼 전체를 32bit 단위로 프로그래밍. SRAM에서 실행되며 FLASH->CR/SR을 직접
+ *			다룬다. HAL_FLASH_Program()처럼 word마다 lock 확인, HAL_GetTick() timeout 처리를
+ *			하지 않고 BSY만 확인한다. 0xFFFFFFFF word는 건너뛰므로 지워진 영역에만 써야 한다.
+ *			fFlashSessionBegin() 이후에 호출해야 한다
+ *	@param	Address		쓰기 시작할 Flash 주소, 4Byte 정렬
+ *			data		쓸 데이터 시작 주소, word 정렬 (수신 payload 버퍼를 그대로 넘긴다)
+ *			iWordCount	쓸 word 개수
+ *	@retval	HAL_OK 성공, HAL_ERROR 프로그래밍 에러
+ */
+__RAM_FUNC HAL_StatusTypeDef fFlashProgramWords(uint32_t Address, const uint32_t *data, uint32_t iWordCount)
+{
+	HAL_StatusTypeDef res = HAL_OK;
+
+	// 이전 동작 종료 대기
+	while ((FLASH->SR & FLASH_FLAG_BSY) != 0);
+	__HAL_FLASH_CLEAR_FLAG(FLASH_PROGRAM_ERROR_FLAGS);
+
+	// word 단위 프로그래밍 모드
+	FLASH->CR &= CR_PSIZE_MASK;
+	FLASH->CR |= FLASH_PSIZE_WORD;
+	FLASH->CR |= FLASH_CR_PG;
+
+	iFlashTotalWords += iWordCount;
+
+	while (iWordCount > 0)
+	{
+		uint32_t iWord = *data;
+
+		// 지워진 Flash에 0xFFFFFFFF를 쓰는 것은 아무 변화가 없으므로 생략
+		if (iWord == 0xFFFFFFFF)
+		{
+			iFlashSkippedWords++;
+		}
+		else
+		{
+			*(__IO uint32_t *)Address = iWord;
+
+			// 기록 완료 대기
+			while ((FLASH->SR & FLASH_FLAG_BSY) != 0);
+
+			if ((FLASH->SR & FLASH_PROGRAM_ERROR_FLAGS) != 0)
+			{
+				res = HAL_ERROR;
+				break;
+			}
+		}
+
+		Address = Address + 4;
+		data++;
+		iWordCount--;
+	}
+
+	FLASH->CR &= (~FLASH_CR_PG);
+
+	return res;
+}
+
+/*
+ *	@brief	sector 하나 지우기. SRAM에서 실행되며 erase가 끝날때까지 FLASH->SR만 확인하므로
+ *			SRAM vector table과 SRAM handler를 쓰는 인터럽트는 erase 중에도 계속 처리된다.
+ *			Flash unlock 상태에서 호출해야 한다
+ *	@param	Sector	지울 sector 번호 (FLASH_SECTOR_0 ~ FLASH_SECTOR_23)
+ *	@retval	HAL_OK 성공, HAL_ERROR erase 에러
+ */
+__RAM_FUNC HAL_StatusTypeDef fFlashEraseSector(uint32_t Sector)
+{
+	HAL_StatusTypeDef res = HAL_OK;
+
+	// 이전 동작 종료 대기
+	while ((FLASH->SR & FLASH_FLAG_BSY) != 0);
+	__HAL_FLASH_CLEAR_FLAG(FLASH_PROGRAM_ERROR_FLAGS);
+
+	// Bank 2 sector는 SNB 값이 0x10부터 시작
+	if (Sector > FLASH_SECTOR_11)
+	{
+		Sector = Sector + 4;
+	}
+
+	// 전압 범위 3 (2.7V ~ 3.6V)은 word 단위 erase
+	FLASH->CR &= CR_PSIZE_MASK;
+	FLASH->CR |= FLASH_PSIZE_WORD;
+	FLASH->CR &= (~FLASH_CR_SNB);
+	FLASH->CR |= FLASH_CR_SER | (Sector << FLASH_CR_SNB_Pos);
+	FLASH->CR |= FLASH_CR_STRT;
+
+	// erase 완료 대기, 이 동안 Flash에서 명령어를 읽으면 안된다
+	while ((FLASH->SR & FLASH_FLAG_BSY) != 0);
+
+	if ((FLASH->SR & FLASH_PROGRAM_ERROR_FLAGS) != 0)
+	{
+		res = HAL_ERROR;
+	}
+
+	FLASH->CR &= (~(FLASH_CR_SER | FLASH_CR_SNB));
+
+	return res;
+}
+
+/*
+ *  @brief	세션 동안 생략한 word 수를 "[MCU]FLASH,SKIP,생략 word,전체 word" 형식으로 전송
+ *  @param	None
+ *  @retval	None
+ */
+void fFlashReport(void)
+{
+	fLog(LOG_FLASH_SKIP, 2, iFlashSkippedWords, iFlashTotalWords);
+}
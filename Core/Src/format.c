@@ -0,0 +1,234 @@
+/*
+ * format.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "format.h"
+
+/* 출력 버퍼 상태 */
+typedef struct
+{
+	char *sBuffer;
+	uint32_t iSize;
+	uint32_t iLength;
+} FormatOutputTypeDef;
+
+/*
+ *  @brief	한 글자 출력, 버퍼가 차면 버린다 (NULL 자리는 항상 남긴다)
+ *  @param	pOut	출력 버퍼 상태
+ *			c		출력할 글자
+ *  @retval	None
+ */
+static void fFormatPutChar(FormatOutputTypeDef *pOut, char c)
+{
+	if (pOut->iLength + 1 < pOut->iSize)
+	{
+		pOut->sBuffer[pOut->iLength] = c;
+	}
+	pOut->iLength++;
+}
+
+/*
+ *  @brief	자리수에 맞춰 문자열 출력
+ *  @param	pOut		출력 버퍼 상태
+ *			sData		출력할 문자열
+ *			iLength		sData 길이
+ *			iWidth		최소 자리수
+ *			cPad		왼쪽 채움 글자 (' ' 또는 '0')
+ *			iLeft		1이면 왼쪽 정렬
+ *  @retval	None
+ */
+static void fFormatPutPadded(FormatOutputTypeDef *pOut, const char *sData, int iLength, int iWidth, char cPad, int iLeft)
+{
+	int iPad = (iWidth > iLength) ? (iWidth - iLength) : 0;
+
+	// '-' 부호는 0 채움보다 앞에 온다
+	if ((cPad == '0') && (iLength > 0) && (sData[0] == '-'))
+	{
+		fFormatPutChar(pOut, *sData++);
+		iLength--;
+	}
+	if (iLeft == 0)
+	{
+		while (iPad-- > 0)
+		{
+			fFormatPutChar(pOut, cPad);
+		}
+	}
+	while (iLength-- > 0)
+	{
+		fFormatPutChar(pOut, *sData++);
+	}
+	// 왼쪽 정렬은 항상 공백으로 채운다
+	while (iPad-- > 0)
+	{
+		fFormatPutChar(pOut, ' ');
+	}
+}
+
+/*
+ *  @brief	숫자를 문자열로 변환. 버퍼 끝에서부터 채운다
+ *  @param	sEnd		변환 버퍼의 끝 (NULL 다음 자리)
+ *			iValue		변환할 값
+ *			iBase		10 또는 16
+ *			sDigits		사용할 숫자 글자 ("0123456789abcdef" 등)
+ *  @retval	변환된 문자열 시작 주소
+ */
+static char *fFormatNumber(char *sEnd, uint32_t iValue, uint32_t iBase, const char *sDigits)
+{
+	do
+	{
+		*--sEnd = sDigits[iValue % iBase];
+		iValue = iValue / iBase;
+	} while (iValue != 0);
+
+	return sEnd;
+}
+
+/*
+ *  @brief	format 문자열대로 버퍼에 출력 (vsnprintf 대체)
+ *  @param	sBuffer	출력 버퍼
+ *			iSize	버퍼 크기, 0이면 길이만 계산
+ *			sFormat	format 문자열
+ *			ap		인자
+ *  @retval	버퍼가 충분했을 때의 출력 길이 (NULL 제외)
+ */
+int fFormatStringV(char *sBuffer, uint32_t iSize, const char *sFormat, va_list ap)
+{
+	FormatOutputTypeDef sOut = { sBuffer, iSize, 0 };
+	// 부호 + 32bit 10진수 최대 10자리
+	char sNumber[12];
+	char *sEnd = &sNumber[sizeof(sNumber)];
+	const char *p = sFormat;
+	const char *s;
+	char *pNumber;
+	char cPad;
+	int iLeft;
+	int iWidth;
+	int32_t iSigned;
+	int iLength;
+
+	while (*p != '\0')
+	{
+		if (*p != '%')
+		{
+			fFormatPutChar(&sOut, *p++);
+			continue;
+		}
+		p++;
+
+		// flag
+		cPad = ' ';
+		iLeft = 0;
+		while ((*p == '0') || (*p == '-'))
+		{
+			if (*p == '0')
+			{
+				cPad = '0';
+			}
+			else
+			{
+				iLeft = 1;
+			}
+			p++;
+		}
+
+		// 자리수
+		iWidth = 0;
+		while ((*p >= '0') && (*p <= '9'))
+		{
+			iWidth = (iWidth * 10) + (*p++ - '0');
+		}
+
+		// long은 int와 같은 32bit
+		while (*p == 'l')
+		{
+			p++;
+		}
+
+		switch (*p)
+		{
+		case 'd':
+		case 'i':
+			iSigned = (int32_t)va_arg(ap, int);
+			if (iSigned < 0)
+			{
+				pNumber = fFormatNumber(sEnd, (uint32_t)0 - (uint32_t)iSigned, 10, "0123456789");
+				*--pNumber = '-';
+			}
+			else
+			{
+				pNumber = fFormatNumber(sEnd, (uint32_t)iSigned, 10, "0123456789");
+			}
+			fFormatPutPadded(&sOut, pNumber, (int)(sEnd - pNumber), iWidth, cPad, iLeft);
+			break;
+		case 'u':
+			pNumber = fFormatNumber(sEnd, va_arg(ap, unsigned int), 10, "0123456789");
+			fFormatPutPadded(&sOut, pNumber, (int)(sEnd - pNumber), iWidth, cPad, iLeft);
+			break;
+		case 'x':
+			pNumber = fFormatNumber(sEnd, va_arg(ap, unsigned int), 16, "0123456789abcdef");
+			fFormatPutPadded(&sOut, pNumber, (int)(sEnd - pNumber), iWidth, cPad, iLeft);
+			break;
+		case 'X':
+			pNumber = fFormatNumber(sEnd, va_arg(ap, unsigned int), 16, "0123456789ABCDEF");
+			fFormatPutPadded(&sOut, pNumber, (int)(sEnd - pNumber), iWidth, cPad, iLeft);
+			break;
+		case 's':
+			s = va_arg(ap, const char *);
+			if (s == 0)
+			{
+				s = "(null)";
+			}
+			for (iLength = 0; s[iLength] != '\0'; iLength++)
+			{
+			}
+			fFormatPutPadded(&sOut, s, iLength, iWidth, ' ', iLeft);
+			break;
+		case 'c':
+			sNumber[0] = (char)va_arg(ap, int);
+			fFormatPutPadded(&sOut, sNumber, 1, iWidth, ' ', iLeft);
+			break;
+		case '%':
+			fFormatPutChar(&sOut, '%');
+			break;
+		case '\0':
+			// format이 '%'로 끝나면 그대로 종료
+			p--;
+			break;
+		default:
+			// 지원하지 않는 변환은 그대로 출력
+			fFormatPutChar(&sOut, '%');
+			fFormatPutChar(&sOut, *p);
+			break;
+		}
+		p++;
+	}
+
+	if (iSize > 0)
+	{
+		sBuffer[(sOut.iLength < iSize) ? sOut.iLength : (iSize - 1)] = '\0';
+	}
+	return (int)sOut.iLength;
+}
+
+/*
+ *  @brief	format 문자열대로 버퍼에 출력 (snprintf 대체)
+ *  @param	sBuffer	출력 버퍼
+ *			iSize	버퍼 크기
+ *			sFormat	format 문자열
+ *			...		인자
+ *  @retval	버퍼가 충분했을 때의 출력 길이 (NULL 제외)
+ */
+int fFormatString(char *sBuffer, uint32_t iSize, const char *sFormat, ...)
+{
+	va_list ap;
+	int iLength;
+
+	va_start(ap, sFormat);
+	iLength = fFormatStringV(sBuffer, iSize, sFormat, ap);
+	va_end(ap);
+
+	return iLength;
+}
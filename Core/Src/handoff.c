@@ -0,0 +1,74 @@
+/*
+ * handoff.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+#include "i2c.h"
+#include "usart.h"
+
+#include "bkpsram.h"
+#include "hwcrc.h"
+#include "oledqueue.h"
+#include "handoff.h"
+
+/*
+ *  @brief	Application으로 넘어가기 전 정리. bootloader 인터럽트와 주변장치를 모두 멈추고
+ *			VTOR을 application vector table로 바꾼다. 호출 후에는 MSP 설정과 jump만 남는다
+ *  @param	VectorAddress	application vector table 주소
+ *  @retval	None
+ */
+void fHandoffPrepare(uint32_t VectorAddress)
+{
+	// 화면에 보낼 내용을 마저 보내고 I2C DMA 정리
+	fOledQueueFlush(OLED_QUEUE_WAIT_TIMEOUT);
+	fOledQueueDeInit();
+
+	// bootloader handler가 더 이상 불리지 않도록 막는다
+	__disable_irq();
+
+	// 사용한 주변장치 해제 (MspDeInit에서 pin, NVIC 해제)
+	HAL_UART_DeInit(&huart2);
+	HAL_UART_DeInit(&huart3);
+	HAL_I2C_DeInit(&hi2c2);
+	fCrcDeInit();
+	HAL_GPIO_DeInit(GPIOB, LD1_Pin|LD3_Pin|LD2_Pin);
+	HAL_GPIO_DeInit(USER_Btn_GPIO_Port, USER_Btn_Pin);
+
+#if (HANDOFF_KEEP_CLOCK == 0)
+	// reset 상태 clock(HSI)으로 되돌린다. 내부에서 SysTick을 다시 설정하므로 SysTick 정지보다 먼저 한다
+	HAL_RCC_DeInit();
+#endif
+
+	// SysTick 정지, pending 해제
+	SysTick->CTRL = 0;
+	SysTick->VAL = 0;
+	SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+
+	// 모든 외부 인터럽트 disable, pending 해제
+	for (uint32_t i = 0; i < (sizeof(NVIC->ICER) / sizeof(NVIC->ICER[0])); i++)
+	{
+		NVIC->ICER[i] = 0xFFFFFFFF;
+		NVIC->ICPR[i] = 0xFFFFFFFF;
+	}
+
+	// application이 clock 설정을 생략할 수 있도록 기록, magic은 마지막에 쓴다
+	HANDOFF->iMagic = 0;
+#if (HANDOFF_KEEP_CLOCK == 1)
+	HANDOFF->iFlags = HANDOFF_FLAG_CLOCK_CONFIGURED;
+#else
+	HANDOFF->iFlags = 0;
+#endif
+	HANDOFF->iSystemCoreClock = SystemCoreClock;
+	HANDOFF->iMagic = HANDOFF_MAGIC;
+	HANDOFF->iCheck = ~(HANDOFF->iMagic ^ HANDOFF->iFlags ^ HANDOFF->iSystemCoreClock);
+
+	// application vector table 사용
+	SCB->VTOR = VectorAddress;
+	__DSB();
+	__ISB();
+
+	// NVIC, SysTick이 모두 꺼졌으므로 application 시작 상태(PRIMASK=0)로 되돌린다
+	__enable_irq();
+}
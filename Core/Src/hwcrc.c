@@ -0,0 +1,89 @@
+/*
+ * hwcrc.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "hwcrc.h"
+
+/*
+ *	DMA2 Stream0 memory to memory 전송으로 Flash 내용을 CRC->DR에 바로 넣는다.
+ *	CPU는 Flash를 읽지 않으므로 계산하는 동안 UART 인터럽트를 그대로 처리 할 수 있다
+ */
+static DMA_HandleTypeDef hdma_crc;
+
+/*
+ *  @brief	CRC 유닛과 DMA 초기화
+ *  @param	None
+ *  @retval	None
+ */
+void fCrcInit(void)
+{
+	__HAL_RCC_CRC_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	// memory to memory는 DMA2만 가능. 원본 주소는 증가, 목적지 CRC->DR 고정
+	hdma_crc.Instance = DMA2_Stream0;
+	hdma_crc.Init.Channel = DMA_CHANNEL_0;
+	hdma_crc.Init.Direction = DMA_MEMORY_TO_MEMORY;
+	hdma_crc.Init.PeriphInc = DMA_PINC_ENABLE;
+	hdma_crc.Init.MemInc = DMA_MINC_DISABLE;
+	hdma_crc.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+	hdma_crc.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+	hdma_crc.Init.Mode = DMA_NORMAL;
+	hdma_crc.Init.Priority = DMA_PRIORITY_LOW;
+	// memory to memory는 FIFO 모드만 가능
+	hdma_crc.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+	hdma_crc.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+	hdma_crc.Init.MemBurst = DMA_MBURST_SINGLE;
+	hdma_crc.Init.PeriphBurst = DMA_PBURST_SINGLE;
+	if (HAL_DMA_Init(&hdma_crc) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+/*
+ *  @brief	CRC 유닛과 DMA 해제. Application으로 넘어가기 전에 호출
+ *  @param	None
+ *  @retval	None
+ */
+void fCrcDeInit(void)
+{
+	HAL_DMA_DeInit(&hdma_crc);
+	__HAL_RCC_CRC_CLK_DISABLE();
+}
+
+/*
+ *  @brief	메모리 영역의 CRC 계산. DMA로 CRC 유닛에 word 단위로 넣는다
+ *  @param	Address	계산 시작 주소, 4Byte 정렬
+ *			iSize	계산할 크기 (Byte), 4의 배수
+ *  @retval	CRC 결과
+ */
+uint32_t fCrcCalculate(uint32_t Address, uint32_t iSize)
+{
+	uint32_t iWords = iSize / 4;
+	uint32_t iChunk = 0;
+
+	// CRC 초기값 0xFFFFFFFF로 초기화
+	CRC->CR = CRC_CR_RESET;
+
+	while (iWords > 0)
+	{
+		iChunk = (iWords > CRC_DMA_MAX_WORDS) ? CRC_DMA_MAX_WORDS : iWords;
+
+		HAL_DMA_Start(&hdma_crc, Address, (uint32_t)&CRC->DR, iChunk);
+		if (HAL_DMA_PollForTransfer(&hdma_crc, HAL_DMA_FULL_TRANSFER, 1000) != HAL_OK)
+		{
+			HAL_DMA_Abort(&hdma_crc);
+			break;
+		}
+
+		Address = Address + (iChunk * 4);
+		iWords = iWords - iChunk;
+	}
+
+	return CRC->DR;
+}
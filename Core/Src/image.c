@@ -0,0 +1,321 @@
+/*
+ * image.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "bkpsram.h"
+#include "hwcrc.h"
+#include "partition.h"
+#include "image.h"
+#include "p256.h"
+#include "perf.h"
+#include "log.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if IMAGE_SIGNATURE_REQUIRED
+/*
+ *	signkey.h는 저장소에 없고 provisioning 때 Tools/signkey.py가 만든다.
+ *	개발용 key (signkey.py --dev)는 Debug build에서만 쓴다
+ */
+#if !__has_include("signkey.h")
+#error "Core/Inc/signkey.h is missing: run Tools/signkey.py --dev (Debug) or --key <product key>"
+#endif
+#include "signkey.h"
+
+#if SIGNKEY_DEVELOPMENT && !defined(DEBUG)
+#error "signkey.h holds a development key: provision the product key (Tools/signkey.py --key) for a Release build"
+#endif
+#endif
+
+// Backup SRAM에 위치한 검증 결과 cache
+#define IMAGE_CACHE		((volatile ImageCacheTypeDef *)BKPSRAM_IMAGE_CACHE_ADDRESS)
+
+/*
+ *  @brief	cache 검증 값 계산
+ *  @param	None
+ *  @retval	검증 값
+ */
+static uint32_t fImageCacheCheck(void)
+{
+	return ~(IMAGE_CACHE->iMagic ^ IMAGE_CACHE->iAddress ^ IMAGE_CACHE->iHeaderCrc ^ IMAGE_CACHE->iImageCrc);
+}
+
+/*
+ *  @brief	이전 부팅에서 같은 header로 검증을 통과했는지 확인
+ *  @param	Address	header 주소
+ *			pHeader	header
+ *  @retval	통과 기록이 있으면 1, 없으면 0
+ */
+static int fImageCacheHit(uint32_t Address, const ImageHeaderTypeDef *pHeader)
+{
+	if ((IMAGE_CACHE->iMagic != IMAGE_CACHE_MAGIC) || (IMAGE_CACHE->iCheck != fImageCacheCheck()))
+	{
+		return 0;
+	}
+	if ((IMAGE_CACHE->iAddress != Address) || (IMAGE_CACHE->iHeaderCrc != pHeader->iHeaderCrc) || (IMAGE_CACHE->iImageCrc != pHeader->iImageCrc))
+	{
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ *  @brief	검증 통과 기록
+ *  @param	Address	header 주소
+ *			pHeader	header
+ *  @retval	None
+ */
+static void fImageCacheStore(uint32_t Address, const ImageHeaderTypeDef *pHeader)
+{
+	// 기록 도중 리셋되어도 유효하게 보이지 않도록 magic은 마지막에 쓴다
+	IMAGE_CACHE->iMagic = 0;
+	IMAGE_CACHE->iAddress = Address;
+	IMAGE_CACHE->iHeaderCrc = pHeader->iHeaderCrc;
+	IMAGE_CACHE->iImageCrc = pHeader->iImageCrc;
+	IMAGE_CACHE->iMagic = IMAGE_CACHE_MAGIC;
+	IMAGE_CACHE->iCheck = fImageCacheCheck();
+}
+
+/*
+ *  @brief	검증 결과 cache 무효화. Application 영역을 지우거나 쓰기 시작할 때 호출
+ *  @param	None
+ *  @retval	None
+ */
+void fImageCacheInvalidate(void)
+{
+	IMAGE_CACHE->iMagic = 0;
+	IMAGE_CACHE->iCheck = 0;
+}
+
+/*
+ *  @brief	서명 확인. sDigest가 없으면 header 앞부분과 이미지를 메모리에서 읽어 hash를 계산한다
+ *  @param	pHeader	header
+ *			sDigest	DATA를 받으면서 계산한 hash, 없으면 NULL
+ *  @retval	서명이 맞으면 0, 아니면 -3
+ */
+static int fImageCheckSignature(const ImageHeaderTypeDef *pHeader, const uint8_t *sDigest)
+{
+#if (IMAGE_SIGNATURE_REQUIRED == 1)
+	Sha256TypeDef sSha;
+	uint8_t sHash[SHA256_DIGEST_SIZE];
+	uint32_t iStartCycle;
+	int res;
+
+	if (sDigest == NULL)
+	{
+		iStartCycle = fPerfStart();
+		fSha256Init(&sSha);
+		fSha256Update(&sSha, (const uint8_t *)pHeader, IMAGE_SIGNED_HEADER_SIZE);
+		fSha256Update(&sSha, (const uint8_t *)pHeader->iEntryPoint, pHeader->iImageLength);
+		fSha256Final(&sSha, sHash);
+		fPerfStop(PERF_IMAGE_HASH, iStartCycle, IMAGE_SIGNED_HEADER_SIZE + pHeader->iImageLength);
+		sDigest = sHash;
+	}
+
+	iStartCycle = fPerfStart();
+	res = fP256Verify(sImagePublicKey, sDigest, pHeader->sSignature);
+	fLog(LOG_IMAGE_SIGNATURE, 2, res, (fPerfStart() - iStartCycle) / (SystemCoreClock / 1000000));
+
+	return (res == 0) ? 0 : -3;
+#else
+	(void)pHeader;
+	(void)sDigest;
+	return 0;
+#endif
+}
+
+/*
+ *  @brief	Application 이미지 검증. header 형식과 CRC를 확인하고, 이미지 CRC와 서명은
+ *			cache에 통과 기록이 없을 때만 전체를 읽어 확인한다
+ *  @param	Address			header 주소 (Application partition 또는 RAM load 영역 시작)
+ *			iPartitionSize	Application partition (RAM load 영역) 크기
+ *			sDigest			fImageHashFinish()로 받은 서명 대상 hash, 없으면 NULL (메모리에서 계산)
+ *  @retval	정상이면 0, header 이상 -1, 이미지 CRC 불일치 -2, 서명 불일치 -3
+ */
+int fImageValidateDigest(uint32_t Address, uint32_t iPartitionSize, const uint8_t *sDigest)
+{
+	const ImageHeaderTypeDef *pHeader = (const ImageHeaderTypeDef *)Address;
+
+	if ((pHeader->iMagic != IMAGE_MAGIC) || (pHeader->iHeaderSize != IMAGE_HEADER_SIZE))
+	{
+		return -1;
+	}
+	// header 필드 6개(iMagic ~ iEntryPoint) 확인
+	if (fCrcCalculate(Address, 6 * 4) != pHeader->iHeaderCrc)
+	{
+		return -1;
+	}
+	// 이미지가 partition 안에 있고 vector table이 header 바로 뒤에 있어야 한다
+	if ((pHeader->iImageLength == 0) || ((pHeader->iImageLength % 4) != 0) || (pHeader->iImageLength > iPartitionSize - IMAGE_HEADER_SIZE))
+	{
+		return -1;
+	}
+	if (pHeader->iEntryPoint != Address + IMAGE_HEADER_SIZE)
+	{
+		return -1;
+	}
+
+	// RAM load 이미지는 리셋하면 사라지므로 cache를 쓰지 않고 매번 전체 검사한다
+	if ((Address < PARTITION_FLASH_BASE) || (Address - PARTITION_FLASH_BASE >= PARTITION_FLASH_SIZE))
+	{
+		if (fCrcCalculate(pHeader->iEntryPoint, pHeader->iImageLength) != pHeader->iImageCrc)
+		{
+			return -2;
+		}
+		return fImageCheckSignature(pHeader, sDigest);
+	}
+
+	// 이전 부팅에서 같은 header로 통과했으면 전체 검사 생략
+	if (fImageCacheHit(Address, pHeader) == 1)
+	{
+		return 0;
+	}
+
+	// 받으면서 계산한 hash는 기록하기 전 data이므로 기록된 내용은 CRC로 확인한다
+	if (fCrcCalculate(pHeader->iEntryPoint, pHeader->iImageLength) != pHeader->iImageCrc)
+	{
+		return -2;
+	}
+	if (fImageCheckSignature(pHeader, sDigest) != 0)
+	{
+		return -3;
+	}
+
+	fImageCacheStore(Address, pHeader);
+	return 0;
+}
+
+/*
+ *  @brief	Application 이미지 검증, 서명 대상 hash는 메모리에서 계산한다
+ *  @param	Address			header 주소 (Application partition 또는 RAM load 영역 시작)
+ *			iPartitionSize	Application partition (RAM load 영역) 크기
+ *  @retval	fImageValidateDigest()와 같다
+ */
+int fImageValidate(uint32_t Address, uint32_t iPartitionSize)
+{
+	return fImageValidateDigest(Address, iPartitionSize, NULL);
+}
+
+/*
+ *  @brief	DATA로 받을 이미지의 서명 대상 hash 계산 시작 (INFO, RAMLOAD)
+ *  @param	pHash	hash 상태
+ *  @retval	None
+ */
+void fImageHashStart(ImageHashTypeDef *pHash)
+{
+	fSha256Init(&pHash->sSha);
+	pHash->iNextOffset = 0;
+	pHash->iImageLength = 0;
+	pHash->iValid = 1;
+}
+
+/*
+ *  @brief	기록에 실패한 DATA가 있어 받은 byte와 메모리 내용이 다를 수 있을 때 호출.
+ *			END에서는 fImageHashFinish()가 실패하므로 메모리에서 다시 계산한다
+ *  @param	pHash	hash 상태
+ *  @retval	None
+ */
+void fImageHashDiscard(ImageHashTypeDef *pHash)
+{
+	pHash->iValid = 0;
+}
+
+/*
+ *  @brief	checksum이 맞는 DATA payload를 hash에 넣는다. header 앞부분은 모아서 넣고 서명, 예약 영역과
+ *			이미지 뒤 padding은 건너뛴다. 다시 온 패킷은 무시하고, 중간이 빠지면 (RESUME) 더 계산하지 않는다
+ *  @param	pHash	hash 상태
+ *			iOffset	partition (RAM load 영역) 시작 기준 payload 위치
+ *			sData	payload
+ *			iLength	payload 길이
+ *  @retval	None
+ */
+void fImageHashFeed(ImageHashTypeDef *pHash, uint32_t iOffset, const uint8_t *sData, uint32_t iLength)
+{
+	uint32_t iSkip, iCount, iStartCycle;
+
+	if ((pHash->iValid == 0) || (iOffset + iLength <= pHash->iNextOffset))
+	{
+		return;
+	}
+	if (iOffset > pHash->iNextOffset)
+	{
+		pHash->iValid = 0;
+		return;
+	}
+
+	// 이미 넣은 앞부분 제외
+	iSkip = pHash->iNextOffset - iOffset;
+	iOffset += iSkip;
+	sData += iSkip;
+	iLength -= iSkip;
+	pHash->iNextOffset = iOffset + iLength;
+
+	if (iOffset < IMAGE_SIGNED_HEADER_SIZE)
+	{
+		iCount = IMAGE_SIGNED_HEADER_SIZE - iOffset;
+		iCount = (iCount < iLength) ? iCount : iLength;
+		memcpy(&pHash->sHeader[iOffset], sData, iCount);
+		if (iOffset + iCount == IMAGE_SIGNED_HEADER_SIZE)
+		{
+			fSha256Update(&pHash->sSha, pHash->sHeader, IMAGE_SIGNED_HEADER_SIZE);
+			memcpy(&pHash->iImageLength, &pHash->sHeader[offsetof(ImageHeaderTypeDef, iImageLength)], sizeof(pHash->iImageLength));
+		}
+	}
+
+	if (iOffset + iLength <= IMAGE_HEADER_SIZE)
+	{
+		return;
+	}
+	if (iOffset < IMAGE_HEADER_SIZE)
+	{
+		iSkip = IMAGE_HEADER_SIZE - iOffset;
+		iOffset += iSkip;
+		sData += iSkip;
+		iLength -= iSkip;
+	}
+
+	// 마지막 패킷의 padding 제외
+	iOffset -= IMAGE_HEADER_SIZE;
+	if (iOffset >= pHash->iImageLength)
+	{
+		return;
+	}
+	iCount = pHash->iImageLength - iOffset;
+	iCount = (iCount < iLength) ? iCount : iLength;
+
+	iStartCycle = fPerfStart();
+	fSha256Update(&pHash->sSha, sData, iCount);
+	fPerfStop(PERF_IMAGE_HASH, iStartCycle, iCount);
+}
+
+/*
+ *  @brief	hash 결과. 이미지 끝까지 빠짐없이 받았을 때만 쓸 수 있다
+ *  @param	pHash	hash 상태
+ *			sDigest	결과 32 Byte를 돌려 줄 버퍼
+ *  @retval	0 : 결과 있음, -1 : 중간이 빠졌거나 덜 받음 (메모리에서 다시 계산해야 한다)
+ */
+int fImageHashFinish(ImageHashTypeDef *pHash, uint8_t *sDigest)
+{
+	if ((pHash->iValid == 0) || (pHash->iNextOffset < IMAGE_HEADER_SIZE + pHash->iImageLength))
+	{
+		return -1;
+	}
+	pHash->iValid = 0;
+	fSha256Final(&pHash->sSha, sDigest);
+	return 0;
+}
+
+/*
+ *  @brief	Application vector table 주소. fImageValidate 통과 후에 사용
+ *  @param	Address	header 주소
+ *  @retval	vector table 주소
+ */
+uint32_t fImageGetEntryPoint(uint32_t Address)
+{
+	return ((const ImageHeaderTypeDef *)Address)->iEntryPoint;
+}
@@ -0,0 +1,171 @@
+/*
+ * journal.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "bkpsram.h"
+#include "journal.h"
+
+// Backup SRAM에 위치한 journal
+#define JOURNAL		((volatile JournalTypeDef *)BKPSRAM_JOURNAL_ADDRESS)
+
+/*
+ *  @brief	journal 검증 값 계산
+ *  @param	None
+ *  @retval	검증 값
+ */
+static uint32_t fJournalCheck(void)
+{
+	return ~(JOURNAL->iMagic ^ JOURNAL->iPacketSize ^ JOURNAL->iPacketCount ^ JOURNAL->iHasImageCrc ^ JOURNAL->iImageCrc);
+}
+
+/*
+ *  @brief	두 slot 중 유효한 기록 완료 개수를 읽는다. 둘 다 유효하면 큰 값
+ *  @param	iCommittedCount	기록 완료된 패킷 수를 돌려 줄 변수 주소
+ *  @retval	유효한 slot이 있으면 0, 없으면 -1
+ */
+static int fJournalReadCommitted(uint32_t *iCommittedCount)
+{
+	int iFound = -1;
+
+	*iCommittedCount = 0;
+	for (int i = 0; i < 2; i++)
+	{
+		uint32_t iCount = JOURNAL->sSlot[i].iCommittedCount;
+
+		if ((JOURNAL->sSlot[i].iCommittedCheck != ~iCount) || (iCount > JOURNAL->iPacketCount))
+		{
+			continue;
+		}
+		if (iCount > *iCommittedCount)
+		{
+			*iCommittedCount = iCount;
+		}
+		iFound = 0;
+	}
+	return iFound;
+}
+
+/*
+ *  @brief	journal 사용 준비. Backup SRAM 접근 허용
+ *  @param	None
+ *  @retval	None
+ */
+void fJournalInit(void)
+{
+	fBackupSramInit();
+}
+
+/*
+ *  @brief	새 업데이트 시작 기록. Application 영역 지운 직후 호출
+ *  @param	iPacketSize		INFO로 받은 패킷 크기
+ *			iPacketCount	INFO로 받은 패킷 개수
+ *			iHasImageCrc	INFO에 이미지 CRC가 있으면 1, 없으면 0
+ *			iImageCrc		INFO로 받은 이미지 CRC
+ *  @retval	None
+ */
+void fJournalStart(uint32_t iPacketSize, uint32_t iPacketCount, int iHasImageCrc, uint32_t iImageCrc)
+{
+	// 기록 도중 리셋되어도 유효하게 보이지 않도록 magic은 마지막에 쓴다
+	JOURNAL->iMagic = 0;
+	JOURNAL->iPacketSize = iPacketSize;
+	JOURNAL->iPacketCount = iPacketCount;
+	JOURNAL->iHasImageCrc = (iHasImageCrc != 0) ? 1 : 0;
+	JOURNAL->iImageCrc = (iHasImageCrc != 0) ? iImageCrc : 0;
+	for (int i = 0; i < 2; i++)
+	{
+		JOURNAL->sSlot[i].iCommittedCount = 0;
+		JOURNAL->sSlot[i].iCommittedCheck = ~0U;
+	}
+	JOURNAL->iMagic = JOURNAL_MAGIC;
+	JOURNAL->iCheck = fJournalCheck();
+}
+
+/*
+ *  @brief	DATA 패킷 기록 완료 표시. 순서대로 이어지는 패킷만 반영한다
+ *  @param	iPacketIndex	Flash 기록과 checksum 확인이 끝난 패킷 번호 (1부터 시작)
+ *  @retval	None
+ */
+void fJournalCommit(uint32_t iPacketIndex)
+{
+	uint32_t iCommittedCount;
+	volatile JournalSlotTypeDef *pSlot;
+
+	if ((fJournalIsActive() == 0) || (fJournalReadCommitted(&iCommittedCount) != 0))
+	{
+		return;
+	}
+
+	// 재전송된 패킷이나 건너뛴 패킷은 무시
+	if (iPacketIndex != iCommittedCount + 1)
+	{
+		return;
+	}
+
+	// 직전 값이 든 slot은 건드리지 않는다. 두 word 사이에서 리셋되면 이 slot만 무효가 된다
+	pSlot = &JOURNAL->sSlot[iPacketIndex & 1];
+	pSlot->iCommittedCount = iPacketIndex;
+	pSlot->iCommittedCheck = ~iPacketIndex;
+}
+
+/*
+ *  @brief	업데이트 완료 또는 취소 시 journal 무효화
+ *  @param	None
+ *  @retval	None
+ */
+void fJournalClear(void)
+{
+	JOURNAL->iMagic = 0;
+	JOURNAL->iCheck = 0;
+}
+
+/*
+ *  @brief	끝나지 않은 업데이트가 journal에 남아 있는지 확인
+ *  @param	None
+ *  @retval	진행중이면 1, 아니면 0
+ */
+int fJournalIsActive(void)
+{
+	uint32_t iCommittedCount;
+
+	if ((JOURNAL->iMagic != JOURNAL_MAGIC) || (JOURNAL->iCheck != fJournalCheck()))
+	{
+		return 0;
+	}
+	if ((fJournalReadCommitted(&iCommittedCount) != 0) || (iCommittedCount >= JOURNAL->iPacketCount))
+	{
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ *  @brief	RESUME 요청이 journal 내용과 같은 업데이트인지 확인.
+ *			크기와 개수가 같은 다른 이미지에 이어 쓰지 않도록 이미지 CRC도 같아야 한다
+ *  @param	iPacketSize		RESUME으로 받은 패킷 크기
+ *			iPacketCount	RESUME으로 받은 패킷 개수
+ *			iHasImageCrc	RESUME에 이미지 CRC가 있으면 1, 없으면 0
+ *			iImageCrc		RESUME으로 받은 이미지 CRC
+ *			iCommittedCount	기록 완료된 패킷 수를 돌려 줄 변수 주소
+ *  @retval	이어서 받을 수 있으면 0, 처음부터 다시 해야 하면 -1
+ */
+int fJournalResume(uint32_t iPacketSize, uint32_t iPacketCount, int iHasImageCrc, uint32_t iImageCrc, uint32_t *iCommittedCount)
+{
+	if (fJournalIsActive() == 0)
+	{
+		return -1;
+	}
+	if ((JOURNAL->iPacketSize != iPacketSize) || (JOURNAL->iPacketCount != iPacketCount))
+	{
+		return -1;
+	}
+	if ((JOURNAL->iHasImageCrc != ((iHasImageCrc != 0) ? 1U : 0U)) || ((iHasImageCrc != 0) && (JOURNAL->iImageCrc != iImageCrc)))
+	{
+		return -1;
+	}
+
+	return fJournalReadCommitted(iCommittedCount);
+}
@@ -0,0 +1,477 @@
+/*
+ * loadfile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "loadfile.h"
+
+#include <string.h>
+
+// ELF header field 위치 (ELF32)
+#define ELF_EI_CLASS					4
+#define ELF_EI_DATA						5
+#define ELF_E_PHOFF						28
+#define ELF_E_PHENTSIZE					42
+#define ELF_E_PHNUM						44
+// program header field 위치
+#define ELF_P_TYPE						0
+#define ELF_P_OFFSET					4
+#define ELF_P_PADDR						12
+#define ELF_P_FILESZ					16
+#define ELF_PT_LOAD						1
+
+// HEX record field 위치와 type
+#define HEX_LENGTH						0
+#define HEX_ADDRESS						1
+#define HEX_TYPE						3
+#define HEX_DATA						4
+#define HEX_TYPE_DATA					0x00
+#define HEX_TYPE_EOF					0x01
+#define HEX_TYPE_SEGMENT				0x02
+#define HEX_TYPE_START_SEGMENT			0x03
+#define HEX_TYPE_LINEAR					0x04
+#define HEX_TYPE_START_LINEAR			0x05
+
+/*
+ *  @brief	little endian 값 읽기
+ */
+static uint32_t fLoadFileRead32(const uint8_t *sData)
+{
+	return (uint32_t)sData[0] | ((uint32_t)sData[1] << 8) | ((uint32_t)sData[2] << 16) | ((uint32_t)sData[3] << 24);
+}
+
+static uint32_t fLoadFileRead16(const uint8_t *sData)
+{
+	return (uint32_t)sData[0] | ((uint32_t)sData[1] << 8);
+}
+
+/*
+ *  @brief	ELF header 확인 후 program header 읽을 준비
+ *  @param	pLoad	parser 상태
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileElfHeader(LoadFileTypeDef *pLoad)
+{
+	const uint8_t *sHeader = pLoad->uFormat.sElf.sBuffer;
+
+	if ((sHeader[1] != 'E') || (sHeader[2] != 'L') || (sHeader[3] != 'F'))
+	{
+		return LOADFILE_ERROR_FORMAT;
+	}
+	// ELFCLASS32, ELFDATA2LSB
+	if ((sHeader[ELF_EI_CLASS] != 1) || (sHeader[ELF_EI_DATA] != 1))
+	{
+		return LOADFILE_ERROR_UNSUPPORTED;
+	}
+
+	pLoad->uFormat.sElf.iPhOffset = fLoadFileRead32(&sHeader[ELF_E_PHOFF]);
+	pLoad->uFormat.sElf.iPhEntrySize = fLoadFileRead16(&sHeader[ELF_E_PHENTSIZE]);
+	pLoad->uFormat.sElf.iPhCount = fLoadFileRead16(&sHeader[ELF_E_PHNUM]);
+
+	if ((pLoad->uFormat.sElf.iPhCount == 0) || (pLoad->uFormat.sElf.iPhEntrySize < LOADFILE_ELF_PHDR_SIZE))
+	{
+		return LOADFILE_ERROR_FORMAT;
+	}
+	// 한번 지나간 위치는 다시 읽을 수 없다
+	if (pLoad->uFormat.sElf.iPhOffset < LOADFILE_ELF_HEADER_SIZE)
+	{
+		return LOADFILE_ERROR_ORDER;
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	program header 하나 처리. file 부분이 있는 PT_LOAD만 segment 목록에 넣는다
+ *  @param	pLoad	parser 상태
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileElfProgramHeader(LoadFileTypeDef *pLoad)
+{
+	const uint8_t *sPhdr = pLoad->uFormat.sElf.sBuffer;
+	LoadFileSegmentTypeDef sSegment;
+	uint32_t i;
+
+	if ((fLoadFileRead32(&sPhdr[ELF_P_TYPE]) != ELF_PT_LOAD) || (fLoadFileRead32(&sPhdr[ELF_P_FILESZ]) == 0))
+	{
+		return LOADFILE_OK;
+	}
+	if (pLoad->uFormat.sElf.iSegmentCount >= LOADFILE_ELF_SEGMENT_MAX)
+	{
+		return LOADFILE_ERROR_UNSUPPORTED;
+	}
+
+	sSegment.iOffset = fLoadFileRead32(&sPhdr[ELF_P_OFFSET]);
+	sSegment.iFileSize = fLoadFileRead32(&sPhdr[ELF_P_FILESZ]);
+	sSegment.iAddress = fLoadFileRead32(&sPhdr[ELF_P_PADDR]);
+
+	// file offset 순서로 넣는다 (삽입 정렬, segment 수가 적다)
+	i = pLoad->uFormat.sElf.iSegmentCount;
+	while ((i > 0) && (pLoad->uFormat.sElf.sSegment[i - 1].iOffset > sSegment.iOffset))
+	{
+		pLoad->uFormat.sElf.sSegment[i] = pLoad->uFormat.sElf.sSegment[i - 1];
+		i--;
+	}
+	pLoad->uFormat.sElf.sSegment[i] = sSegment;
+	pLoad->uFormat.sElf.iSegmentCount++;
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	program header를 모두 읽은 뒤 segment 목록 확인
+ *  @param	pLoad	parser 상태
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileElfCheckSegments(LoadFileTypeDef *pLoad)
+{
+	const LoadFileSegmentTypeDef *pSegment = pLoad->uFormat.sElf.sSegment;
+	uint32_t i;
+
+	if (pLoad->uFormat.sElf.iSegmentCount == 0)
+	{
+		return LOADFILE_ERROR_FORMAT;
+	}
+	// 첫 segment data는 아직 지나가지 않았어야 하고 segment끼리 file 범위가 겹치면 안된다
+	if (pSegment[0].iOffset < pLoad->iOffset)
+	{
+		return LOADFILE_ERROR_ORDER;
+	}
+	for (i = 1; i < pLoad->uFormat.sElf.iSegmentCount; i++)
+	{
+		if (pSegment[i].iOffset - pSegment[i - 1].iOffset < pSegment[i - 1].iFileSize)
+		{
+			return LOADFILE_ERROR_ORDER;
+		}
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	ELF 파일 일부 처리
+ *  @param	pLoad	parser 상태
+ *			sData	받은 data
+ *			iLength	data 길이
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileElfFeed(LoadFileTypeDef *pLoad, const uint8_t *sData, uint32_t iLength)
+{
+	uint32_t iPhEnd;
+	uint32_t iCount;
+	int res;
+	const LoadFileSegmentTypeDef *pSegment;
+
+	while ((iLength > 0) && (pLoad->iDone == 0))
+	{
+		iPhEnd = pLoad->uFormat.sElf.iPhOffset + (pLoad->uFormat.sElf.iPhCount * pLoad->uFormat.sElf.iPhEntrySize);
+
+		// ELF header
+		if (pLoad->iOffset < LOADFILE_ELF_HEADER_SIZE)
+		{
+			iCount = LOADFILE_ELF_HEADER_SIZE - pLoad->iOffset;
+			iCount = (iCount < iLength) ? iCount : iLength;
+			memcpy(&pLoad->uFormat.sElf.sBuffer[pLoad->iOffset], sData, iCount);
+			pLoad->iOffset += iCount;
+			if (pLoad->iOffset == LOADFILE_ELF_HEADER_SIZE)
+			{
+				res = fLoadFileElfHeader(pLoad);
+				if (res != LOADFILE_OK)
+				{
+					return res;
+				}
+			}
+		}
+		// program header table 앞은 버린다
+		else if (pLoad->iOffset < pLoad->uFormat.sElf.iPhOffset)
+		{
+			iCount = pLoad->uFormat.sElf.iPhOffset - pLoad->iOffset;
+			iCount = (iCount < iLength) ? iCount : iLength;
+			pLoad->iOffset += iCount;
+		}
+		// program header 한 개씩 모아서 처리, 32 Byte 뒤의 나머지 field는 버린다
+		else if (pLoad->iOffset < iPhEnd)
+		{
+			iCount = pLoad->uFormat.sElf.iPhEntrySize - pLoad->uFormat.sElf.iFill;
+			iCount = (iCount < iLength) ? iCount : iLength;
+			if (pLoad->uFormat.sElf.iFill < LOADFILE_ELF_PHDR_SIZE)
+			{
+				uint32_t iCopy = LOADFILE_ELF_PHDR_SIZE - pLoad->uFormat.sElf.iFill;
+				memcpy(&pLoad->uFormat.sElf.sBuffer[pLoad->uFormat.sElf.iFill], sData, (iCopy < iCount) ? iCopy : iCount);
+			}
+			pLoad->uFormat.sElf.iFill += iCount;
+			pLoad->iOffset += iCount;
+
+			if (pLoad->uFormat.sElf.iFill == pLoad->uFormat.sElf.iPhEntrySize)
+			{
+				pLoad->uFormat.sElf.iFill = 0;
+				pLoad->uFormat.sElf.iPhIndex++;
+				res = fLoadFileElfProgramHeader(pLoad);
+				if ((res == LOADFILE_OK) && (pLoad->uFormat.sElf.iPhIndex == pLoad->uFormat.sElf.iPhCount))
+				{
+					res = fLoadFileElfCheckSegments(pLoad);
+				}
+				if (res != LOADFILE_OK)
+				{
+					return res;
+				}
+			}
+		}
+		// segment data, segment 사이와 마지막 segment 뒤는 버린다
+		else
+		{
+			pSegment = &pLoad->uFormat.sElf.sSegment[pLoad->uFormat.sElf.iSegmentIndex];
+			if (pLoad->iOffset < pSegment->iOffset)
+			{
+				iCount = pSegment->iOffset - pLoad->iOffset;
+				iCount = (iCount < iLength) ? iCount : iLength;
+			}
+			else
+			{
+				iCount = pSegment->iOffset + pSegment->iFileSize - pLoad->iOffset;
+				iCount = (iCount < iLength) ? iCount : iLength;
+				res = pLoad->fWrite(pSegment->iAddress + (pLoad->iOffset - pSegment->iOffset), sData, iCount);
+				if (res != LOADFILE_OK)
+				{
+					return res;
+				}
+				if (pLoad->iOffset + iCount == pSegment->iOffset + pSegment->iFileSize)
+				{
+					pLoad->uFormat.sElf.iSegmentIndex++;
+					if (pLoad->uFormat.sElf.iSegmentIndex == pLoad->uFormat.sElf.iSegmentCount)
+					{
+						pLoad->iDone = 1;
+					}
+				}
+			}
+			pLoad->iOffset += iCount;
+		}
+
+		sData += iCount;
+		iLength -= iCount;
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	HEX record 하나 처리
+ *  @param	pLoad	parser 상태
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileHexRecord(LoadFileTypeDef *pLoad)
+{
+	const uint8_t *sRecord = pLoad->uFormat.sHex.sRecord;
+	uint32_t iFill = pLoad->uFormat.sHex.iFill;
+	uint8_t iSum = 0;
+	uint32_t i;
+
+	if ((iFill < 5) || (iFill != 5U + sRecord[HEX_LENGTH]))
+	{
+		return LOADFILE_ERROR_FORMAT;
+	}
+	// 모든 byte 합 (checksum 포함)이 0이어야 한다
+	for (i = 0; i < iFill; i++)
+	{
+		iSum += sRecord[i];
+	}
+	if (iSum != 0)
+	{
+		return LOADFILE_ERROR_CHECKSUM;
+	}
+
+	switch (sRecord[HEX_TYPE])
+	{
+	case HEX_TYPE_DATA:
+		if (sRecord[HEX_LENGTH] == 0)
+		{
+			return LOADFILE_OK;
+		}
+		return pLoad->fWrite(pLoad->uFormat.sHex.iBase + ((uint32_t)sRecord[HEX_ADDRESS] << 8) + sRecord[HEX_ADDRESS + 1], &sRecord[HEX_DATA], sRecord[HEX_LENGTH]);
+
+	case HEX_TYPE_EOF:
+		pLoad->iDone = 1;
+		return LOADFILE_OK;
+
+	case HEX_TYPE_SEGMENT:
+		if (sRecord[HEX_LENGTH] != 2)
+		{
+			return LOADFILE_ERROR_FORMAT;
+		}
+		pLoad->uFormat.sHex.iBase = (((uint32_t)sRecord[HEX_DATA] << 8) | sRecord[HEX_DATA + 1]) << 4;
+		return LOADFILE_OK;
+
+	case HEX_TYPE_LINEAR:
+		if (sRecord[HEX_LENGTH] != 2)
+		{
+			return LOADFILE_ERROR_FORMAT;
+		}
+		pLoad->uFormat.sHex.iBase = (((uint32_t)sRecord[HEX_DATA] << 8) | sRecord[HEX_DATA + 1]) << 16;
+		return LOADFILE_OK;
+
+	case HEX_TYPE_START_SEGMENT:
+	case HEX_TYPE_START_LINEAR:
+		// 시작 주소는 image header (vector table)로 정해지므로 무시
+		return LOADFILE_OK;
+
+	default:
+		return LOADFILE_ERROR_UNSUPPORTED;
+	}
+}
+
+/*
+ *  @brief	HEX 파일 일부 처리. 글자 단위로 record를 모으고 줄이 끝나면 record를 처리한다
+ *  @param	pLoad	parser 상태
+ *			sData	받은 data
+ *			iLength	data 길이
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFileHexFeed(LoadFileTypeDef *pLoad, const uint8_t *sData, uint32_t iLength)
+{
+	uint8_t cData;
+	uint8_t iValue;
+	int res;
+
+	while ((iLength > 0) && (pLoad->iDone == 0))
+	{
+		cData = *sData++;
+		iLength--;
+		pLoad->iOffset++;
+
+		if ((cData >= '0') && (cData <= '9'))
+		{
+			iValue = cData - '0';
+		}
+		else if ((cData >= 'A') && (cData <= 'F'))
+		{
+			iValue = cData - 'A' + 10;
+		}
+		else if ((cData >= 'a') && (cData <= 'f'))
+		{
+			iValue = cData - 'a' + 10;
+		}
+		else
+		{
+			iValue = 0xFF;
+		}
+
+		if (pLoad->uFormat.sHex.iInRecord == 0)
+		{
+			// record 사이에는 ':'와 줄바꿈만 올 수 있다
+			if (cData == ':')
+			{
+				pLoad->uFormat.sHex.iInRecord = 1;
+				pLoad->uFormat.sHex.iFill = 0;
+				pLoad->uFormat.sHex.iNibble = 0;
+			}
+			else if ((cData != '\r') && (cData != '\n'))
+			{
+				return LOADFILE_ERROR_FORMAT;
+			}
+		}
+		else if (iValue != 0xFF)
+		{
+			if (pLoad->uFormat.sHex.iNibble == 0)
+			{
+				pLoad->uFormat.sHex.iNibble = 0x10 | iValue;
+			}
+			else
+			{
+				if (pLoad->uFormat.sHex.iFill >= LOADFILE_HEX_RECORD_MAX)
+				{
+					return LOADFILE_ERROR_FORMAT;
+				}
+				pLoad->uFormat.sHex.sRecord[pLoad->uFormat.sHex.iFill++] = (uint8_t)(((pLoad->uFormat.sHex.iNibble & 0x0F) << 4) | iValue);
+				pLoad->uFormat.sHex.iNibble = 0;
+			}
+		}
+		else
+		{
+			// 16진수가 아닌 글자 (줄바꿈)에서 record가 끝난다
+			if (pLoad->uFormat.sHex.iNibble != 0)
+			{
+				return LOADFILE_ERROR_FORMAT;
+			}
+			pLoad->uFormat.sHex.iInRecord = 0;
+			res = fLoadFileHexRecord(pLoad);
+			if (res != LOADFILE_OK)
+			{
+				return res;
+			}
+		}
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	새 파일 받기 시작
+ *  @param	pLoad	parser 상태
+ *			fWrite	segment data를 기록할 함수
+ *  @retval	None
+ */
+void fLoadFileStart(LoadFileTypeDef *pLoad, LoadFileWriteTypeDef fWrite)
+{
+	memset(pLoad, 0x00, sizeof(LoadFileTypeDef));
+	pLoad->fWrite = fWrite;
+	pLoad->iFormat = LOADFILE_FORMAT_UNKNOWN;
+}
+
+/*
+ *  @brief	이어서 받은 파일 data 처리. 파일이 끝난 뒤 (마지막 패킷 남는 부분)는 무시한다
+ *  @param	pLoad	parser 상태
+ *			sData	받은 data
+ *			iLength	data 길이
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+int fLoadFileFeed(LoadFileTypeDef *pLoad, const uint8_t *sData, uint32_t iLength)
+{
+	if (iLength == 0)
+	{
+		return LOADFILE_OK;
+	}
+
+	// 첫 byte로 형식 결정
+	if (pLoad->iFormat == LOADFILE_FORMAT_UNKNOWN)
+	{
+		if (sData[0] == 0x7F)
+		{
+			pLoad->iFormat = LOADFILE_FORMAT_ELF;
+		}
+		else if (sData[0] == ':')
+		{
+			pLoad->iFormat = LOADFILE_FORMAT_HEX;
+		}
+		else
+		{
+			return LOADFILE_ERROR_FORMAT;
+		}
+	}
+
+	if (pLoad->iFormat == LOADFILE_FORMAT_ELF)
+	{
+		return fLoadFileElfFeed(pLoad, sData, iLength);
+	}
+	return fLoadFileHexFeed(pLoad, sData, iLength);
+}
+
+/*
+ *  @brief	파일 끝 확인. 줄바꿈 없이 끝난 HEX 마지막 record는 여기서 처리한다
+ *  @param	pLoad	parser 상태
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+int fLoadFileFinish(LoadFileTypeDef *pLoad)
+{
+	int res;
+
+	if ((pLoad->iFormat == LOADFILE_FORMAT_HEX) && (pLoad->iDone == 0) && (pLoad->uFormat.sHex.iInRecord == 1))
+	{
+		if (pLoad->uFormat.sHex.iNibble != 0)
+		{
+			return LOADFILE_ERROR_FORMAT;
+		}
+		pLoad->uFormat.sHex.iInRecord = 0;
+		res = fLoadFileHexRecord(pLoad);
+		if (res != LOADFILE_OK)
+		{
+			return res;
+		}
+	}
+	return (pLoad->iDone == 1) ? LOADFILE_OK : LOADFILE_ERROR_INCOMPLETE;
+}
@@ -0,0 +1,320 @@
+/*
+ * loadflash.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "bootcode.h"
+#include "flashram.h"
+#include "partition.h"
+#include "image.h"
+#include "hwcrc.h"
+#include "log.h"
+#include "arena.h"
+#include "loadflash.h"
+
+#include <string.h>
+
+// image header 뒤, Application vector table 주소
+#define LOADFLASH_ENTRY_ADDRESS			(PARTITION_APPLICATION_ADDRESS + IMAGE_HEADER_SIZE)
+
+// write-combine 버퍼 첫 byte의 Flash 주소 (word 정렬)와 채운 byte 수
+static uint32_t iLoadCombineAddress;
+static uint32_t iLoadCombineFill;
+// 이번 업데이트에서 지웠거나 이미 비어 있던 sector (bit 번호 = sector 번호)
+static uint32_t iLoadErasedSectors;
+// 기록한 가장 높은 주소 + 1
+static uint32_t iLoadEndAddress;
+// 마지막으로 실패한 주소
+static uint32_t iLoadErrorAddress;
+// "[SIGNATURE]"로 받은 서명, image header에 같이 기록한다. 받지 않았으면 0xFF (Flash에 쓰지 않는다)
+static uint32_t sLoadSignature[IMAGE_SIGNATURE_SIZE / 4];
+
+/*
+ *  @brief	주소 범위가 걸친 sector 중 아직 지우지 않은 sector를 지운다. 이미 비어 있으면 생략
+ *  @param	Address	시작 주소
+ *			iSize	크기 (Byte)
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_FLASH
+ */
+static int fLoadFlashPrepare(uint32_t Address, uint32_t iSize)
+{
+	int32_t iFirst = fPartitionGetSector(Address);
+	int32_t iLast = fPartitionGetSector(Address + iSize - 1);
+	const FlashSectorTypeDef *pSector;
+	HAL_StatusTypeDef res;
+
+	if ((iFirst < 0) || (iLast < 0))
+	{
+		iLoadErrorAddress = Address;
+		return LOADFILE_ERROR_FLASH;
+	}
+
+	for (int32_t Sector = iFirst; Sector <= iLast; Sector++)
+	{
+		if ((iLoadErasedSectors & (1UL << Sector)) != 0)
+		{
+			continue;
+		}
+
+		pSector = &sFlashSectorTable[Sector];
+		if (fFlashIsBlank(pSector->iAddress, pSector->iSize) == 0)
+		{
+			res = fFlashEraseSector(Sector);
+			// erase 된 영역이 cache에 남아 있지 않도록 정리
+			FLASH_FlushCaches();
+			if (res != HAL_OK)
+			{
+				fLog(LOG_FLASH_ERASE_ERROR, 1, res);
+				iLoadErrorAddress = pSector->iAddress;
+				return LOADFILE_ERROR_FLASH;
+			}
+		}
+		iLoadErasedSectors |= (1UL << Sector);
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	write-combine 버퍼 기록. 마지막 word의 빈 byte는 0xFF로 채운다
+ *  @param	None
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_FLASH
+ */
+static int fLoadFlashFlush(void)
+{
+	uint8_t *sCombine = (uint8_t *)sArena.uPhase.sLoadCombine;
+	uint32_t iLength;
+	int res;
+
+	if (iLoadCombineFill == 0)
+	{
+		return LOADFILE_OK;
+	}
+
+	while ((iLoadCombineFill % 4) != 0)
+	{
+		sCombine[iLoadCombineFill++] = 0xFF;
+	}
+	iLength = iLoadCombineFill;
+	iLoadCombineFill = 0;
+
+	res = fLoadFlashPrepare(iLoadCombineAddress, iLength);
+	if (res != LOADFILE_OK)
+	{
+		return res;
+	}
+	if (flash_wrtie(iLoadCombineAddress, iLoadCombineAddress + iLength, sArena.uPhase.sLoadCombine) != 0)
+	{
+		iLoadErrorAddress = iLoadCombineAddress;
+		return LOADFILE_ERROR_FLASH;
+	}
+
+	if (iLoadCombineAddress + iLength > iLoadEndAddress)
+	{
+		iLoadEndAddress = iLoadCombineAddress + iLength;
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	loadfile.c가 넘겨준 segment data 기록 (LoadFileWriteTypeDef)
+ *  @param	Address	기록할 주소
+ *			sData	data
+ *			iLength	data 길이
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+static int fLoadFlashWrite(uint32_t Address, const uint8_t *sData, uint32_t iLength)
+{
+	uint8_t *sCombine = (uint8_t *)sArena.uPhase.sLoadCombine;
+	uint32_t iCount;
+	int res;
+
+	// image header는 END에서 bootloader가 만든다
+	if ((Address < LOADFLASH_ENTRY_ADDRESS) || (fPartitionContains(PARTITION_APPLICATION, Address, iLength) == 0))
+	{
+		iLoadErrorAddress = Address;
+		return LOADFILE_ERROR_ADDRESS;
+	}
+
+	if (iLoadCombineFill > 0)
+	{
+		// 버퍼 끝과 같은 word 안에서 몇 byte 떨어진 data는 사이를 0xFF로 채워 이어 붙인다
+		if ((Address > iLoadCombineAddress + iLoadCombineFill) && ((iLoadCombineFill % 4) != 0)
+			&& ((Address & ~3UL) == ((iLoadCombineAddress + iLoadCombineFill) & ~3UL)))
+		{
+			while (iLoadCombineAddress + iLoadCombineFill < Address)
+			{
+				sCombine[iLoadCombineFill++] = 0xFF;
+			}
+		}
+		// 이어지지 않으면 버퍼를 먼저 기록
+		else if (Address != iLoadCombineAddress + iLoadCombineFill)
+		{
+			res = fLoadFlashFlush();
+			if (res != LOADFILE_OK)
+			{
+				return res;
+			}
+		}
+	}
+
+	while (iLength > 0)
+	{
+		// 새로 시작하는 버퍼는 word 정렬 주소부터, 앞의 빈 byte는 0xFF
+		if (iLoadCombineFill == 0)
+		{
+			iLoadCombineAddress = Address & ~3UL;
+			while (iLoadCombineAddress + iLoadCombineFill < Address)
+			{
+				sCombine[iLoadCombineFill++] = 0xFF;
+			}
+		}
+
+		iCount = LOADFLASH_COMBINE_SIZE - iLoadCombineFill;
+		iCount = (iCount < iLength) ? iCount : iLength;
+		memcpy(&sCombine[iLoadCombineFill], sData, iCount);
+		iLoadCombineFill += iCount;
+		Address += iCount;
+		sData += iCount;
+		iLength -= iCount;
+
+		if (iLoadCombineFill == LOADFLASH_COMBINE_SIZE)
+		{
+			res = fLoadFlashFlush();
+			if (res != LOADFILE_OK)
+			{
+				return res;
+			}
+		}
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	파일 업데이트 시작. Flash 세션이 열린 뒤에 호출한다.
+ *			image header가 있는 첫 sector를 지워서 끝나기 전에는 Application으로 넘어가지 않게 한다
+ *  @param	None
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_FLASH
+ */
+int fLoadFlashStart(void)
+{
+	iLoadCombineAddress = 0;
+	iLoadCombineFill = 0;
+	iLoadErasedSectors = 0;
+	iLoadEndAddress = LOADFLASH_ENTRY_ADDRESS;
+	iLoadErrorAddress = 0;
+	memset(sLoadSignature, 0xFF, sizeof(sLoadSignature));
+
+	fLoadFileStart(&sArena.uPhase.sLoadFile, fLoadFlashWrite);
+
+	// 지우기 시작하면 이전 검증 결과는 더 이상 맞지 않는다
+	fImageCacheInvalidate();
+	return fLoadFlashPrepare(PARTITION_APPLICATION_ADDRESS, IMAGE_HEADER_SIZE);
+}
+
+/*
+ *  @brief	checksum이 맞는 DATA payload를 순서대로 넘긴다
+ *  @param	sData	payload
+ *			iLength	payload 길이
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+int fLoadFlashFeed(const uint8_t *sData, uint32_t iLength)
+{
+	return fLoadFileFeed(&sArena.uPhase.sLoadFile, sData, iLength);
+}
+
+/*
+ *  @brief	host가 보낸 이미지 서명 저장. fLoadFlashFinish()가 image header에 같이 기록한다
+ *  @param	sSignature	서명 r || s 64 Byte
+ *  @retval	None
+ */
+void fLoadFlashSetSignature(const uint8_t *sSignature)
+{
+	memcpy(sLoadSignature, sSignature, sizeof(sLoadSignature));
+}
+
+/*
+ *  @brief	마지막 DATA 뒤 처리. 남은 버퍼 기록, data가 없던 중간 sector 지우기, 기록된 범위 CRC 계산 후
+ *			image header와 서명 기록
+ *  @param	iHasImageCrc	host가 이미지 CRC를 보냈으면 1
+ *			iImageCrc		host가 보낸 CRC (header 뒤, 빈 곳을 0xFF로 채운 이미지 기준)
+ *			iFlashCrc		Flash에서 계산한 CRC를 돌려 줄 변수 주소
+ *  @retval	LOADFILE_OK 또는 LOADFILE_ERROR_xxx
+ */
+int fLoadFlashFinish(int iHasImageCrc, uint32_t iImageCrc, uint32_t *iFlashCrc)
+{
+	// image header 앞 6 field와 그 CRC, 서명. CRC 유닛 DMA가 읽어야 하므로 CCMRAM이 아닌 stack에 둔다
+	uint32_t sHeader[(IMAGE_SIGNED_HEADER_SIZE + IMAGE_SIGNATURE_SIZE) / 4];
+	uint32_t iLength;
+	int res;
+
+	*iFlashCrc = 0;
+
+	res = fLoadFileFinish(&sArena.uPhase.sLoadFile);
+	if (res == LOADFILE_OK)
+	{
+		res = fLoadFlashFlush();
+	}
+	if (res != LOADFILE_OK)
+	{
+		return res;
+	}
+
+	// reset vector가 없으면 실행할 수 없다
+	if ((iLoadEndAddress < LOADFLASH_ENTRY_ADDRESS + 8) || (*(__IO uint32_t *)(LOADFLASH_ENTRY_ADDRESS + 4) == 0xFFFFFFFF))
+	{
+		iLoadErrorAddress = LOADFLASH_ENTRY_ADDRESS;
+		return LOADFILE_ERROR_ENTRY;
+	}
+
+	// 보내지 않은 빈 곳에 이전 Application이 남지 않도록 기록 범위 안의 sector는 모두 지운 상태로
+	iLength = iLoadEndAddress - LOADFLASH_ENTRY_ADDRESS;
+	res = fLoadFlashPrepare(LOADFLASH_ENTRY_ADDRESS, iLength);
+	if (res != LOADFILE_OK)
+	{
+		return res;
+	}
+
+	*iFlashCrc = fCrcCalculate(LOADFLASH_ENTRY_ADDRESS, iLength);
+	if ((iHasImageCrc == 1) && (*iFlashCrc != iImageCrc))
+	{
+		return LOADFILE_ERROR_CRC;
+	}
+
+	// mkimage.py와 같은 header, version은 LOADFILE에 없으므로 0
+	sHeader[0] = IMAGE_MAGIC;
+	sHeader[1] = IMAGE_HEADER_SIZE;
+	sHeader[2] = iLength;
+	sHeader[3] = 0;
+	sHeader[4] = *iFlashCrc;
+	sHeader[5] = LOADFLASH_ENTRY_ADDRESS;
+	sHeader[6] = fCrcCalculate((uint32_t)sHeader, 6 * 4);
+	memcpy(&sHeader[IMAGE_SIGNED_HEADER_SIZE / 4], sLoadSignature, sizeof(sLoadSignature));
+	if (flash_wrtie(PARTITION_APPLICATION_ADDRESS, PARTITION_APPLICATION_ADDRESS + sizeof(sHeader), sHeader) != 0)
+	{
+		iLoadErrorAddress = PARTITION_APPLICATION_ADDRESS;
+		return LOADFILE_ERROR_FLASH;
+	}
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	마지막으로 실패한 주소, "[MCU]LOADFILE,ERROR,..." 보고용
+ *  @param	None
+ *  @retval	주소
+ */
+uint32_t fLoadFlashErrorAddress(void)
+{
+	return iLoadErrorAddress;
+}
+
+/*
+ *  @brief	기록한 이미지 크기 (header 제외)
+ *  @param	None
+ *  @retval	크기 (Byte)
+ */
+uint32_t fLoadFlashImageLength(void)
+{
+	return iLoadEndAddress - LOADFLASH_ENTRY_ADDRESS;
+}
@@ -0,0 +1,108 @@
+/*
+ * log.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "log.h"
+#include "uartio.h"
+
+#include <stdarg.h>
+
+#if (LOG_TOKENIZED == 1)
+// sync + ID + 인자 개수 + 인자당 최대 5 Bytes
+#define LOG_FRAME_MAX_SIZE				(3 + (LOG_MAX_ARGS * 5))
+
+/*
+ *  @brief	ID frame 전송
+ *  @param	eId		메세지 ID
+ *			iArgc	인자 개수
+ *			iArgs	인자 배열
+ *  @retval	None
+ */
+static void fLogWriteFrame(LogIdTypeDef eId, int iArgc, const uint32_t *iArgs)
+{
+	uint8_t sFrame[LOG_FRAME_MAX_SIZE];
+	uint32_t iLength = 0;
+	uint32_t iValue = 0;
+
+	sFrame[iLength++] = LOG_FRAME_SYNC;
+	sFrame[iLength++] = (uint8_t)eId;
+	sFrame[iLength++] = (uint8_t)iArgc;
+
+	// 작은 값이 대부분이므로 7bit 단위 가변 길이로 보낸다
+	for (int i = 0; i < iArgc; i++)
+	{
+		iValue = iArgs[i];
+		while (iValue >= 0x80)
+		{
+			sFrame[iLength++] = (uint8_t)(iValue | 0x80);
+			iValue = iValue >> 7;
+		}
+		sFrame[iLength++] = (uint8_t)iValue;
+	}
+
+	fUartWrite(sFrame, iLength);
+}
+#else
+// 문자열 모드에서만 format을 Flash에 둔다
+static const char * const sLogFormat[LOG_MESSAGE_MAX] =
+{
+#define LOG_MESSAGE(id, format)		format,
+#include "logtable.h"
+#undef LOG_MESSAGE
+};
+
+/*
+ *  @brief	format 문자열대로 문자열 전송
+ *  @param	eId		메세지 ID
+ *			iArgc	인자 개수
+ *			iArgs	인자 배열
+ *  @retval	None
+ */
+static void fLogWriteText(LogIdTypeDef eId, int iArgc, const uint32_t *iArgs)
+{
+	(void)iArgc;
+
+	// format에 없는 인자는 사용되지 않는다
+	fUartPrintFormat(sLogFormat[eId], iArgs[0], iArgs[1], iArgs[2], iArgs[3]);
+	fUartPrint("\r\n");
+}
+#endif
+
+/*
+ *  @brief	메세지 전송
+ *  @param	eId		메세지 ID (logtable.h)
+ *			iArgc	뒤에 오는 인자 개수, format의 % 개수와 같아야 한다
+ *			...		uint32_t 또는 int 인자
+ *  @retval	None
+ */
+void fLog(LogIdTypeDef eId, int iArgc, ...)
+{
+	uint32_t iArgs[LOG_MAX_ARGS] = {0};
+	va_list ap;
+
+	if ((eId >= LOG_MESSAGE_MAX) || (iArgc < 0))
+	{
+		return;
+	}
+	if (iArgc > LOG_MAX_ARGS)
+	{
+		iArgc = LOG_MAX_ARGS;
+	}
+
+	va_start(ap, iArgc);
+	for (int i = 0; i < iArgc; i++)
+	{
+		iArgs[i] = va_arg(ap, uint32_t);
+	}
+	va_end(ap);
+
+#if (LOG_TOKENIZED == 1)
+	fLogWriteFrame(eId, iArgc, iArgs);
+#else
+	fLogWriteText(eId, iArgc, iArgs);
+#endif
+}
@@ -0,0 +1,307 @@
+/*
+ * oledqueue.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+#include "i2c.h"
+
+#include "oledqueue.h"
+#include "arena.h"
+
+#include <string.h>
+
+// frame 앞 길이 field 크기
+#define OLED_FRAME_HEADER				2
+
+DMA_HandleTypeDef hdma_i2c2_tx;
+
+// DMA1이 읽으므로 CCMRAM arena가 아닌 main SRAM, 쓰기 전에 읽지 않으므로 startup 초기화 불필요
+static uint8_t sOledQueue[OLED_QUEUE_SIZE] NOINIT_SECTION;
+// 다음 frame을 쓸 위치, main loop만 변경
+static volatile uint32_t iOledHead = 0;
+// 전송중이거나 다음에 보낼 frame 위치, 인터럽트(와 인터럽트 막은 main loop)만 변경
+static volatile uint32_t iOledTail = 0;
+// DMA 전송 진행 여부
+static volatile uint32_t iOledBusy = 0;
+// I2C 오류로 버린 frame 수
+static volatile uint32_t iOledErrorCount = 0;
+// 마지막으로 queue가 빈 시점 (DWT cycle)
+static volatile uint32_t iOledIdleCycle = 0;
+
+/*
+ *  @brief	queue 맨 앞 frame 전송 시작. 인터럽트가 막힌 상태 또는 전송 완료 인터럽트에서 호출
+ *  @param	None
+ *  @retval	None
+ */
+static void fOledQueueKick(void)
+{
+	uint32_t iLength;
+
+	if (iOledBusy == 1)
+	{
+		return;
+	}
+
+	// 끝에 남은 자리에는 frame이 없다
+	if ((iOledTail != iOledHead) && ((OLED_QUEUE_SIZE - iOledTail < OLED_FRAME_HEADER) ||
+		((sOledQueue[iOledTail] | (sOledQueue[iOledTail + 1] << 8)) == 0)))
+	{
+		iOledTail = 0;
+	}
+	if (iOledTail == iOledHead)
+	{
+		return;
+	}
+
+	iLength = sOledQueue[iOledTail] | (sOledQueue[iOledTail + 1] << 8);
+	if (HAL_I2C_Master_Transmit_DMA(&hi2c2, OLED_I2C_ADDRESS, &sOledQueue[iOledTail + OLED_FRAME_HEADER], iLength) == HAL_OK)
+	{
+		iOledBusy = 1;
+	}
+}
+
+/*
+ *  @brief	전송이 끝난 frame을 queue에서 빼고 다음 frame 전송
+ *  @param	None
+ *  @retval	None
+ */
+static void fOledQueueNext(void)
+{
+	uint32_t iLength = sOledQueue[iOledTail] | (sOledQueue[iOledTail + 1] << 8);
+
+	iOledTail = iOledTail + OLED_FRAME_HEADER + iLength;
+	if (iOledTail >= OLED_QUEUE_SIZE)
+	{
+		iOledTail = 0;
+	}
+	iOledBusy = 0;
+	fOledQueueKick();
+
+	if (iOledBusy == 0)
+	{
+		iOledIdleCycle = DWT->CYCCNT;
+	}
+}
+
+/*
+ *  @brief	frame을 쓸 위치 찾기
+ *  @param	iBytes	frame 전체 크기 (길이 field 포함)
+ *  @retval	쓸 위치, 자리가 없으면 -1
+ */
+static int32_t fOledQueueReserve(uint32_t iBytes)
+{
+	uint32_t iHead = iOledHead;
+	uint32_t iTail = iOledTail;
+
+	if (iHead >= iTail)
+	{
+		// 뒤쪽에 넣는다. tail이 0이면 가득 찬 것과 빈 것을 구분하도록 1 Byte 남긴다
+		if (OLED_QUEUE_SIZE - iHead >= iBytes + ((iTail == 0) ? 1 : 0))
+		{
+			return (int32_t)iHead;
+		}
+		// 앞쪽으로 돌아간다
+		if (iTail > iBytes)
+		{
+			return 0;
+		}
+		return -1;
+	}
+
+	if (iTail - iHead > iBytes)
+	{
+		return (int32_t)iHead;
+	}
+	return -1;
+}
+
+/*
+ *  @brief	queue와 I2C2 TX DMA 초기화. MX_I2C2_Init() 다음에 호출
+ *  @param	None
+ *  @retval	None
+ */
+void fOledQueueInit(void)
+{
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	hdma_i2c2_tx.Instance = DMA1_Stream7;
+	hdma_i2c2_tx.Init.Channel = DMA_CHANNEL_7;
+	hdma_i2c2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+	hdma_i2c2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_i2c2_tx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_i2c2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_i2c2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_i2c2_tx.Init.Mode = DMA_NORMAL;
+	hdma_i2c2_tx.Init.Priority = DMA_PRIORITY_LOW;
+	hdma_i2c2_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+	if (HAL_DMA_Init(&hdma_i2c2_tx) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	__HAL_LINKDMA(&hi2c2, hdmatx, hdma_i2c2_tx);
+
+	HAL_NVIC_SetPriority(DMA1_Stream7_IRQn, OLED_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream7_IRQn);
+	HAL_NVIC_SetPriority(I2C2_EV_IRQn, OLED_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C2_EV_IRQn);
+	HAL_NVIC_SetPriority(I2C2_ER_IRQn, OLED_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C2_ER_IRQn);
+
+	iOledHead = 0;
+	iOledTail = 0;
+	iOledBusy = 0;
+	iOledErrorCount = 0;
+}
+
+/*
+ *  @brief	DMA와 인터럽트 해제. Application으로 넘어가기 전에 호출
+ *  @param	None
+ *  @retval	None
+ */
+void fOledQueueDeInit(void)
+{
+	HAL_NVIC_DisableIRQ(I2C2_EV_IRQn);
+	HAL_NVIC_DisableIRQ(I2C2_ER_IRQn);
+	HAL_NVIC_DisableIRQ(DMA1_Stream7_IRQn);
+	HAL_DMA_DeInit(&hdma_i2c2_tx);
+}
+
+/*
+ *  @brief	frame을 queue에 복사하고 전송중이 아니면 바로 전송 시작. 기다리지 않는다
+ *  @param	iControl	control byte (OLED_CONTROL_COMMAND 또는 OLED_CONTROL_DATA)
+ *			sData		보낼 내용, 복사하므로 호출 후 바로 바꿔도 된다
+ *			iLength		내용 길이
+ *  @retval	넣었으면 0, 자리가 없으면 -1
+ */
+int fOledQueueSubmit(uint8_t iControl, const uint8_t *sData, uint16_t iLength)
+{
+	uint32_t iFrameLength = 1 + iLength;
+	int32_t iPosition = fOledQueueReserve(OLED_FRAME_HEADER + iFrameLength);
+
+	if (iPosition < 0)
+	{
+		return -1;
+	}
+
+	// 끝에 자리가 없어 처음으로 돌아가면 남은 자리에 길이 0 표시
+	if (((uint32_t)iPosition != iOledHead) && (OLED_QUEUE_SIZE - iOledHead >= OLED_FRAME_HEADER))
+	{
+		sOledQueue[iOledHead] = 0;
+		sOledQueue[iOledHead + 1] = 0;
+	}
+
+	sOledQueue[iPosition] = (uint8_t)iFrameLength;
+	sOledQueue[iPosition + 1] = (uint8_t)(iFrameLength >> 8);
+	sOledQueue[iPosition + OLED_FRAME_HEADER] = iControl;
+	memcpy(&sOledQueue[iPosition + OLED_FRAME_HEADER + 1], sData, iLength);
+
+	__disable_irq();
+	iOledHead = iPosition + OLED_FRAME_HEADER + iFrameLength;
+	if (iOledHead >= OLED_QUEUE_SIZE)
+	{
+		iOledHead = 0;
+	}
+	fOledQueueKick();
+	__enable_irq();
+
+	return 0;
+}
+
+/*
+ *  @brief	여러 frame이 들어갈 자리가 있는지 확인
+ *  @param	iBytes	넣을 frame 내용 크기 합 + frame 개수 x 3
+ *  @retval	자리가 있으면 1, 없으면 0
+ */
+int fOledQueueHasRoom(uint32_t iBytes)
+{
+	uint32_t iHead = iOledHead;
+	uint32_t iTail = iOledTail;
+	uint32_t iEnd;
+
+	if (iHead < iTail)
+	{
+		return (iTail - iHead > iBytes) ? 1 : 0;
+	}
+
+	// 뒤쪽이나 앞쪽 중 한곳에 전부 들어가면 중간에 처음으로 돌아가도 들어간다
+	iEnd = OLED_QUEUE_SIZE - iHead - ((iTail == 0) ? 1 : 0);
+	return ((iEnd >= iBytes) || (iTail > iBytes)) ? 1 : 0;
+}
+
+/*
+ *  @brief	보낼 frame이 남아 있는지 확인
+ *  @param	None
+ *  @retval	모두 보냈으면 1, 아니면 0
+ */
+int fOledQueueIsIdle(void)
+{
+	return ((iOledBusy == 0) && (iOledHead == iOledTail)) ? 1 : 0;
+}
+
+/*
+ *  @brief	queue가 빌 때까지 대기
+ *  @param	iTimeout	최대 대기 시간 (ms)
+ *  @retval	비었으면 0, 시간 초과 -1
+ */
+int fOledQueueFlush(uint32_t iTimeout)
+{
+	uint32_t iStart = HAL_GetTick();
+
+	while (fOledQueueIsIdle() == 0)
+	{
+		if (HAL_GetTick() - iStart > iTimeout)
+		{
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*
+ *  @brief	마지막으로 queue의 frame을 모두 보낸 시점
+ *  @param	None
+ *  @retval	DWT cycle counter 값 (perf.h의 fPerfStart()와 같은 기준)
+ */
+uint32_t fOledQueueIdleCycle(void)
+{
+	return iOledIdleCycle;
+}
+
+/*
+ *  @brief	I2C 오류로 버린 frame 수
+ *  @param	None
+ *  @retval	오류 수
+ */
+uint32_t fOledQueueErrorCount(void)
+{
+	return iOledErrorCount;
+}
+
+/*
+ *  @brief	I2C DMA 전송 완료 callback (HAL weak 함수 재정의)
+ *  @param	hi2c	I2C handle
+ *  @retval	None
+ */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C2)
+	{
+		fOledQueueNext();
+	}
+}
+
+/*
+ *  @brief	I2C 오류 callback. 해당 frame은 버리고 다음 frame으로 넘어간다
+ *  @param	hi2c	I2C handle
+ *  @retval	None
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C2)
+	{
+		iOledErrorCount++;
+		fOledQueueNext();
+	}
+}
@@ -0,0 +1,508 @@
+/*
+ * p256.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "p256.h"
+
+#include <string.h>
+
+/*
+ *	256 bit 수는 32 bit word 8개, little endian word 순서로 둔다 (s[0]이 최하위).
+ *	곱셈은 모두 Montgomery 형식 (x * 2^256 mod m)에서 CIOS 방식으로 한다. p와 n 두 modulus를 같은 함수로 쓴다.
+ *	점은 Jacobian 좌표 (X / Z^2, Y / Z^3), Z == 0이면 무한원점이다.
+ */
+#define P256_WORDS						8
+
+/* modulus와 Montgomery 상수 */
+typedef struct
+{
+	uint32_t sM[P256_WORDS];
+	// -m^-1 mod 2^32
+	uint32_t iMPrime;
+	// 2^512 mod m, 일반 형식을 Montgomery 형식으로 바꿀 때 곱한다
+	uint32_t sR2[P256_WORDS];
+	// 2^256 mod m, Montgomery 형식의 1
+	uint32_t sOne[P256_WORDS];
+} P256ModTypeDef;
+
+/* Jacobian 좌표 점, 좌표는 mod p Montgomery 형식 */
+typedef struct
+{
+	uint32_t sX[P256_WORDS];
+	uint32_t sY[P256_WORDS];
+	uint32_t sZ[P256_WORDS];
+} P256PointTypeDef;
+
+// 좌표 계산용 p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+static const P256ModTypeDef sP256P =
+{
+	{ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF },
+	0x00000001,
+	{ 0x00000003, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFD, 0x00000004 },
+	{ 0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0x00000000 },
+};
+
+// scalar 계산용 곡선 위수 n
+static const P256ModTypeDef sP256N =
+{
+	{ 0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF },
+	0xEE00BC4F,
+	{ 0xBE79EEA2, 0x83244C95, 0x49BD6FA6, 0x4699799C, 0x2B6BEC59, 0x2845B239, 0xF3D95620, 0x66E12D94 },
+	{ 0x039CDAAF, 0x0C46353D, 0x58E8617B, 0x43190552, 0x00000000, 0x00000000, 0xFFFFFFFF, 0x00000000 },
+};
+
+// 곡선 상수 b, 생성점 G (mod p Montgomery 형식)
+static const uint32_t sP256B[P256_WORDS] =
+{
+	0x29C4BDDF, 0xD89CDF62, 0x78843090, 0xACF005CD, 0xF7212ED6, 0xE5A220AB, 0x04874834, 0xDC30061D
+};
+static const uint32_t sP256Gx[P256_WORDS] =
+{
+	0x18A9143C, 0x79E730D4, 0x5FEDB601, 0x75BA95FC, 0x77622510, 0x79FB732B, 0xA53755C6, 0x18905F76
+};
+static const uint32_t sP256Gy[P256_WORDS] =
+{
+	0xCE95560A, 0xDDF25357, 0xBA19E45C, 0x8B4AB8E4, 0xDD21F325, 0xD2E88688, 0x25885D85, 0x8571FF18
+};
+
+/*
+ *  @brief	iHi:iLo = a * b + iLo + iHi. 결과는 64 bit를 넘지 않는다.
+ *			Cortex-M4 (DSP extension)는 UMAAL 한 명령으로 곱셈과 두 덧셈을 하므로 carry 처리가 없다
+ */
+static inline __attribute__((always_inline)) void fP256Umaal(uint32_t *iLo, uint32_t *iHi, uint32_t a, uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+	__asm__ ("umaal %0, %1, %2, %3" : "+r" (*iLo), "+r" (*iHi) : "r" (a), "r" (b));
+#else
+	uint64_t iProduct = ((uint64_t)a * b) + *iLo + *iHi;
+
+	*iLo = (uint32_t)iProduct;
+	*iHi = (uint32_t)(iProduct >> 32);
+#endif
+}
+
+/*
+ *  @brief	big endian 32 Byte를 word 배열로
+ */
+static void fP256Load(uint32_t *sOut, const uint8_t *sIn)
+{
+	for (int i = 0; i < P256_WORDS; i++)
+	{
+		const uint8_t *sByte = &sIn[(P256_WORDS - 1 - i) * 4];
+
+		sOut[i] = ((uint32_t)sByte[0] << 24) | ((uint32_t)sByte[1] << 16) | ((uint32_t)sByte[2] << 8) | sByte[3];
+	}
+}
+
+static int fP256IsZero(const uint32_t *a)
+{
+	uint32_t iOr = 0;
+
+	for (int i = 0; i < P256_WORDS; i++)
+	{
+		iOr |= a[i];
+	}
+	return (iOr == 0) ? 1 : 0;
+}
+
+/*
+ *  @brief	크기 비교
+ *  @retval	a < b 이면 -1, 같으면 0, a > b 이면 1
+ */
+static int fP256Compare(const uint32_t *a, const uint32_t *b)
+{
+	for (int i = P256_WORDS - 1; i >= 0; i--)
+	{
+		if (a[i] != b[i])
+		{
+			return (a[i] < b[i]) ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ *  @brief	r = a + b
+ *  @retval	carry
+ */
+static uint32_t fP256Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+	uint64_t iSum = 0;
+
+	for (int i = 0; i < P256_WORDS; i++)
+	{
+		iSum += (uint64_t)a[i] + b[i];
+		r[i] = (uint32_t)iSum;
+		iSum >>= 32;
+	}
+	return (uint32_t)iSum;
+}
+
+/*
+ *  @brief	r = a - b
+ *  @retval	borrow
+ */
+static uint32_t fP256Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+	int64_t iDiff = 0;
+
+	for (int i = 0; i < P256_WORDS; i++)
+	{
+		iDiff += (int64_t)a[i] - b[i];
+		r[i] = (uint32_t)iDiff;
+		iDiff >>= 32;
+	}
+	return (uint32_t)(iDiff & 1);
+}
+
+/*
+ *  @brief	r = a + b mod m (a, b < m)
+ */
+static void fP256ModAdd(uint32_t *r, const uint32_t *a, const uint32_t *b, const P256ModTypeDef *pMod)
+{
+	if ((fP256Add(r, a, b) != 0) || (fP256Compare(r, pMod->sM) >= 0))
+	{
+		fP256Sub(r, r, pMod->sM);
+	}
+}
+
+/*
+ *  @brief	r = a - b mod m (a, b < m)
+ */
+static void fP256ModSub(uint32_t *r, const uint32_t *a, const uint32_t *b, const P256ModTypeDef *pMod)
+{
+	if (fP256Sub(r, a, b) != 0)
+	{
+		fP256Add(r, r, pMod->sM);
+	}
+}
+
+/*
+ *  @brief	Montgomery 곱셈 r = a * b * 2^-256 mod m (a, b < m). r은 a, b와 같은 버퍼여도 된다.
+ *			b의 word 하나씩 a 전체를 곱해 더하고 (UMAAL 8번), 바로 최하위 word가 0이 되도록
+ *			m의 배수를 더해서 한 word 내린다 (UMAAL 8번). 중간 값은 2m보다 작아서 9 word로 충분하다
+ *  @param	r		결과
+ *			a, b	곱할 수
+ *			pMod	modulus
+ *  @retval	None
+ */
+static void fP256MontMul(uint32_t *r, const uint32_t *a, const uint32_t *b, const P256ModTypeDef *pMod)
+{
+	const uint32_t *m = pMod->sM;
+	uint32_t t[P256_WORDS];
+	uint32_t iTop = 0;
+	uint32_t iCarry, iLow, u;
+
+	memset(t, 0x00, sizeof(t));
+
+	for (int i = 0; i < P256_WORDS; i++)
+	{
+		uint32_t bi = b[i];
+
+		// t += a * b[i]
+		iCarry = 0;
+		fP256Umaal(&t[0], &iCarry, a[0], bi);
+		fP256Umaal(&t[1], &iCarry, a[1], bi);
+		fP256Umaal(&t[2], &iCarry, a[2], bi);
+		fP256Umaal(&t[3], &iCarry, a[3], bi);
+		fP256Umaal(&t[4], &iCarry, a[4], bi);
+		fP256Umaal(&t[5], &iCarry, a[5], bi);
+		fP256Umaal(&t[6], &iCarry, a[6], bi);
+		fP256Umaal(&t[7], &iCarry, a[7], bi);
+		iTop += iCarry;
+		// 9번째 word (iTop)에서 넘친 carry, 10번째 word는 bit 하나로 충분하다
+		iCarry = (iTop < iCarry) ? 1 : 0;
+
+		// t = (t + u * m) / 2^32
+		u = t[0] * pMod->iMPrime;
+		iLow = t[0];
+		{
+			uint32_t iHi = 0;
+
+			fP256Umaal(&iLow, &iHi, u, m[0]);
+			iLow = t[1]; fP256Umaal(&iLow, &iHi, u, m[1]); t[0] = iLow;
+			iLow = t[2]; fP256Umaal(&iLow, &iHi, u, m[2]); t[1] = iLow;
+			iLow = t[3]; fP256Umaal(&iLow, &iHi, u, m[3]); t[2] = iLow;
+			iLow = t[4]; fP256Umaal(&iLow, &iHi, u, m[4]); t[3] = iLow;
+			iLow = t[5]; fP256Umaal(&iLow, &iHi, u, m[5]); t[4] = iLow;
+			iLow = t[6]; fP256Umaal(&iLow, &iHi, u, m[6]); t[5] = iLow;
+			iLow = t[7]; fP256Umaal(&iLow, &iHi, u, m[7]); t[6] = iLow;
+			t[7] = iTop + iHi;
+			iTop = iCarry + ((t[7] < iHi) ? 1 : 0);
+		}
+	}
+
+	if ((iTop != 0) || (fP256Compare(t, m) >= 0))
+	{
+		fP256Sub(t, t, m);
+	}
+	memcpy(r, t, sizeof(t));
+}
+
+/*
+ *  @brief	Montgomery 형식 역원 r = a^-1 (a^(m-2), m이 소수이므로). a는 0이 아니어야 한다
+ */
+static void fP256ModInv(uint32_t *r, const uint32_t *a, const P256ModTypeDef *pMod)
+{
+	uint32_t sExp[P256_WORDS];
+	uint32_t t[P256_WORDS];
+
+	// p, n 모두 최하위 word가 2보다 커서 borrow가 없다
+	memcpy(sExp, pMod->sM, sizeof(sExp));
+	sExp[0] -= 2;
+
+	memcpy(t, pMod->sOne, sizeof(t));
+	for (int i = 255; i >= 0; i--)
+	{
+		fP256MontMul(t, t, t, pMod);
+		if ((sExp[i / 32] >> (i % 32)) & 1)
+		{
+			fP256MontMul(t, t, a, pMod);
+		}
+	}
+	memcpy(r, t, sizeof(t));
+}
+
+// 좌표 (mod p) 연산
+#define P256_FMUL(r, a, b)		fP256MontMul((r), (a), (b), &sP256P)
+#define P256_FSQR(r, a)			fP256MontMul((r), (a), (a), &sP256P)
+#define P256_FADD(r, a, b)		fP256ModAdd((r), (a), (b), &sP256P)
+#define P256_FSUB(r, a, b)		fP256ModSub((r), (a), (b), &sP256P)
+
+/*
+ *  @brief	점 두배, a = -3 곡선용 (dbl-2001-b, 3M + 5S). pPoint 자리에서 계산한다
+ */
+static void fP256Double(P256PointTypeDef *pPoint)
+{
+	uint32_t sDelta[P256_WORDS], sGamma[P256_WORDS], sBeta[P256_WORDS], sAlpha[P256_WORDS], t[P256_WORDS];
+
+	if (fP256IsZero(pPoint->sZ) == 1)
+	{
+		return;
+	}
+
+	P256_FSQR(sDelta, pPoint->sZ);
+	P256_FSQR(sGamma, pPoint->sY);
+	P256_FMUL(sBeta, pPoint->sX, sGamma);
+
+	// alpha = 3 * (X - delta) * (X + delta)
+	P256_FSUB(t, pPoint->sX, sDelta);
+	P256_FADD(sAlpha, pPoint->sX, sDelta);
+	P256_FMUL(sAlpha, t, sAlpha);
+	P256_FADD(t, sAlpha, sAlpha);
+	P256_FADD(sAlpha, t, sAlpha);
+
+	// Z3 = (Y + Z)^2 - gamma - delta
+	P256_FADD(t, pPoint->sY, pPoint->sZ);
+	P256_FSQR(t, t);
+	P256_FSUB(t, t, sGamma);
+	P256_FSUB(pPoint->sZ, t, sDelta);
+
+	// X3 = alpha^2 - 8 * beta
+	P256_FADD(sBeta, sBeta, sBeta);
+	P256_FADD(sBeta, sBeta, sBeta);
+	P256_FSQR(t, sAlpha);
+	P256_FSUB(t, t, sBeta);
+	P256_FSUB(pPoint->sX, t, sBeta);
+
+	// Y3 = alpha * (4 * beta - X3) - 8 * gamma^2
+	P256_FSUB(t, sBeta, pPoint->sX);
+	P256_FMUL(t, sAlpha, t);
+	P256_FSQR(sGamma, sGamma);
+	P256_FADD(sGamma, sGamma, sGamma);
+	P256_FADD(sGamma, sGamma, sGamma);
+	P256_FADD(sGamma, sGamma, sGamma);
+	P256_FSUB(pPoint->sY, t, sGamma);
+}
+
+/*
+ *  @brief	Jacobian 점에 affine 점 (Z = 1)을 더한다 (madd-2007-bl, 7M + 4S). pPoint 자리에서 계산한다
+ *  @param	pPoint	더해질 점
+ *			sX2		더할 점 x
+ *			sY2		더할 점 y
+ *  @retval	None
+ */
+static void fP256AddAffine(P256PointTypeDef *pPoint, const uint32_t *sX2, const uint32_t *sY2)
+{
+	uint32_t sZ1Z1[P256_WORDS], sH[P256_WORDS], sHH[P256_WORDS], sR[P256_WORDS], sI[P256_WORDS], sJ[P256_WORDS], sV[P256_WORDS], t[P256_WORDS];
+
+	if (fP256IsZero(pPoint->sZ) == 1)
+	{
+		memcpy(pPoint->sX, sX2, sizeof(pPoint->sX));
+		memcpy(pPoint->sY, sY2, sizeof(pPoint->sY));
+		memcpy(pPoint->sZ, sP256P.sOne, sizeof(pPoint->sZ));
+		return;
+	}
+
+	// H = X2 * Z1^2 - X1, r = Y2 * Z1^3 - Y1
+	P256_FSQR(sZ1Z1, pPoint->sZ);
+	P256_FMUL(t, sX2, sZ1Z1);
+	P256_FSUB(sH, t, pPoint->sX);
+	P256_FMUL(t, sY2, pPoint->sZ);
+	P256_FMUL(t, t, sZ1Z1);
+	P256_FSUB(sR, t, pPoint->sY);
+
+	// 같은 x 좌표, 같은 점이면 두배 아니면 서로 반대 점
+	if (fP256IsZero(sH) == 1)
+	{
+		if (fP256IsZero(sR) == 1)
+		{
+			fP256Double(pPoint);
+		}
+		else
+		{
+			memset(pPoint->sZ, 0x00, sizeof(pPoint->sZ));
+		}
+		return;
+	}
+
+	P256_FADD(sR, sR, sR);
+	P256_FSQR(sHH, sH);
+	P256_FADD(sI, sHH, sHH);
+	P256_FADD(sI, sI, sI);
+	P256_FMUL(sJ, sH, sI);
+	P256_FMUL(sV, pPoint->sX, sI);
+
+	// Z3 = (Z1 + H)^2 - Z1Z1 - HH
+	P256_FADD(t, pPoint->sZ, sH);
+	P256_FSQR(t, t);
+	P256_FSUB(t, t, sZ1Z1);
+	P256_FSUB(pPoint->sZ, t, sHH);
+
+	// X3 = r^2 - J - 2 * V
+	P256_FSQR(t, sR);
+	P256_FSUB(t, t, sJ);
+	P256_FSUB(t, t, sV);
+	P256_FSUB(pPoint->sX, t, sV);
+
+	// Y3 = r * (V - X3) - 2 * Y1 * J
+	P256_FSUB(t, sV, pPoint->sX);
+	P256_FMUL(t, sR, t);
+	P256_FMUL(sJ, pPoint->sY, sJ);
+	P256_FADD(sJ, sJ, sJ);
+	P256_FSUB(pPoint->sY, t, sJ);
+}
+
+/*
+ *  @brief	ECDSA P-256 서명 검증.
+ *			u1 = e / s, u2 = r / s (mod n) 으로 u1 * G + u2 * Q를 Shamir 방식 (G, Q, G + Q 표로 두 scalar를
+ *			한번에 훑는다)으로 구하고, 결과 x 좌표를 역원 없이 X == r * Z^2 로 비교한다
+ *  @param	sPublicKey	공개키 x || y, 각 32 Byte big endian
+ *			sDigest		SHA-256 결과 32 Byte
+ *			sSignature	서명 r || s, 각 32 Byte big endian
+ *  @retval	0 : 서명 맞음, -1 : 틀림 또는 잘못된 공개키
+ */
+int fP256Verify(const uint8_t *sPublicKey, const uint8_t *sDigest, const uint8_t *sSignature)
+{
+	uint32_t sR[P256_WORDS], sS[P256_WORDS], sE[P256_WORDS];
+	uint32_t sU1[P256_WORDS], sU2[P256_WORDS];
+	uint32_t sQx[P256_WORDS], sQy[P256_WORDS];
+	uint32_t t[P256_WORDS], sZ2[P256_WORDS];
+	P256PointTypeDef sGQ, sAcc;
+	int iGQInfinity;
+
+	fP256Load(sR, &sSignature[0]);
+	fP256Load(sS, &sSignature[32]);
+	fP256Load(sE, sDigest);
+	fP256Load(sQx, &sPublicKey[0]);
+	fP256Load(sQy, &sPublicKey[32]);
+
+	// 0 < r, s < n
+	if ((fP256IsZero(sR) == 1) || (fP256IsZero(sS) == 1) || (fP256Compare(sR, sP256N.sM) >= 0) || (fP256Compare(sS, sP256N.sM) >= 0))
+	{
+		return -1;
+	}
+
+	// 공개키가 곡선 위의 점인지 y^2 == x^3 - 3x + b
+	if ((fP256Compare(sQx, sP256P.sM) >= 0) || (fP256Compare(sQy, sP256P.sM) >= 0))
+	{
+		return -1;
+	}
+	P256_FMUL(sQx, sQx, sP256P.sR2);
+	P256_FMUL(sQy, sQy, sP256P.sR2);
+	P256_FSQR(t, sQx);
+	P256_FMUL(t, t, sQx);
+	P256_FSUB(t, t, sQx);
+	P256_FSUB(t, t, sQx);
+	P256_FSUB(t, t, sQx);
+	P256_FADD(t, t, sP256B);
+	P256_FSQR(sZ2, sQy);
+	if (fP256Compare(t, sZ2) != 0)
+	{
+		return -1;
+	}
+
+	// e = digest mod n, digest는 n의 2배보다 작다
+	if (fP256Compare(sE, sP256N.sM) >= 0)
+	{
+		fP256Sub(sE, sE, sP256N.sM);
+	}
+
+	// t = s^-1 (Montgomery 형식), 일반 형식 e, r을 곱하면 Montgomery 인수가 빠져 u1, u2가 일반 형식으로 나온다
+	fP256MontMul(t, sS, sP256N.sR2, &sP256N);
+	fP256ModInv(t, t, &sP256N);
+	fP256MontMul(sU1, sE, t, &sP256N);
+	fP256MontMul(sU2, sR, t, &sP256N);
+
+	// G + Q를 affine 좌표로
+	memcpy(sGQ.sX, sQx, sizeof(sGQ.sX));
+	memcpy(sGQ.sY, sQy, sizeof(sGQ.sY));
+	memcpy(sGQ.sZ, sP256P.sOne, sizeof(sGQ.sZ));
+	fP256AddAffine(&sGQ, sP256Gx, sP256Gy);
+	iGQInfinity = fP256IsZero(sGQ.sZ);
+	if (iGQInfinity == 0)
+	{
+		fP256ModInv(t, sGQ.sZ, &sP256P);
+		P256_FSQR(sZ2, t);
+		P256_FMUL(sGQ.sX, sGQ.sX, sZ2);
+		P256_FMUL(sZ2, sZ2, t);
+		P256_FMUL(sGQ.sY, sGQ.sY, sZ2);
+	}
+
+	// 상위 bit부터 두배하고 (u1, u2) bit 쌍에 맞는 점을 더한다
+	memset(sAcc.sZ, 0x00, sizeof(sAcc.sZ));
+	for (int i = 255; i >= 0; i--)
+	{
+		uint32_t iIndex = ((sU1[i / 32] >> (i % 32)) & 1) | (((sU2[i / 32] >> (i % 32)) & 1) << 1);
+
+		fP256Double(&sAcc);
+		if (iIndex == 1)
+		{
+			fP256AddAffine(&sAcc, sP256Gx, sP256Gy);
+		}
+		else if (iIndex == 2)
+		{
+			fP256AddAffine(&sAcc, sQx, sQy);
+		}
+		else if ((iIndex == 3) && (iGQInfinity == 0))
+		{
+			fP256AddAffine(&sAcc, sGQ.sX, sGQ.sY);
+		}
+	}
+
+	if (fP256IsZero(sAcc.sZ) == 1)
+	{
+		return -1;
+	}
+
+	// x mod n == r, x = X / Z^2 < p 이므로 x는 r 또는 r + n (r + n < p 일 때)
+	P256_FSQR(sZ2, sAcc.sZ);
+	P256_FMUL(t, sR, sP256P.sR2);
+	P256_FMUL(t, t, sZ2);
+	if (fP256Compare(t, sAcc.sX) == 0)
+	{
+		return 0;
+	}
+	if ((fP256Add(sR, sR, sP256N.sM) == 0) && (fP256Compare(sR, sP256P.sM) < 0))
+	{
+		P256_FMUL(t, sR, sP256P.sR2);
+		P256_FMUL(t, t, sZ2);
+		if (fP256Compare(t, sAcc.sX) == 0)
+		{
+			return 0;
+		}
+	}
+	return -1;
+}
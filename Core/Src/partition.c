@@ -0,0 +1,117 @@
+/*
+ * partition.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "partition.h"
+
+/* sector 시작 주소와 크기, 미리 계산된 값 */
+const FlashSectorTypeDef sFlashSectorTable[PARTITION_SECTOR_TOTAL] =
+{
+	{ PARTITION_SECTOR_ADDRESS(0), PARTITION_SECTOR_SIZE(0) },
+	{ PARTITION_SECTOR_ADDRESS(1), PARTITION_SECTOR_SIZE(1) },
+	{ PARTITION_SECTOR_ADDRESS(2), PARTITION_SECTOR_SIZE(2) },
+	{ PARTITION_SECTOR_ADDRESS(3), PARTITION_SECTOR_SIZE(3) },
+	{ PARTITION_SECTOR_ADDRESS(4), PARTITION_SECTOR_SIZE(4) },
+	{ PARTITION_SECTOR_ADDRESS(5), PARTITION_SECTOR_SIZE(5) },
+	{ PARTITION_SECTOR_ADDRESS(6), PARTITION_SECTOR_SIZE(6) },
+	{ PARTITION_SECTOR_ADDRESS(7), PARTITION_SECTOR_SIZE(7) },
+	{ PARTITION_SECTOR_ADDRESS(8), PARTITION_SECTOR_SIZE(8) },
+	{ PARTITION_SECTOR_ADDRESS(9), PARTITION_SECTOR_SIZE(9) },
+	{ PARTITION_SECTOR_ADDRESS(10), PARTITION_SECTOR_SIZE(10) },
+	{ PARTITION_SECTOR_ADDRESS(11), PARTITION_SECTOR_SIZE(11) },
+	{ PARTITION_SECTOR_ADDRESS(12), PARTITION_SECTOR_SIZE(12) },
+	{ PARTITION_SECTOR_ADDRESS(13), PARTITION_SECTOR_SIZE(13) },
+	{ PARTITION_SECTOR_ADDRESS(14), PARTITION_SECTOR_SIZE(14) },
+	{ PARTITION_SECTOR_ADDRESS(15), PARTITION_SECTOR_SIZE(15) },
+	{ PARTITION_SECTOR_ADDRESS(16), PARTITION_SECTOR_SIZE(16) },
+	{ PARTITION_SECTOR_ADDRESS(17), PARTITION_SECTOR_SIZE(17) },
+	{ PARTITION_SECTOR_ADDRESS(18), PARTITION_SECTOR_SIZE(18) },
+	{ PARTITION_SECTOR_ADDRESS(19), PARTITION_SECTOR_SIZE(19) },
+	{ PARTITION_SECTOR_ADDRESS(20), PARTITION_SECTOR_SIZE(20) },
+	{ PARTITION_SECTOR_ADDRESS(21), PARTITION_SECTOR_SIZE(21) },
+	{ PARTITION_SECTOR_ADDRESS(22), PARTITION_SECTOR_SIZE(22) },
+	{ PARTITION_SECTOR_ADDRESS(23), PARTITION_SECTOR_SIZE(23) },
+};
+
+/* partition 배치 */
+const PartitionTypeDef sPartitionTable[PARTITION_MAX] =
+{
+	{ "BOOTLOADER",  PARTITION_BOOTLOADER_FIRST_SECTOR,  PARTITION_BOOTLOADER_LAST_SECTOR,  PARTITION_BOOTLOADER_ADDRESS,  PARTITION_BOOTLOADER_SIZE },
+	{ "METADATA",    PARTITION_METADATA_FIRST_SECTOR,    PARTITION_METADATA_LAST_SECTOR,    PARTITION_METADATA_ADDRESS,    PARTITION_METADATA_SIZE },
+	{ "APPLICATION", PARTITION_APPLICATION_FIRST_SECTOR, PARTITION_APPLICATION_LAST_SECTOR, PARTITION_APPLICATION_ADDRESS, PARTITION_APPLICATION_SIZE },
+};
+
+/*
+ *	@brief	주소가 속한 sector 번호. Bank 안에서 16KB, 64KB, 128KB 구간만 나누면 되므로
+ *			비교 몇번과 shift로 바로 구한다
+ *	@param	Address	확인할 Flash 주소
+ *	@retval	sector 번호, Flash 영역 밖이면 -1
+ */
+int32_t fPartitionGetSector(uint32_t Address)
+{
+	uint32_t iOffset = 0;
+	int32_t iBankSector = 0;
+
+	if ((Address < PARTITION_FLASH_BASE) || (Address >= PARTITION_FLASH_BASE + PARTITION_FLASH_SIZE))
+	{
+		return -1;
+	}
+
+	iOffset = (Address - PARTITION_FLASH_BASE) % PARTITION_FLASH_BANK_SIZE;
+
+	if (iOffset < 0x10000)
+	{
+		// 16KB sector 0 ~ 3
+		iBankSector = (int32_t)(iOffset >> 14);
+	}
+	else if (iOffset < 0x20000)
+	{
+		// 64KB sector 4
+		iBankSector = 4;
+	}
+	else
+	{
+		// 128KB sector 5 ~ 11
+		iBankSector = 4 + (int32_t)(iOffset >> 17);
+	}
+
+	return (int32_t)((Address - PARTITION_FLASH_BASE) / PARTITION_FLASH_BANK_SIZE) * PARTITION_SECTORS_PER_BANK + iBankSector;
+}
+
+/*
+ *	@brief	partition 정보
+ *	@param	ePartition	partition 종류
+ *	@retval	partition 정보 주소
+ */
+const PartitionTypeDef *fPartitionGet(PartitionIdTypeDef ePartition)
+{
+	return &sPartitionTable[ePartition];
+}
+
+/*
+ *	@brief	주소 범위가 partition 안에 있는지 확인
+ *	@param	ePartition	partition 종류
+ *			Address		범위 시작 주소
+ *			iSize		범위 크기 (Byte)
+ *	@retval	안에 있으면 1, 벗어나면 0
+ */
+int fPartitionContains(PartitionIdTypeDef ePartition, uint32_t Address, uint32_t iSize)
+{
+	const PartitionTypeDef *pPartition = &sPartitionTable[ePartition];
+
+	if (Address < pPartition->iAddress)
+	{
+		return 0;
+	}
+	if (iSize > pPartition->iSize)
+	{
+		return 0;
+	}
+	if ((Address - pPartition->iAddress) > (pPartition->iSize - iSize))
+	{
+		return 0;
+	}
+	return 1;
+}
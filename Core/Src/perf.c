@@ -0,0 +1,126 @@
+/*
+ * perf.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "perf.h"
+
+#include "log.h"
+
+/* 측정 항목별 누적 값 */
+typedef struct
+{
+	uint32_t iCycles;
+	uint32_t iBytes;
+} PerfTypeDef;
+
+static PerfTypeDef sPerfCounter[PERF_COUNTER_MAX];
+
+// 보고할 때 사용하는 메세지 ID, PerfCounterTypeDef 순서와 같아야 한다
+static const LogIdTypeDef sPerfLogId[PERF_COUNTER_MAX] =
+{
+	LOG_PERF_FLASH_PROGRAM,
+	LOG_PERF_FLASH_VERIFY,
+	LOG_PERF_FORMAT,
+	LOG_PERF_PACKET_PARSE,
+	LOG_PERF_IMAGE_HASH,
+	LOG_PERF_PACKET_RECEIVE,
+};
+
+/*
+ *  @brief	DWT cycle counter 시작
+ *  @param	None
+ *  @retval	None
+ */
+void fPerfInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	fPerfReset();
+}
+
+/*
+ *  @brief	누적 값 초기화
+ *  @param	None
+ *  @retval	None
+ */
+void fPerfReset(void)
+{
+	for (int i = 0; i < PERF_COUNTER_MAX; i++)
+	{
+		sPerfCounter[i].iCycles = 0;
+		sPerfCounter[i].iBytes = 0;
+	}
+}
+
+/*
+ *  @brief	측정 시작 시점 cycle
+ *  @param	None
+ *  @retval	현재 DWT cycle counter 값
+ */
+uint32_t fPerfStart(void)
+{
+	return DWT->CYCCNT;
+}
+
+/*
+ *  @brief	측정 종료, 구간 cycle과 처리 byte 누적
+ *  @param	eCounter		측정 항목
+ *			iStartCycle		fPerfStart() 반환 값
+ *			iBytes			구간에서 처리한 byte 수
+ *  @retval	None
+ */
+void fPerfStop(PerfCounterTypeDef eCounter, uint32_t iStartCycle, uint32_t iBytes)
+{
+	// counter가 한바퀴 돌아도 뺄셈 결과는 맞다
+	sPerfCounter[eCounter].iCycles += DWT->CYCCNT - iStartCycle;
+	sPerfCounter[eCounter].iBytes += iBytes;
+}
+
+/*
+ *  @brief	다른 곳 (interrupt)에서 잰 cycle 누적
+ *  @param	eCounter	측정 항목
+ *			iCycles		구간 cycle
+ *			iBytes		구간에서 처리한 byte 수
+ *  @retval	None
+ */
+void fPerfAdd(PerfCounterTypeDef eCounter, uint32_t iCycles, uint32_t iBytes)
+{
+	sPerfCounter[eCounter].iCycles += iCycles;
+	sPerfCounter[eCounter].iBytes += iBytes;
+}
+
+/*
+ *  @brief	측정 항목의 KB당 cycle
+ *  @param	eCounter	측정 항목
+ *  @retval	KB당 cycle, 측정된 byte가 없으면 0
+ */
+uint32_t fPerfCyclesPerKB(PerfCounterTypeDef eCounter)
+{
+	if (sPerfCounter[eCounter].iBytes == 0)
+	{
+		return 0;
+	}
+	return (uint32_t)(((uint64_t)sPerfCounter[eCounter].iCycles * 1024) / sPerfCounter[eCounter].iBytes);
+}
+
+/*
+ *  @brief	측정된 항목을 "[MCU]PERF,이름,KB당 cycle,byte" 형식으로 전송
+ *  @param	None
+ *  @retval	None
+ */
+void fPerfReport(void)
+{
+	for (int i = 0; i < PERF_COUNTER_MAX; i++)
+	{
+		if (sPerfCounter[i].iBytes != 0)
+		{
+			fLog(sPerfLogId[i], 2, fPerfCyclesPerKB(i), sPerfCounter[i].iBytes);
+		}
+	}
+}
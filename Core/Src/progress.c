@@ -0,0 +1,148 @@
+/*
+ * progress.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "display.h"
+#include "progress.h"
+#include "format.h"
+#include "glyph.h"
+
+// 현재 진행 상황
+static ProgressTypeDef sProgress;
+
+// 한 줄 글자 수
+#define PROGRESS_LINE_LENGTH		(DISPLAY_WIDTH / GLYPH_WIDTH)
+// 막대 바깥 테두리를 제외한 안쪽 영역
+#define PROGRESS_BAR_TOP			(PROGRESS_TOP + (2 * GLYPH_HEIGHT))
+#define PROGRESS_BAR_HEIGHT			(DISPLAY_HEIGHT - PROGRESS_BAR_TOP)
+#define PROGRESS_BAR_INNER_X		2
+#define PROGRESS_BAR_INNER_WIDTH	(DISPLAY_WIDTH - (2 * PROGRESS_BAR_INNER_X))
+
+/*
+ *  @brief	진행 표시 시작. INFO, RESUME, RAMLOAD, LOADFILE 성공 시 호출
+ *  @param	iPacketSize		패킷 크기
+ *			iPacketCount	전체 패킷 개수
+ *			iCommittedCount	이미 기록된 패킷 수, 처음부터면 0
+ *			iTick			현재 시간 (ms)
+ *  @retval	None
+ */
+void fProgressStart(uint32_t iPacketSize, uint32_t iPacketCount, uint32_t iCommittedCount, uint32_t iTick)
+{
+	sProgress.iPacketSize = iPacketSize;
+	sProgress.iPacketCount = iPacketCount;
+	sProgress.iStartPacket = iCommittedCount;
+	sProgress.iPacketIndex = iCommittedCount;
+	sProgress.iStartTick = iTick;
+	sProgress.iLastDrawTick = iTick;
+	sProgress.iBytesPerSecond = 0;
+	sProgress.iEtaSeconds = 0;
+}
+
+/*
+ *  @brief	패킷 하나 기록 완료 반영, 속도와 남은 시간 계산
+ *  @param	iPacketIndex	기록 완료된 패킷 번호 (1부터)
+ *			iTick			현재 시간 (ms)
+ *  @retval	다시 그릴 때가 되었으면 1, 아니면 0
+ */
+int fProgressUpdate(uint32_t iPacketIndex, uint32_t iTick)
+{
+	uint32_t iElapsed = iTick - sProgress.iStartTick;
+	uint32_t iBytes;
+
+	sProgress.iPacketIndex = iPacketIndex;
+
+	// 이번 세션에 받은 양 기준. Application 영역은 2MB 미만이라 x1000 해도 32bit 안에 들어간다
+	if ((iElapsed != 0) && (iPacketIndex > sProgress.iStartPacket))
+	{
+		iBytes = (iPacketIndex - sProgress.iStartPacket) * sProgress.iPacketSize;
+		sProgress.iBytesPerSecond = (iBytes * 1000U) / iElapsed;
+		if ((sProgress.iBytesPerSecond != 0) && (iPacketIndex < sProgress.iPacketCount))
+		{
+			sProgress.iEtaSeconds = ((sProgress.iPacketCount - iPacketIndex) * sProgress.iPacketSize) / sProgress.iBytesPerSecond;
+		}
+		else
+		{
+			sProgress.iEtaSeconds = 0;
+		}
+	}
+
+	// 마지막 패킷은 간격과 상관없이 바로 그린다
+	if ((iPacketIndex >= sProgress.iPacketCount) || ((iTick - sProgress.iLastDrawTick) >= PROGRESS_REFRESH_INTERVAL))
+	{
+		sProgress.iLastDrawTick = iTick;
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ *  @brief	진행 상황을 display 버퍼에 그린다. 바뀐 부분만 dirty가 된다
+ *  @param	displaybuffer	디스플레이 버퍼 배열 시작 주소
+ *  @retval	None
+ */
+void fProgressDraw(uint8_t *displaybuffer)
+{
+	char sLine[PROGRESS_LINE_LENGTH + 1];
+	char sLeft[PROGRESS_LINE_LENGTH + 1];
+	char sRight[PROGRESS_LINE_LENGTH + 1];
+	uint32_t iPercent = 0;
+	uint32_t iFill = 0;
+
+	if (sProgress.iPacketCount != 0)
+	{
+		iPercent = (sProgress.iPacketIndex * 100U) / sProgress.iPacketCount;
+		iFill = (sProgress.iPacketIndex * PROGRESS_BAR_INNER_WIDTH) / sProgress.iPacketCount;
+	}
+	if (iFill > PROGRESS_BAR_INNER_WIDTH)
+	{
+		iFill = PROGRESS_BAR_INNER_WIDTH;
+	}
+
+	// 패킷 번호/개수와 진행률, 이전 글자가 남지 않게 한 줄을 다 채운다
+	fFormatString(sLeft, sizeof(sLeft), "%u/%u", (unsigned int)sProgress.iPacketIndex, (unsigned int)sProgress.iPacketCount);
+	fFormatString(sLine, sizeof(sLine), "%-12s%3u%%", sLeft, (unsigned int)iPercent);
+	fDisplayString(0, PROGRESS_TOP, displaybuffer, sLine);
+
+	// 속도 (0.1KB/s 단위)와 남은 시간
+	fFormatString(sLeft, sizeof(sLeft), "%u.%uKB/s", (unsigned int)(sProgress.iBytesPerSecond / 1024U), (unsigned int)(((sProgress.iBytesPerSecond % 1024U) * 10U) / 1024U));
+	if (sProgress.iBytesPerSecond == 0)
+	{
+		fFormatString(sRight, sizeof(sRight), "--");
+	}
+	else if (sProgress.iEtaSeconds < 60)
+	{
+		fFormatString(sRight, sizeof(sRight), "%us", (unsigned int)sProgress.iEtaSeconds);
+	}
+	else
+	{
+		fFormatString(sRight, sizeof(sRight), "%um%02us", (unsigned int)(sProgress.iEtaSeconds / 60U), (unsigned int)(sProgress.iEtaSeconds % 60U));
+	}
+	fFormatString(sLine, sizeof(sLine), "%-9s%7s", sLeft, sRight);
+	fDisplayString(0, PROGRESS_TOP + GLYPH_HEIGHT, displaybuffer, sLine);
+
+	// 막대 테두리와 안쪽 1 pixel 여백. 이미 그려져 있으면 바뀌는 byte가 없다
+	fDisplayFillRect(0, PROGRESS_BAR_TOP, DISPLAY_WIDTH, 1, 1, displaybuffer);
+	fDisplayFillRect(0, DISPLAY_HEIGHT - 1, DISPLAY_WIDTH, 1, 1, displaybuffer);
+	fDisplayFillRect(0, PROGRESS_BAR_TOP, 1, PROGRESS_BAR_HEIGHT, 1, displaybuffer);
+	fDisplayFillRect(DISPLAY_WIDTH - 1, PROGRESS_BAR_TOP, 1, PROGRESS_BAR_HEIGHT, 1, displaybuffer);
+	fDisplayFillRect(1, PROGRESS_BAR_TOP + 1, DISPLAY_WIDTH - 2, 1, 0, displaybuffer);
+	fDisplayFillRect(1, DISPLAY_HEIGHT - 2, DISPLAY_WIDTH - 2, 1, 0, displaybuffer);
+	fDisplayFillRect(1, PROGRESS_BAR_TOP + 2, 1, PROGRESS_BAR_HEIGHT - 4, 0, displaybuffer);
+	fDisplayFillRect(DISPLAY_WIDTH - 2, PROGRESS_BAR_TOP + 2, 1, PROGRESS_BAR_HEIGHT - 4, 0, displaybuffer);
+
+	// 안쪽은 진행된 만큼 켜고 나머지는 끈다. 겹치지 않게 나눠서 늘어난 column만 dirty가 된다
+	fDisplayFillRect(PROGRESS_BAR_INNER_X, PROGRESS_BAR_TOP + 2, (int)iFill, PROGRESS_BAR_HEIGHT - 4, 1, displaybuffer);
+	fDisplayFillRect(PROGRESS_BAR_INNER_X + (int)iFill, PROGRESS_BAR_TOP + 2, PROGRESS_BAR_INNER_WIDTH - (int)iFill, PROGRESS_BAR_HEIGHT - 4, 0, displaybuffer);
+}
+
+/*
+ *  @brief	현재 진행 상황
+ *  @param	None
+ *  @retval	진행 상황 구조체 주소
+ */
+const ProgressTypeDef *fProgressGet(void)
+{
+	return &sProgress;
+}
@@ -0,0 +1,64 @@
+/*
+ * ramload.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "ramload.h"
+
+#include <string.h>
+
+// linker script 심볼, RAM load 영역 시작과 끝
+extern uint32_t _sramload;
+extern uint32_t _eramload;
+
+/*
+ *  @brief	RAM load 영역 크기
+ *  @param	None
+ *  @retval	영역 크기 (Byte), linker script에 영역이 없거나 시작 주소가 다르면 0
+ */
+uint32_t fRamLoadSize(void)
+{
+	if ((uint32_t)&_sramload != RAMLOAD_ADDRESS)
+	{
+		return 0;
+	}
+	return (uint32_t)&_eramload - (uint32_t)&_sramload;
+}
+
+/*
+ *  @brief	주소 범위가 RAM load 영역 안에 있는지 확인
+ *  @param	Address	시작 주소
+ *			iSize	크기 (Byte)
+ *  @retval	영역 안이면 1, 아니면 0
+ */
+int fRamLoadContains(uint32_t Address, uint32_t iSize)
+{
+	uint32_t iWindow = fRamLoadSize();
+
+	// 끝 주소 overflow 없이 비교
+	if ((Address < RAMLOAD_ADDRESS) || (iSize > iWindow) || ((Address - RAMLOAD_ADDRESS) > (iWindow - iSize)))
+	{
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ *  @brief	받은 payload를 RAM load 영역에 복사. 영역을 벗어나면 bootloader RAM을 덮지 않도록 쓰지 않는다
+ *  @param	Address	기록할 주소
+ *			data	payload
+ *			iSize	크기 (Byte)
+ *  @retval	0은 성공, -1은 영역 밖
+ */
+int fRamLoadWrite(uint32_t Address, const uint32_t *data, uint32_t iSize)
+{
+	if (fRamLoadContains(Address, iSize) == 0)
+	{
+		return -1;
+	}
+	memcpy((void *)Address, data, iSize);
+	return 0;
+}
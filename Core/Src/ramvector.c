@@ -0,0 +1,68 @@
+/*
+ * ramvector.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+
+#include "ramvector.h"
+
+/*
+ *	SRAM에 복사한 vector table. Flash sector를 지우는 동안에는 같은 bank에서 명령어를
+ *	읽을 수 없기 때문에 인터럽트가 vector를 Flash에서 읽으면 erase가 끝날때까지 멈춘다.
+ *	VTOR 조건에 맞게 512 Byte 정렬, 시작할 때 0으로 초기화 할 필요 없으므로 NOLOAD 영역에 둔다
+ */
+static uint32_t iRamVectorTable[VECTOR_TABLE_SIZE] __attribute__((section(".ram_vector"), aligned(512)));
+
+// Flash에 있는 원래 vector table, startup 파일에 정의
+extern uint32_t g_pfnVectors[];
+
+/*
+ *  @brief	현재 vector table을 SRAM으로 복사하고 VTOR을 SRAM 쪽으로 변경
+ *  @param	None
+ *  @retval	None
+ */
+void fVectorTableToRam(void)
+{
+	// 이미 SRAM table 사용 중이면 다시 복사하지 않는다
+	if (SCB->VTOR == (uint32_t)iRamVectorTable)
+	{
+		return;
+	}
+
+	__disable_irq();
+
+	for (int i = 0; i < VECTOR_TABLE_SIZE; i++)
+	{
+		iRamVectorTable[i] = g_pfnVectors[i];
+	}
+
+	SCB->VTOR = (uint32_t)iRamVectorTable;
+	__DSB();
+
+	__enable_irq();
+}
+
+/*
+ *  @brief	SRAM vector table의 handler 교체
+ *  @param	IRQn		교체 할 인터럽트 번호 (SysTick_IRQn 등 시스템 예외 포함)
+ *			handler		새 handler, Flash erase 중에도 동작해야 하면 __RAM_FUNC여야 한다
+ *  @retval	None
+ */
+void fVectorTableSetHandler(IRQn_Type IRQn, void (*handler)(void))
+{
+	iRamVectorTable[(int)IRQn + 16] = (uint32_t)handler;
+	__DSB();
+}
+
+/*
+ *  @brief	Flash vector table로 복귀
+ *  @param	None
+ *  @retval	None
+ */
+void fVectorTableRestore(void)
+{
+	SCB->VTOR = (uint32_t)g_pfnVectors;
+	__DSB();
+}
@@ -0,0 +1,225 @@
+/*
+ * sha256.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "sha256.h"
+
+#include <string.h>
+
+// round 상수
+static const uint32_t sSha256K[64] =
+{
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+/*
+ *	Cortex-M4에서 ROR은 다른 연산의 shift operand로 공짜로 붙고 big endian load는 REV 한 명령이다.
+ *	round는 변수 이름을 돌려가며 8개씩 풀어서 a~h를 옮기는 mov가 생기지 않게 하고,
+ *	message schedule은 16 word만 두고 제자리에서 갱신한다. 64 round를 다 풀면 bootloader partition에
+ *	code가 4K 가까이 늘어나므로 8 round 묶음을 loop로 돈다
+ */
+#define SHA256_ROR(x, n)		(((x) >> (n)) | ((x) << (32 - (n))))
+#define SHA256_S0(x)			(SHA256_ROR(x, 2) ^ SHA256_ROR(x, 13) ^ SHA256_ROR(x, 22))
+#define SHA256_S1(x)			(SHA256_ROR(x, 6) ^ SHA256_ROR(x, 11) ^ SHA256_ROR(x, 25))
+#define SHA256_G0(x)			(SHA256_ROR(x, 7) ^ SHA256_ROR(x, 18) ^ ((x) >> 3))
+#define SHA256_G1(x)			(SHA256_ROR(x, 17) ^ SHA256_ROR(x, 19) ^ ((x) >> 10))
+#define SHA256_CH(x, y, z)		((z) ^ ((x) & ((y) ^ (z))))
+#define SHA256_MAJ(x, y, z)		(((x) & (y)) | ((z) & ((x) | (y))))
+
+// i번째 schedule word, 16번째부터는 앞 16개로 갱신해 둔다
+#define SHA256_W(i)				sW[(i) & 15]
+#define SHA256_SCHEDULE(i)		(sW[(i) & 15] += SHA256_G1(sW[((i) - 2) & 15]) + sW[((i) - 7) & 15] + SHA256_G0(sW[((i) - 15) & 15]))
+
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i, w)								\
+	do																			\
+	{																			\
+		uint32_t iT1 = (h) + SHA256_S1(e) + SHA256_CH(e, f, g) + sSha256K[i] + (w);	\
+		(d) += iT1;																\
+		(h) = iT1 + SHA256_S0(a) + SHA256_MAJ(a, b, c);							\
+	} while (0)
+
+#define SHA256_ROUND8(i, w)														\
+	do																			\
+	{																			\
+		SHA256_ROUND(a, b, c, d, e, f, g, h, (i) + 0, w((i) + 0));				\
+		SHA256_ROUND(h, a, b, c, d, e, f, g, (i) + 1, w((i) + 1));				\
+		SHA256_ROUND(g, h, a, b, c, d, e, f, (i) + 2, w((i) + 2));				\
+		SHA256_ROUND(f, g, h, a, b, c, d, e, (i) + 3, w((i) + 3));				\
+		SHA256_ROUND(e, f, g, h, a, b, c, d, (i) + 4, w((i) + 4));				\
+		SHA256_ROUND(d, e, f, g, h, a, b, c, (i) + 5, w((i) + 5));				\
+		SHA256_ROUND(c, d, e, f, g, h, a, b, (i) + 6, w((i) + 6));				\
+		SHA256_ROUND(b, c, d, e, f, g, h, a, (i) + 7, w((i) + 7));				\
+	} while (0)
+
+/*
+ *  @brief	big endian word 읽기, 정렬되지 않은 주소도 된다
+ */
+static inline uint32_t fSha256Load(const uint8_t *sData)
+{
+	uint32_t iWord;
+
+	memcpy(&iWord, sData, 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	iWord = __builtin_bswap32(iWord);
+#endif
+	return iWord;
+}
+
+/*
+ *  @brief	64 Byte block 여러개 처리
+ *  @param	pSha	계산 상태
+ *			sData	block 시작 주소
+ *			iBlocks	block 수
+ *  @retval	None
+ */
+static void fSha256Blocks(Sha256TypeDef *pSha, const uint8_t *sData, uint32_t iBlocks)
+{
+	uint32_t sW[16];
+	uint32_t a, b, c, d, e, f, g, h;
+
+	while (iBlocks > 0)
+	{
+		for (int i = 0; i < 16; i++)
+		{
+			sW[i] = fSha256Load(sData + (i * 4));
+		}
+
+		a = pSha->iState[0];
+		b = pSha->iState[1];
+		c = pSha->iState[2];
+		d = pSha->iState[3];
+		e = pSha->iState[4];
+		f = pSha->iState[5];
+		g = pSha->iState[6];
+		h = pSha->iState[7];
+
+		for (int i = 0; i < 64; i += 8)
+		{
+			// 처음 16 round는 읽은 word 그대로
+			if (i >= 16)
+			{
+				for (int j = i; j < i + 8; j++)
+				{
+					SHA256_SCHEDULE(j);
+				}
+			}
+			SHA256_ROUND8(i, SHA256_W);
+		}
+
+		pSha->iState[0] += a;
+		pSha->iState[1] += b;
+		pSha->iState[2] += c;
+		pSha->iState[3] += d;
+		pSha->iState[4] += e;
+		pSha->iState[5] += f;
+		pSha->iState[6] += g;
+		pSha->iState[7] += h;
+
+		sData += SHA256_BLOCK_SIZE;
+		iBlocks--;
+	}
+}
+
+/*
+ *  @brief	계산 시작
+ *  @param	pSha	계산 상태
+ *  @retval	None
+ */
+void fSha256Init(Sha256TypeDef *pSha)
+{
+	pSha->iState[0] = 0x6A09E667;
+	pSha->iState[1] = 0xBB67AE85;
+	pSha->iState[2] = 0x3C6EF372;
+	pSha->iState[3] = 0xA54FF53A;
+	pSha->iState[4] = 0x510E527F;
+	pSha->iState[5] = 0x9B05688C;
+	pSha->iState[6] = 0x1F83D9AB;
+	pSha->iState[7] = 0x5BE0CD19;
+	pSha->iLength = 0;
+	pSha->iFill = 0;
+}
+
+/*
+ *  @brief	data 추가. 64 Byte 단위는 복사하지 않고 바로 처리한다
+ *  @param	pSha	계산 상태
+ *			sData	data
+ *			iLength	data 길이
+ *  @retval	None
+ */
+void fSha256Update(Sha256TypeDef *pSha, const uint8_t *sData, uint32_t iLength)
+{
+	uint32_t iCount;
+
+	pSha->iLength += iLength;
+
+	// 남겨 둔 data가 있으면 block을 먼저 채운다
+	if (pSha->iFill > 0)
+	{
+		iCount = SHA256_BLOCK_SIZE - pSha->iFill;
+		iCount = (iCount < iLength) ? iCount : iLength;
+		memcpy(&pSha->sBlock[pSha->iFill], sData, iCount);
+		pSha->iFill += iCount;
+		sData += iCount;
+		iLength -= iCount;
+
+		if (pSha->iFill < SHA256_BLOCK_SIZE)
+		{
+			return;
+		}
+		fSha256Blocks(pSha, pSha->sBlock, 1);
+		pSha->iFill = 0;
+	}
+
+	if (iLength >= SHA256_BLOCK_SIZE)
+	{
+		fSha256Blocks(pSha, sData, iLength / SHA256_BLOCK_SIZE);
+		sData += iLength & ~(uint32_t)(SHA256_BLOCK_SIZE - 1);
+		iLength &= SHA256_BLOCK_SIZE - 1;
+	}
+
+	memcpy(pSha->sBlock, sData, iLength);
+	pSha->iFill = iLength;
+}
+
+/*
+ *  @brief	padding 후 결과
+ *  @param	pSha	계산 상태
+ *			sDigest	결과 32 Byte를 돌려 줄 버퍼
+ *  @retval	None
+ */
+void fSha256Final(Sha256TypeDef *pSha, uint8_t *sDigest)
+{
+	uint64_t iBits = pSha->iLength * 8;
+
+	pSha->sBlock[pSha->iFill++] = 0x80;
+	if (pSha->iFill > SHA256_BLOCK_SIZE - 8)
+	{
+		memset(&pSha->sBlock[pSha->iFill], 0x00, SHA256_BLOCK_SIZE - pSha->iFill);
+		fSha256Blocks(pSha, pSha->sBlock, 1);
+		pSha->iFill = 0;
+	}
+	memset(&pSha->sBlock[pSha->iFill], 0x00, SHA256_BLOCK_SIZE - 8 - pSha->iFill);
+
+	for (int i = 0; i < 8; i++)
+	{
+		pSha->sBlock[SHA256_BLOCK_SIZE - 1 - i] = (uint8_t)(iBits >> (i * 8));
+	}
+	fSha256Blocks(pSha, pSha->sBlock, 1);
+
+	for (int i = 0; i < 8; i++)
+	{
+		sDigest[(i * 4) + 0] = (uint8_t)(pSha->iState[i] >> 24);
+		sDigest[(i * 4) + 1] = (uint8_t)(pSha->iState[i] >> 16);
+		sDigest[(i * 4) + 2] = (uint8_t)(pSha->iState[i] >> 8);
+		sDigest[(i * 4) + 3] = (uint8_t)pSha->iState[i];
+	}
+}
@@ -24,6 +24,10 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "bootcode.h"
+#include "log.h"
+#include "i2c.h"
+#include "oledqueue.h"
+#include "transport.h"
 
 /* USER CODE END Includes */
 
@@ -89,7 +93,7 @@ void NMI_Handler(void)
 void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
-	printf("HardFault_Handler\r\n");
+	fLog(LOG_HARD_FAULT, 0);
 
     // RED LED On
 	HAL_GPIO_WritePin( GPIOB,  GPIO_PIN_14,GPIO_PIN_SET);
@@ -108,7 +112,7 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-	printf("MemManage_Handler\r\n");
+	fLog(LOG_MEM_MANAGE_FAULT, 0);
 
     // RED LED On
     HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_SET);
@@ -128,7 +132,7 @@ void MemManage_Handler(void)
 void BusFault_Handler(void)
 {
   /* USER CODE BEGIN BusFault_IRQn 0 */
-	printf("BusFault_Handler\r\n");
+	fLog(LOG_BUS_FAULT, 0);
 
     // RED LED On
     HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_SET);
@@ -148,7 +152,7 @@ void BusFault_Handler(void)
 void UsageFault_Handler(void)
 {
   /* USER CODE BEGIN UsageFault_IRQn 0 */
-	printf("UsageFault_Handler\r\n");
+	fLog(LOG_USAGE_FAULT, 0);
 
     // RED LED On
     HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_SET);
@@ -243,18 +247,8 @@ void USART2_IRQHandler(void)
 {
   /* USER CODE BEGIN USART2_IRQn 0 */
     
-    // Event Flag
-    uint32_t uartflag = __HAL_UART_GET_FLAG(&huart2, UART_FLAG_RXNE);
-    uint32_t uartitsource = __HAL_UART_GET_IT_SOURCE(&huart2, UART_IT_RXNE);
-
-	/* UART in mode Receiver ---------------------------------------------------*/
-
-	if ((uartflag != RESET) && (uartitsource != RESET)) {
-		/* 수신 레지스터에서 링버퍼로 한 바이트 복사 */
-		getRxBuffer((uint8_t)( huart2.Instance->DR & (uint8_t)0x00FF));
-	}
-    /* 이벤트 플래그 삭제 */
-	__HAL_UART_CLEAR_PEFLAG(&huart2); 
+	/* 수신 바이트는 transport 채널로 (고정 전 줄 버퍼 또는 getRxBuffer) */
+	fTransportRxIsr(TRANSPORT_UART2);
 	return; /* IRQ 핸들러 종료 */
 
   /* USER CODE END USART2_IRQn 0 */
@@ -265,6 +259,78 @@ void USART2_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief SRAM에서 실행되는 USART2 수신 handler.
+  *        업데이트 중 SRAM vector table에 등록되어 Flash erase 중에도 수신을 계속한다.
+  */
+__RAM_FUNC void USART2_RamIRQHandler(void)
+{
+	fTransportRxIsr(TRANSPORT_UART2);
+}
+
+/**
+  * @brief USART3 (ST-LINK VCP) global interrupt. Cube 설정에는 없는 인터럽트라 여기서 처리
+  */
+void USART3_IRQHandler(void)
+{
+	fTransportRxIsr(TRANSPORT_UART3);
+}
+
+/**
+  * @brief SRAM에서 실행되는 USART3 수신 handler. USART2_RamIRQHandler와 같은 역할
+  */
+__RAM_FUNC void USART3_RamIRQHandler(void)
+{
+	fTransportRxIsr(TRANSPORT_UART3);
+}
+
+/**
+  * @brief SRAM에서 실행되는 SysTick handler.
+  *        SysTick_Handler와 같은 동작을 HAL 함수 호출 없이 처리한다.
+  */
+__RAM_FUNC void SysTick_RamHandler(void)
+{
+    //Update Waiting Counter
+	if(iGlobalTimerStart == 1)
+	{
+		iGlobalTimer++;
+	}
+
+    //Blue LED Blink 1sec period
+	i++;
+	if( i == 1000)
+	{
+		GPIOB->ODR ^= GPIO_PIN_7;
+		i=0;
+	}
+
+	// HAL_IncTick()
+	uwTick += uwTickFreq;
+}
+
+/**
+  * @brief I2C2 TX DMA (OLED queue) 전송 handler.
+  */
+void DMA1_Stream7_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_i2c2_tx);
+}
+
+/**
+  * @brief I2C2 event handler, OLED queue 전송의 START/주소/STOP 단계 처리.
+  */
+void I2C2_EV_IRQHandler(void)
+{
+	HAL_I2C_EV_IRQHandler(&hi2c2);
+}
+
+/**
+  * @brief I2C2 error handler.
+  */
+void I2C2_ER_IRQHandler(void)
+{
+	HAL_I2C_ER_IRQHandler(&hi2c2);
+}
 
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,379 @@
+/*
+ * transport.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+#include "usart.h"
+
+#include "transport.h"
+#include "arena.h"
+#include "bootcode.h"
+#include "log.h"
+
+#include <string.h>
+
+// 수신 채널, 채널 번호 순서
+static TransportChannelTypeDef sTransportChannel[TRANSPORT_COUNT] =
+{
+	{ &huart2, USART2_IRQn, GPIOD, GPIO_PIN_6, sArena.uPhase.sTransportLine[TRANSPORT_UART2], 0, 0 },
+	{ &huart3, USART3_IRQn, STLK_TX_GPIO_Port, STLK_TX_Pin, sArena.uPhase.sTransportLine[TRANSPORT_UART3], 0, 0 },
+};
+
+// 자동 baud rate 측정 결과를 맞춰 볼 표준 baud rate
+static const uint32_t sTransportBaudRate[] =
+{
+	9600, 19200, 38400, 57600, 115200, 230400, 460800, 921600, 1000000, 2000000,
+};
+
+// 고정된 채널 번호, 없으면 TRANSPORT_NONE
+static volatile int iTransportActive = TRANSPORT_NONE;
+
+// 고정된 채널 수신 handler가 쓴 DWT cycle 누적 (fTransportTakeRxCycles()로 가져간다)
+static volatile uint32_t iTransportRxCycles = 0;
+
+// static function
+static uint32_t fTransportMeasureSync(TransportChannelTypeDef *pChannel, uint32_t iStartCycle);
+static uint32_t fTransportSnapBaudRate(uint32_t iBaudRate);
+
+/*
+ *  @brief	채널 상태 초기화. 아직 고정된 채널 없음
+ *  @param	None
+ *  @retval	None
+ */
+void fTransportInit(void)
+{
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		sTransportChannel[i].iLineLength = 0;
+		sTransportChannel[i].iLineReady = 0;
+	}
+	iTransportActive = TRANSPORT_NONE;
+}
+
+/*
+ *  @brief	수신 인터럽트 켜기. 고정 전에는 모든 채널, 고정 후에는 고정된 채널만
+ *  @param	None
+ *  @retval	None
+ */
+void fTransportEnableRx(void)
+{
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		if ((iTransportActive == TRANSPORT_NONE) || (iTransportActive == i))
+		{
+			__HAL_UART_ENABLE_IT(sTransportChannel[i].pHandle, UART_IT_RXNE);
+		}
+	}
+}
+
+/*
+ *  @brief	고정 전 채널 중 완성된 줄이 있으면 복사해 가져온다. 가져간 채널은 다음 줄을 받기 시작
+ *  @param	sData	줄을 복사할 버퍼 ("\r\n" 포함)
+ *			iSize	sData 크기
+ *			iLength	복사한 길이를 돌려 줄 변수 주소. checksum이 0x00일 수 있으므로 문자열 길이로 구하지 않는다
+ *  @retval	줄을 보낸 채널 번호, 완성된 줄이 없으면 TRANSPORT_NONE
+ */
+int fTransportTakeLine(uint8_t *sData, int iSize, int *iLength)
+{
+	TransportChannelTypeDef *pChannel;
+
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		pChannel = &sTransportChannel[i];
+		if (pChannel->iLineReady == 0)
+		{
+			continue;
+		}
+
+		*iLength = (pChannel->iLineLength < iSize) ? pChannel->iLineLength : iSize;
+		memset(sData, 0x00, iSize);
+		memcpy(sData, pChannel->pLine, *iLength);
+
+		pChannel->iLineLength = 0;
+		pChannel->iLineReady = 0;
+		return i;
+	}
+	return TRANSPORT_NONE;
+}
+
+/*
+ *  @brief	채널 고정. 다른 채널은 수신 인터럽트를 끄고 이후 송수신은 이 채널만 사용
+ *  @param	iChannel	고정할 채널 번호
+ *  @retval	None
+ */
+void fTransportLock(int iChannel)
+{
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		if (i != iChannel)
+		{
+			__HAL_UART_DISABLE_IT(sTransportChannel[i].pHandle, UART_IT_RXNE);
+			HAL_NVIC_DisableIRQ(sTransportChannel[i].iIrq);
+		}
+	}
+	iTransportActive = iChannel;
+}
+
+/*
+ *  @brief	고정된 채널 번호
+ *  @param	None
+ *  @retval	채널 번호, 없으면 TRANSPORT_NONE
+ */
+int fTransportActive(void)
+{
+	return iTransportActive;
+}
+
+/*
+ *  @brief	고정된 채널의 UART handle
+ *  @param	None
+ *  @retval	handle 주소, 고정 전이면 NULL
+ */
+UART_HandleTypeDef *fTransportHandle(void)
+{
+	if (iTransportActive == TRANSPORT_NONE)
+	{
+		return NULL;
+	}
+	return sTransportChannel[iTransportActive].pHandle;
+}
+
+/*
+ *  @brief	데이터 전송. 고정 전에는 host가 어느 쪽에 붙어 있어도 받도록 모든 채널로 보낸다
+ *  @param	sData		보낼 데이터
+ *			iLength		길이
+ *			iTimeout	채널별 전송 timeout (ms)
+ *  @retval	None
+ */
+void fTransportWrite(const uint8_t *sData, uint16_t iLength, uint32_t iTimeout)
+{
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		if ((iTransportActive == TRANSPORT_NONE) || (iTransportActive == i))
+		{
+			HAL_UART_Transmit(sTransportChannel[i].pHandle, (uint8_t *)sData, iLength, iTimeout);
+		}
+	}
+}
+
+/*
+ *  @brief	고정 전 READY 사이 대기. 대기하는 동안 각 채널 RX pin에서 sync byte를 찾아 baud rate를 맞춘다.
+ *			고정 후나 TRANSPORT_AUTOBAUD가 0이면 그냥 기다린다
+ *  @param	iWindow	대기 시간 (ms)
+ *  @retval	baud rate를 바꾼 채널 번호, 없으면 TRANSPORT_NONE
+ */
+int fTransportAutoBaud(uint32_t iWindow)
+{
+	TransportChannelTypeDef *pChannel;
+	uint32_t iStartTick = HAL_GetTick();
+	// 채널별 직전 RX pin 상태, idle은 high
+	uint8_t sLevel[TRANSPORT_COUNT];
+	uint8_t iLevel;
+	uint32_t iBitCycles;
+	uint32_t iBaudRate;
+	int iResult = TRANSPORT_NONE;
+
+	if ((TRANSPORT_AUTOBAUD == 0) || (iTransportActive != TRANSPORT_NONE))
+	{
+		HAL_Delay(iWindow);
+		return TRANSPORT_NONE;
+	}
+
+	for (int i = 0; i < TRANSPORT_COUNT; i++)
+	{
+		sLevel[i] = 1;
+	}
+
+	while ((HAL_GetTick() - iStartTick) < iWindow)
+	{
+		for (int i = 0; i < TRANSPORT_COUNT; i++)
+		{
+			pChannel = &sTransportChannel[i];
+			iLevel = ((pChannel->pRxPort->IDR & pChannel->iRxPin) != 0) ? 1 : 0;
+
+			// 줄을 받는 중이면 정상 속도로 오는 패킷이므로 재지 않는다
+			if ((iLevel == 0) && (sLevel[i] == 1) && (pChannel->iLineLength == 0) && (pChannel->iLineReady == 0))
+			{
+				iBitCycles = fTransportMeasureSync(pChannel, DWT->CYCCNT);
+				if (iBitCycles != 0)
+				{
+					iBaudRate = fTransportSnapBaudRate((SystemCoreClock + (iBitCycles / 2)) / iBitCycles);
+					if ((iBaudRate != 0) && (iBaudRate != pChannel->pHandle->Init.BaudRate))
+					{
+						fTransportSetBaudRate(i, iBaudRate);
+						fLog(LOG_TRANSPORT_BAUD, 2, i, iBaudRate);
+						iResult = i;
+					}
+				}
+				iLevel = 0;
+			}
+			sLevel[i] = iLevel;
+		}
+	}
+	return iResult;
+}
+
+/*
+ *  @brief	RX pin에서 시작 bit를 본 직후 호출. sync byte (0x55)의 나머지 edge 9개 시간을 잰다.
+ *			재는 동안(1 byte 시간 이하)은 인터럽트를 막는다. UART가 받은 byte는 DR에 남아 있다가 처리된다
+ *  @param	pChannel	측정할 채널
+ *			iStartCycle	시작 bit falling edge를 본 DWT cycle
+ *  @retval	1 bit cycle 수, sync byte가 아니면 0
+ */
+static uint32_t fTransportMeasureSync(TransportChannelTypeDef *pChannel, uint32_t iStartCycle)
+{
+	// 첫 edge는 가장 느린 baud rate의 1.5 bit 안에 와야 한다
+	uint32_t iLimit = (SystemCoreClock / TRANSPORT_AUTOBAUD_MIN_RATE) + (SystemCoreClock / TRANSPORT_AUTOBAUD_MIN_RATE / 2);
+	uint32_t iLastEdge = iStartCycle;
+	uint32_t iBitCycles = 0;
+	uint32_t iNow, iInterval;
+	uint8_t iLevel = 0;
+
+	__disable_irq();
+	for (int i = 0; i < 9; i++)
+	{
+		// 다음 edge까지 대기
+		do
+		{
+			iNow = DWT->CYCCNT;
+			if ((iNow - iLastEdge) > iLimit)
+			{
+				__enable_irq();
+				return 0;
+			}
+		} while ((((pChannel->pRxPort->IDR & pChannel->iRxPin) != 0) ? 1 : 0) == iLevel);
+
+		iInterval = iNow - iLastEdge;
+		iLastEdge = iNow;
+		iLevel ^= 1;
+
+		if (i == 0)
+		{
+			// 시작 bit 길이를 1 bit로 보고 이후 간격은 0.75 ~ 1.25 bit 안이어야 한다
+			iBitCycles = iInterval;
+			iLimit = iBitCycles + (iBitCycles / 4);
+		}
+		else if (iInterval < (iBitCycles - (iBitCycles / 4)))
+		{
+			__enable_irq();
+			return 0;
+		}
+	}
+	__enable_irq();
+
+	// 9 bit 전체 길이로 평균, polling 간격 오차가 나뉜다
+	return (iLastEdge - iStartCycle) / 9;
+}
+
+/*
+ *  @brief	잰 baud rate를 가까운 표준 값으로 맞춘다. 가까운 값이 없으면 잰 값을 그대로 사용
+ *  @param	iBaudRate	잰 baud rate
+ *  @retval	사용할 baud rate, UART가 낼 수 없는 값이면 0
+ */
+static uint32_t fTransportSnapBaudRate(uint32_t iBaudRate)
+{
+	uint32_t iDifference;
+
+	// oversampling 16 기준 최고 속도는 PCLK1 / 16 (USART2, USART3는 APB1)
+	if ((iBaudRate < TRANSPORT_AUTOBAUD_MIN_RATE - (TRANSPORT_AUTOBAUD_MIN_RATE * TRANSPORT_AUTOBAUD_SNAP_PERCENT / 100)) || (iBaudRate > HAL_RCC_GetPCLK1Freq() / 16))
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < sizeof(sTransportBaudRate) / sizeof(sTransportBaudRate[0]); i++)
+	{
+		iDifference = (iBaudRate > sTransportBaudRate[i]) ? (iBaudRate - sTransportBaudRate[i]) : (sTransportBaudRate[i] - iBaudRate);
+		if ((iDifference * 100) <= (sTransportBaudRate[i] * TRANSPORT_AUTOBAUD_SNAP_PERCENT))
+		{
+			return sTransportBaudRate[i];
+		}
+	}
+	return iBaudRate;
+}
+
+/*
+ *  @brief	채널 baud rate 변경. 보내던 byte가 끝난 뒤 BRR만 바꾸고 받던 줄은 버린다
+ *  @param	iChannel	채널 번호
+ *			iBaudRate	baud rate
+ *  @retval	None
+ */
+void fTransportSetBaudRate(int iChannel, uint32_t iBaudRate)
+{
+	TransportChannelTypeDef *pChannel = &sTransportChannel[iChannel];
+	UART_HandleTypeDef *pHandle = pChannel->pHandle;
+	uint32_t iStartTick = HAL_GetTick();
+
+	while ((__HAL_UART_GET_FLAG(pHandle, UART_FLAG_TC) == RESET) && ((HAL_GetTick() - iStartTick) < 10))
+	{
+	}
+
+	__HAL_UART_DISABLE(pHandle);
+	pHandle->Init.BaudRate = iBaudRate;
+	pHandle->Instance->BRR = UART_BRR_SAMPLING16(HAL_RCC_GetPCLK1Freq(), iBaudRate);
+	__HAL_UART_ENABLE(pHandle);
+
+	pChannel->iLineLength = 0;
+	pChannel->iLineReady = 0;
+}
+
+/*
+ *  @brief	마지막으로 가져간 뒤 고정된 채널 수신 handler가 쓴 cycle. 가져가면 0부터 다시 센다.
+ *			수신 인터럽트가 꺼져 있을 때 (패킷 처리 중) 부른다
+ *  @param	None
+ *  @retval	누적 cycle (exception 진입/복귀 제외)
+ */
+uint32_t fTransportTakeRxCycles(void)
+{
+	uint32_t iCycles = iTransportRxCycles;
+
+	iTransportRxCycles = 0;
+	return iCycles;
+}
+
+/*
+ *  @brief	채널 수신 인터럽트 처리. 고정된 채널이면 getRxBuffer()로, 고정 전이면 채널 줄 버퍼에 받는다
+ *  @param	iChannel	인터럽트가 발생한 채널 번호
+ *  @retval	None
+ */
+__RAM_FUNC void fTransportRxIsr(int iChannel)
+{
+	// 측정은 flag 확인부터, perf.c 함수는 Flash에 있으므로 DWT를 직접 읽는다
+	uint32_t iStartCycle = DWT->CYCCNT;
+	TransportChannelTypeDef *pChannel = &sTransportChannel[iChannel];
+	UART_HandleTypeDef *pHandle = pChannel->pHandle;
+	uint8_t iData;
+
+	if ((__HAL_UART_GET_FLAG(pHandle, UART_FLAG_RXNE) != RESET) && (__HAL_UART_GET_IT_SOURCE(pHandle, UART_IT_RXNE) != RESET))
+	{
+		/* 수신 레지스터에서 한 바이트 읽기 */
+		iData = (uint8_t)(pHandle->Instance->DR & (uint8_t)0x00FF);
+
+		if (iTransportActive == iChannel)
+		{
+			getRxBuffer(iData);
+			iTransportRxCycles += DWT->CYCCNT - iStartCycle;
+		}
+		// 고정 전 줄은 '['로 시작한다. sync byte나 속도가 맞지 않던 때의 값은 버린다
+		else if ((iTransportActive == TRANSPORT_NONE) && (pChannel->iLineReady == 0) && ((pChannel->iLineLength != 0) || (iData == '[')))
+		{
+			if (pChannel->iLineLength < TRANSPORT_LINE_SIZE)
+			{
+				pChannel->pLine[pChannel->iLineLength++] = iData;
+				// bootcode와 같이 "\r\n"을 줄 끝으로 본다. checksum 자리에 '\n'이 올 수 있으므로
+				if ((iData == '\n') && (pChannel->iLineLength >= 2) && (pChannel->pLine[pChannel->iLineLength - 2] == '\r'))
+				{
+					pChannel->iLineReady = 1;
+				}
+			}
+			else if (iData == '\n')
+			{
+				// 버퍼를 넘친 줄은 버리고 다음 줄부터 다시 받는다
+				pChannel->iLineLength = 0;
+			}
+		}
+	}
+	/* 이벤트 플래그 삭제 */
+	__HAL_UART_CLEAR_PEFLAG(pHandle);
+}
@@ -0,0 +1,71 @@
+/*
+ * uartio.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+#include "main.h"
+#include "usart.h"
+
+#include "uartio.h"
+#include "transport.h"
+#include "format.h"
+#include "perf.h"
+
+/*
+ *	newlib printf 대신 사용하는 UART 송신 함수. format.c의 formatter로 stack 버퍼에
+ *	만든 뒤 보내므로 printf, heap(_sbrk) 없이 동작한다
+ */
+
+/*
+ *  @brief	binary 데이터 전송. 업데이트 채널이 정해지기 전에는 모든 채널로 보낸다 (transport.c)
+ *  @param	sData	보낼 데이터
+ *			iLength	길이
+ *  @retval	None
+ */
+void fUartWrite(const uint8_t *sData, uint16_t iLength)
+{
+	fTransportWrite(sData, iLength, UARTIO_TX_TIMEOUT);
+}
+
+/*
+ *  @brief	문자열 전송
+ *  @param	sData	NULL로 끝나는 문자열
+ *  @retval	None
+ */
+void fUartPrint(const char *sData)
+{
+	uint16_t iLength = 0;
+
+	while (sData[iLength] != '\0')
+	{
+		iLength++;
+	}
+	fUartWrite((const uint8_t *)sData, iLength);
+}
+
+/*
+ *  @brief	format 문자열 전송 (printf 대체), UARTIO_FORMAT_BUFFER_SIZE 넘는 부분은 잘린다
+ *  @param	sFormat	format 문자열 (format.h 참고)
+ *			...		인자
+ *  @retval	None
+ */
+void fUartPrintFormat(const char *sFormat, ...)
+{
+	char sBuffer[UARTIO_FORMAT_BUFFER_SIZE];
+	va_list ap;
+	int iLength;
+	uint32_t iStartCycle = fPerfStart();
+
+	va_start(ap, sFormat);
+	iLength = fFormatStringV(sBuffer, sizeof(sBuffer), sFormat, ap);
+	va_end(ap);
+
+	if (iLength > (int)sizeof(sBuffer) - 1)
+	{
+		iLength = sizeof(sBuffer) - 1;
+	}
+	fPerfStop(PERF_FORMAT, iStartCycle, iLength);
+
+	fUartWrite((const uint8_t *)sBuffer, (uint16_t)iLength);
+}
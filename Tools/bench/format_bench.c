@@ -0,0 +1,92 @@
+/*
+ * format_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 fFormatString과 libc snprintf를 같은 입력으로 비교한다.
+ *	결과가 같은지 먼저 확인한 뒤 호출당 시간(ns)을 출력한다. -fno-builtin은 gcc가 상수
+ *	format의 snprintf를 memcpy로 바꿔 비교가 무의미해지는 것을 막는다.
+ *
+ *	측정마다 BENCH_ROUNDS번 돌려 가장 짧은 값을 쓴다.
+ *
+ *	gcc -O2 -fno-builtin -I Core/Inc Tools/bench/format_bench.c Core/Src/format.c -o format_bench && ./format_bench
+ *
+ *	x86-64 host -O2에서 숫자가 들어간 메세지 (END, RESUME, PERF)는 1.10~1.20배, 짧은 메세지 (DATA,ACK,
+ *	ERROR)는 1.35~1.5배 빠르다. host clock이 안정되기 전의 실행은 snprintf 쪽이 느리게 나와 2배 가까이
+ *	보이기도 하므로 여러 번 돌려 본다. target (newlib)의 차이는 PERF,FORMAT으로 확인한다.
+ *
+ *	target 쪽 수치는 LOG_TOKENIZED 0으로 빌드하면 "[MCU]PERF,FORMAT,KB당 cycle,byte"로 보고되고,
+ *	code 크기는 Tools/map_summary.py로 format.o와 libc 항목(vfprintf 등)을 비교한다.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "format.h"
+
+#define BENCH_ITERATIONS	500000
+#define BENCH_ROUNDS		7
+
+/* bootloader가 실제로 보내는 형태의 메세지 */
+#define BENCH_CASES(X)																\
+	X("[MCU]DATA,ACK")																\
+	X("[MCU]END,ACK,%08X", 0x1A2B3C4Du)												\
+	X("[MCU]RESUME,ACK,%u,%u", 123u, 45678u)											\
+	X("[MCU]PERF,%s,%u,%u", "FLASH_PROGRAM", 51234u, 131072u)						\
+	X("[MCU][ERROR]%d", -3)
+
+static double fNow(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+int main(void)
+{
+	char sOurs[96];
+	char sLibc[96];
+	volatile int iSink = 0;
+	double fStart;
+	double fNs;
+	double fOursNs;
+	double fLibcNs;
+	int iFail = 0;
+
+#define BENCH_RUN(...)																\
+	fFormatString(sOurs, sizeof(sOurs), __VA_ARGS__);								\
+	snprintf(sLibc, sizeof(sLibc), __VA_ARGS__);									\
+	if (strcmp(sOurs, sLibc) != 0)													\
+	{																				\
+		printf("MISMATCH \"%s\" != \"%s\"\n", sOurs, sLibc);						\
+		iFail = 1;																	\
+	}																				\
+	fOursNs = fLibcNs = 1e30;														\
+	for (int r = 0; r < BENCH_ROUNDS; r++)											\
+	{																				\
+		fStart = fNow();															\
+		for (int i = 0; i < BENCH_ITERATIONS; i++)									\
+		{																			\
+			iSink += fFormatString(sOurs, sizeof(sOurs), __VA_ARGS__);				\
+		}																			\
+		fNs = (fNow() - fStart) / BENCH_ITERATIONS;									\
+		fOursNs = (fNs < fOursNs) ? fNs : fOursNs;									\
+		fStart = fNow();															\
+		for (int i = 0; i < BENCH_ITERATIONS; i++)									\
+		{																			\
+			iSink += snprintf(sLibc, sizeof(sLibc), __VA_ARGS__);					\
+		}																			\
+		fNs = (fNow() - fStart) / BENCH_ITERATIONS;									\
+		fLibcNs = (fNs < fLibcNs) ? fNs : fLibcNs;									\
+	}																				\
+	printf("%-38s fFormatString %6.1f ns  snprintf %6.1f ns  (%.2fx)\n",			\
+		sOurs, fOursNs, fLibcNs, fLibcNs / fOursNs);
+
+	BENCH_CASES(BENCH_RUN)
+
+	(void)iSink;
+	return iFail;
+}
@@ -0,0 +1,189 @@
+/*
+ * glyph_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 이전 bit 단위 renderer(Font12_Table)와 display.c(glyph.h)를 비교한다.
+ *	모든 글자가 같은 버퍼를 만드는지 먼저 확인한 뒤 문자열 하나 그리는 시간(ns)을 출력한다.
+ *
+ *	gcc -O2 -I Core/Inc Tools/bench/glyph_bench.c Core/Src/display.c -o glyph_bench && ./glyph_bench
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "display.h"
+#include "font.h"
+
+#define BENCH_ITERATIONS	200000
+
+/*
+ *  @brief	이전 fDisplayChar 그대로, 비교 기준 (iLocationY = 0에서만 정상 동작)
+ */
+static void fDisplayCharBitwise(int iLocationX, int iLocationY, char cData, char* displaybuffer)
+{
+	/*
+	 *	사용하는 폰트는 세로가 바이트로 구별 (개별 앨리먼트)되어 있는데 가로는 비트단위로
+	 *	제작되어 있다. 문제는 사용하는 OLED 드라이버칩 특성상 가로가 바이트 단위고 세로가
+	 *	비트 단위라 변환해줘야 한다
+	 */
+
+	 // 입력하는 문자를 사용하는 폰트 데이터 index에 맞게 변환
+	int iIndexChar = (cData - 32) * 12;
+	//For문 사용 변수
+	int x, y, z;
+	// 실제 좌표와 드라이버칩의 메모리 위치 환산 위한 변수
+	int iLocationSumY = 0;
+	char buf = 0b00000001;
+	char nbuf = 0b00000001;
+
+	//특이하게 byte by byte로 픽셀이 매칭이 아닌 행은 Bit로, 열은 Byte로 구분 되어 있다.
+	//참고 자료 : http://www.datasheet.kr/ic/1017173/SSD1309-datasheet-pdf.html
+
+	// 폰트 세로크기
+	for (y = 0; y < 12; y++)
+	{
+		// 폰트 가로크기
+		for (x = 0; x < 1; x++)
+		{
+			//폰트 가로는 비트로 구성
+			for (z = 7; z >= 0; z--)
+			{
+				//폰트 가로축을 1비트씩 읽어서 On해야 되는 픽셀이 있다면
+				if (((Font12_Table[iIndexChar + (y + x)] >> z) & 0x1) == 1)
+				{
+					// 문자의 시작하려는 y좌표와 현재 읽어들인 문자의 y좌표 합 계산
+					//0~31까지의 실제 OLED 좌표와 드라이버칩 메모리 위치 환산 하기 위해 계산해야 한다
+					iLocationSumY = y + iLocationY;
+
+					//즉 iLocationSumY가 0~7,8~15,16~23,24~31 각각 메모리상으로는 1개의 char 형태로
+					//묶여있는 형태다
+					if (iLocationSumY < 8)
+					{
+						//각 영역 내부에 표시하기 위한 shift
+						buf = 0b00000001 << iLocationSumY;
+						//버퍼 메모리에 해당 위치 변환된 부분에 1을 기록
+						displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] = displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] | buf;
+					}
+					else if ((iLocationSumY >= 8) && (iLocationSumY < 16))
+					{
+						iLocationSumY = iLocationSumY - 8;
+						buf = 0b00000001 << iLocationSumY;
+						displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] | buf;
+					}
+					else if ((iLocationSumY >= 16) && (iLocationSumY < 24))
+					{
+						iLocationSumY = iLocationSumY - 16;
+						buf = 0b00000001 << iLocationSumY;
+						displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] | buf;
+					}
+					else if ((iLocationSumY >= 24) && (iLocationSumY < 32))
+					{
+						iLocationSumY = iLocationSumY - 24;
+						buf = 0b00000001 << iLocationSumY;
+						displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] = displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] | buf;
+					}
+				}
+				// 0으로 처리되는 픽셀이면
+				else if (((Font12_Table[iIndexChar + (y + x)] >> z) & 0x1) == 0)
+				{
+					iLocationSumY = y + iLocationY;
+					if (iLocationSumY < 8)
+					{
+						buf = 0b00000001 << iLocationSumY;
+						// 해당 부분 픽셀은 Off이므로 Not연산으로 비트 반전
+						nbuf = ~buf;
+						//And연산으로 꺼버린다
+						displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] = (displaybuffer[(iLocationY * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
+					}
+					else if ((iLocationSumY >= 8) && (iLocationSumY < 16))
+					{
+						iLocationSumY = iLocationSumY - 8;
+						buf = 0b00000001 << iLocationSumY;
+						nbuf = ~buf;
+						displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 1) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
+					}
+					else if ((iLocationSumY >= 16) && (iLocationSumY < 24))
+					{
+						iLocationSumY = iLocationSumY - 16;
+						buf = 0b00000001 << iLocationSumY;
+						nbuf = ~buf;
+						displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 2) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
+					}
+					else if ((iLocationSumY >= 24) && (iLocationSumY < 32))
+					{
+						iLocationSumY = iLocationSumY - 24;
+						buf = 0b00000001 << iLocationSumY;
+						nbuf = ~buf;
+						displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] = (displaybuffer[((iLocationY + 3) * 128) + (iLocationX + (7 - z))] | buf) & nbuf;
+					}
+				}
+			}
+		}
+	}
+}
+
+static void fDisplayStringBitwise(int iLocationX, int iLocationY, char *displaybuffer, const char *p)
+{
+	for (int x = 0; *p != '\0'; p++, x += 8)
+	{
+		fDisplayCharBitwise(iLocationX + x, iLocationY, *p, displaybuffer);
+	}
+}
+
+static double fNow(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+int main(void)
+{
+	static char sOld[DISPLAY_BUFFER_SIZE];
+	static uint8_t sNew[DISPLAY_BUFFER_SIZE];
+	const char *sText = "Boot Loader";
+	double fStart;
+	double fOldNs;
+	double fNewNs;
+	int iFail = 0;
+
+	// 전체 글자, 배경이 0과 0xFF 일 때 모두 같은 결과인지 확인
+	for (int iFill = 0; iFill <= 0xFF; iFill += 0xFF)
+	{
+		for (int c = 32; c < 127; c++)
+		{
+			memset(sOld, iFill, sizeof(sOld));
+			memset(sNew, iFill, sizeof(sNew));
+			fDisplayCharBitwise(16, 0, (char)c, sOld);
+			fDisplayChar(16, 0, (char)c, sNew);
+			if (memcmp(sOld, sNew, sizeof(sOld)) != 0)
+			{
+				printf("MISMATCH '%c' fill %02X\n", c, iFill);
+				iFail = 1;
+			}
+		}
+	}
+
+	fStart = fNow();
+	for (int i = 0; i < BENCH_ITERATIONS; i++)
+	{
+		fDisplayStringBitwise(0, 0, sOld, sText);
+		__asm__ volatile("" : : "r"(sOld) : "memory");
+	}
+	fOldNs = (fNow() - fStart) / BENCH_ITERATIONS;
+
+	fStart = fNow();
+	for (int i = 0; i < BENCH_ITERATIONS; i++)
+	{
+		fDisplayString(0, 0, sNew, sText);
+		__asm__ volatile("" : : "r"(sNew) : "memory");
+	}
+	fNewNs = (fNow() - fStart) / BENCH_ITERATIONS;
+
+	printf("\"%s\": bitwise %.1f ns, glyph table %.1f ns (%.1fx)\n", sText, fOldNs, fNewNs, fOldNs / fNewNs);
+	return iFail;
+}
@@ -0,0 +1,63 @@
+/*
+ * p256_test.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	fP256Verify()를 p256_vectors.h의 test vector로 확인한다.
+ *
+ *	- NIST CAVP SigVer.rsp의 P-256 vector 전부 (SHA-1 ~ SHA-512, digest는 앞 256 bit)
+ *	- Wycheproof ecdsa_secp256r1_sha256 (gen_p256_vectors.py에 --wycheproof로 줬을 때)
+ *	- edge case: r, s = 0 또는 >= n (작은 s의 s + n 포함), high s, 곡선 밖이거나 좌표에 p를 더한 공개키, digest >= n,
+ *	  u1*G + u2*Q = 무한원점, u1*G == u2*Q, Q = G / -G, x(R) >= n
+ *	valid vector는 digest 1 bit를 바꿔서 실패하는지도 본다.
+ *	하나라도 기대값과 다르면 이름을 출력하고 1을 돌려준다.
+ *
+ *	python3 Tools/gen_p256_vectors.py --sigver SigVer.rsp   (vector를 바꿀 때만)
+ *	gcc -O2 -Wall -I Core/Inc Tools/bench/p256_test.c Core/Src/p256.c -o p256_test && ./p256_test
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "p256.h"
+#include "p256_vectors.h"
+
+int main(void)
+{
+	uint32_t iCount = sizeof(sP256Vectors) / sizeof(sP256Vectors[0]);
+	uint32_t iFailed = 0;
+	uint32_t iFlipped = 0;
+	uint8_t sDigest[32];
+
+	for (uint32_t i = 0; i < iCount; i++)
+	{
+		const P256VectorTypeDef *pVector = &sP256Vectors[i];
+		int iResult = fP256Verify(pVector->sPublicKey, pVector->sDigest, pVector->sSignature);
+
+		if (iResult != pVector->iExpected)
+		{
+			printf("FAIL %s: got %d, expected %d\n", pVector->pName, iResult, pVector->iExpected);
+			iFailed++;
+			continue;
+		}
+		if (pVector->iExpected != 0)
+		{
+			continue;
+		}
+
+		memcpy(sDigest, pVector->sDigest, sizeof(sDigest));
+		sDigest[i % sizeof(sDigest)] ^= (uint8_t)(1U << (i % 8));
+		if (fP256Verify(pVector->sPublicKey, sDigest, pVector->sSignature) != -1)
+		{
+			printf("FAIL %s: accepted with a flipped digest bit\n", pVector->pName);
+			iFailed++;
+		}
+		iFlipped++;
+	}
+
+	printf("P-256 vectors: %u checked, %u bit-flip checks, %u failed\n", (unsigned)iCount, (unsigned)iFlipped, (unsigned)iFailed);
+	return (iFailed == 0) ? 0 : 1;
+}
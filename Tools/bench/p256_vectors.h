@@ -0,0 +1,567 @@
+/*
+ * p256_vectors.h
+ *
+ *  Generated by Tools/gen_p256_vectors.py, do not edit.
+ *  Sources: NIST CAVP SigVer.rsp (75), edge cases (33)
+ */
+
+#ifndef P256_VECTORS_H_
+#define P256_VECTORS_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	const char *pName;
+	uint8_t sPublicKey[64];
+	uint8_t sDigest[32];
+	uint8_t sSignature[64];
+	// fP256Verify() 기대값, 0 = valid, -1 = invalid
+	int iExpected;
+} P256VectorTypeDef;
+
+static const P256VectorTypeDef sP256Vectors[] =
+{
+	{"CAVP SHA-1 #0",
+		{0x11, 0x98, 0xB3, 0xC4, 0x09, 0xA8, 0xB4, 0x7E, 0xDB, 0x13, 0x47, 0xE0, 0x98, 0x2D, 0x53, 0x3C, 0xB1, 0x81, 0x3E, 0x5C, 0xB2, 0xA9, 0x2C, 0x82, 0x4B, 0x28, 0x81, 0xB3, 0xCD, 0x2F, 0x3F, 0x4A, 0x0B, 0xDB, 0xAC, 0x5F, 0xA0, 0x2E, 0x41, 0xE7, 0x75, 0xF8, 0xD6, 0x02, 0x44, 0x6D, 0x58, 0xEC, 0xB2, 0x20, 0x9B, 0x5A, 0x3D, 0x79, 0xAE, 0x69, 0xEE, 0xF3, 0x99, 0x01, 0x6E, 0x99, 0x2E, 0x87},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xED, 0x0C, 0x41, 0xD6, 0x50, 0x47, 0x9C, 0x47, 0x05, 0x7F, 0x61, 0x43, 0x3D, 0x7E, 0x8B, 0x24, 0x49, 0x26, 0x49},
+		{0x92, 0x06, 0xD4, 0x35, 0xF1, 0x48, 0xF8, 0x8C, 0x15, 0xB2, 0xEF, 0xFB, 0xF3, 0xC5, 0x06, 0xE4, 0x1B, 0x2C, 0x62, 0x01, 0x02, 0x02, 0x2B, 0x80, 0x1E, 0x37, 0x1D, 0x07, 0x67, 0xB5, 0x4B, 0xEA, 0xCB, 0xC4, 0xE1, 0x67, 0x4A, 0xE1, 0xAF, 0x69, 0x87, 0x39, 0x46, 0xCC, 0xF6, 0x27, 0x59, 0x46, 0xE5, 0x9E, 0x01, 0x07, 0x27, 0x87, 0x49, 0xB2, 0xD0, 0x01, 0x07, 0x95, 0x83, 0x3D, 0x80, 0xFA},
+		-1},
+	{"CAVP SHA-1 #1",
+		{0xF7, 0xC6, 0x28, 0x0A, 0xEC, 0xD6, 0xB9, 0x36, 0x51, 0x3B, 0x0C, 0xA8, 0x4E, 0x63, 0x34, 0x63, 0x33, 0xDC, 0x41, 0x43, 0x7A, 0x15, 0x44, 0x2E, 0x60, 0x5D, 0x46, 0xBB, 0xA9, 0x3A, 0xE1, 0x01, 0x3C, 0x83, 0x4C, 0xEC, 0xC1, 0x61, 0x67, 0xB0, 0x78, 0x66, 0xA9, 0x47, 0x8F, 0x9F, 0x2D, 0x88, 0x2D, 0xE7, 0xEF, 0x93, 0x7D, 0xA4, 0x47, 0xCD, 0x83, 0x7E, 0x60, 0xCB, 0x5E, 0xD6, 0x5D, 0x81},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x1B, 0x4D, 0xFD, 0xDD, 0x5E, 0xB3, 0x3A, 0x87, 0x5D, 0x2E, 0x50, 0xD1, 0xE9, 0x49, 0x21, 0x1A, 0xC8, 0x19, 0xDA},
+		{0xF6, 0x15, 0xAF, 0x21, 0x2A, 0xB0, 0x30, 0xC4, 0xBB, 0xF9, 0x36, 0x2D, 0x98, 0x15, 0xA1, 0x46, 0x23, 0x12, 0xDF, 0x4B, 0xEB, 0x43, 0x58, 0xA7, 0xCE, 0x80, 0xD8, 0x20, 0x35, 0x54, 0x20, 0xBF, 0xD1, 0x2E, 0xD7, 0x15, 0xEF, 0x65, 0xCF, 0xE6, 0xFE, 0x6B, 0xF3, 0x48, 0x36, 0x40, 0x88, 0xA0, 0xE7, 0xF7, 0x09, 0x27, 0xBB, 0xAF, 0xE4, 0xC1, 0x2F, 0xC4, 0xCB, 0x65, 0xC0, 0xCC, 0x51, 0xBC},
+		-1},
+	{"CAVP SHA-1 #2",
+		{0x0E, 0x76, 0x32, 0xDB, 0xC4, 0xDB, 0x87, 0x9E, 0x10, 0xD1, 0xD8, 0x0F, 0x27, 0x89, 0xD9, 0xFA, 0x41, 0x4C, 0x1F, 0xE7, 0x7A, 0x6C, 0x1E, 0x56, 0xD6, 0x66, 0x7A, 0xF4, 0x3E, 0x36, 0xE6, 0x10, 0x6F, 0x0D, 0xD2, 0xA5, 0x84, 0x0E, 0x5A, 0x6F, 0x6F, 0xF7, 0xE2, 0x3F, 0x65, 0x6F, 0x5C, 0x94, 0x5B, 0x7A, 0x49, 0x3F, 0xBB, 0x0C, 0xFD, 0x5B, 0x9B, 0x53, 0x1B, 0xF0, 0x44, 0x35, 0xB1, 0xEF},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x05, 0x69, 0x6F, 0x8B, 0xAD, 0x82, 0x05, 0xFA, 0x14, 0x45, 0xDF, 0x0E, 0x91, 0xAD, 0xE3, 0xDB, 0xC4, 0x13, 0xE6},
+		{0x2B, 0x0B, 0x9A, 0xB4, 0xA5, 0x75, 0x73, 0x2A, 0x16, 0x8F, 0x28, 0x49, 0x4B, 0x66, 0xA8, 0x55, 0xFC, 0x1A, 0x75, 0x7F, 0xB1, 0x17, 0x78, 0x64, 0xBF, 0x3E, 0x4F, 0x0A, 0x00, 0x0C, 0x4A, 0x86, 0x54, 0x90, 0x1C, 0xE2, 0xF9, 0x2F, 0x55, 0xAC, 0x11, 0x2A, 0xFA, 0x0F, 0x8B, 0x62, 0xBC, 0x00, 0xB4, 0x4C, 0x8C, 0x10, 0xFE, 0x0C, 0x86, 0x36, 0x75, 0xBF, 0xD3, 0x05, 0xD6, 0xDC, 0x0C, 0xD8},
+		-1},
+	{"CAVP SHA-1 #3",
+		{0x16, 0x13, 0xF1, 0x2B, 0xAE, 0x8E, 0x98, 0xD0, 0x9B, 0x4B, 0xBA, 0x53, 0xF5, 0x22, 0x95, 0x96, 0xA0, 0xD4, 0x17, 0xD2, 0xC6, 0x25, 0xF4, 0x1B, 0xB1, 0x5F, 0x92, 0x3B, 0x3C, 0x1E, 0x4B, 0x57, 0x41, 0x13, 0x19, 0xFA, 0x85, 0x22, 0x79, 0x97, 0xA4, 0xCF, 0x3B, 0x17, 0x56, 0x16, 0x14, 0x85, 0x12, 0x4D, 0x2C, 0xED, 0xC3, 0x8C, 0x9C, 0x30, 0xD8, 0x2F, 0x42, 0xDC, 0x26, 0x47, 0xD5, 0x45},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x0D, 0x31, 0xCE, 0x22, 0x70, 0x0A, 0x20, 0xC2, 0xDB, 0x81, 0xBC, 0xDA, 0xC3, 0x73, 0x30, 0xB4, 0x91, 0xC8, 0x6F},
+		{0xED, 0x05, 0x8D, 0x47, 0x6A, 0x77, 0xBE, 0x99, 0xC1, 0xB0, 0xFC, 0x85, 0x02, 0xAB, 0xE5, 0x45, 0x54, 0x1B, 0x4C, 0x0F, 0xF3, 0xEE, 0xD3, 0xF5, 0x58, 0x13, 0x3A, 0xE2, 0xF0, 0x20, 0x42, 0xB0, 0xC5, 0x71, 0xB4, 0x89, 0x57, 0x12, 0xA4, 0xF6, 0x4F, 0x72, 0x20, 0xB0, 0x69, 0x4C, 0xAB, 0x76, 0x73, 0x79, 0xB0, 0x9F, 0x18, 0x24, 0xFE, 0x78, 0x74, 0xAC, 0xD1, 0x27, 0xDE, 0xB2, 0x37, 0x1E},
+		-1},
+	{"CAVP SHA-1 #4",
+		{0x88, 0xBB, 0x04, 0x1D, 0xCB, 0x17, 0x33, 0xA6, 0x76, 0xA7, 0xF4, 0xAE, 0x8D, 0x3E, 0x40, 0x7D, 0x72, 0xD5, 0x39, 0x65, 0x47, 0xF0, 0x7D, 0xB7, 0x70, 0x78, 0x48, 0x5C, 0x1D, 0x5D, 0xB0, 0x77, 0x72, 0xCF, 0x2B, 0x55, 0xE5, 0x96, 0xCD, 0x14, 0x0C, 0x58, 0x22, 0x8F, 0x1B, 0x0A, 0x19, 0xC3, 0x4F, 0xCA, 0x26, 0xFF, 0xAC, 0x04, 0x35, 0x28, 0xA4, 0x17, 0xC5, 0xAB, 0xB6, 0xFC, 0xA9, 0xC9},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0xA0, 0x2F, 0x76, 0x8B, 0x07, 0x18, 0xA1, 0x35, 0x25, 0xC3, 0x3A, 0xDA, 0xCE, 0x58, 0x3D, 0xE1, 0x5C, 0x50},
+		{0x87, 0x20, 0x87, 0x34, 0xDE, 0xB1, 0x25, 0xDC, 0xA6, 0x8F, 0x0D, 0x33, 0xF9, 0xD3, 0x69, 0xCF, 0x1B, 0x79, 0xCF, 0x5A, 0x02, 0x13, 0x91, 0xB9, 0xC6, 0xC1, 0x72, 0x7D, 0x2E, 0xFE, 0x66, 0x3A, 0xB9, 0x84, 0xF7, 0x22, 0xDE, 0x18, 0xF1, 0xCE, 0x40, 0x71, 0x04, 0x34, 0x29, 0x48, 0xF0, 0x3F, 0x2B, 0x55, 0x41, 0x3A, 0x09, 0x6C, 0x4B, 0x5F, 0xCA, 0x1E, 0x03, 0x2A, 0x2C, 0x81, 0x4A, 0x4A},
+		-1},
+	{"CAVP SHA-1 #5",
+		{0x81, 0x1E, 0xB5, 0x18, 0x0D, 0xEF, 0x7F, 0xB6, 0x0D, 0x63, 0x2F, 0x8C, 0xB2, 0xCB, 0xA8, 0x31, 0xB8, 0x8C, 0xEE, 0x77, 0x8A, 0xA2, 0xA8, 0x2E, 0xC3, 0xA5, 0xFC, 0x3D, 0x80, 0xFF, 0x7F, 0xB6, 0xDB, 0x88, 0xD6, 0x5B, 0x0F, 0xC3, 0x5D, 0x9B, 0xA1, 0xF1, 0xCE, 0xD0, 0x40, 0x04, 0x34, 0x97, 0x9A, 0xE8, 0x95, 0xD3, 0x71, 0xD1, 0x44, 0x1D, 0x7C, 0x7A, 0x44, 0x1A, 0x9F, 0xB1, 0x70, 0x9B},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xB7, 0x45, 0x1E, 0xA9, 0x03, 0x12, 0x5C, 0xCB, 0x29, 0x3F, 0xFA, 0xA9, 0xD1, 0xA4, 0xCA, 0x11, 0x41, 0xA2, 0xC5},
+		{0xC3, 0x29, 0xFA, 0x28, 0xDA, 0xC0, 0x01, 0x82, 0x76, 0xC5, 0xAF, 0x0C, 0xD7, 0x70, 0xE6, 0x0B, 0xE5, 0x0B, 0xC1, 0x4E, 0x25, 0x62, 0xD5, 0x55, 0x69, 0x91, 0x97, 0x1E, 0xDC, 0x7D, 0x49, 0x16, 0x2D, 0x11, 0x1D, 0x13, 0x83, 0x7A, 0x02, 0xFA, 0x27, 0x9F, 0xE8, 0x35, 0xA7, 0xDC, 0x59, 0xA5, 0x21, 0x86, 0x4D, 0x92, 0xB2, 0x66, 0x49, 0xCA, 0x4E, 0x24, 0xB3, 0x6A, 0xE9, 0x38, 0x78, 0xE8},
+		-1},
+	{"CAVP SHA-1 #6",
+		{0x4A, 0x6F, 0x1E, 0x7F, 0x72, 0x68, 0x17, 0x4D, 0x23, 0x99, 0x3B, 0x8B, 0x58, 0xAA, 0x60, 0xC2, 0xA8, 0x7B, 0x18, 0xDE, 0x79, 0xB3, 0x6A, 0x75, 0x0E, 0xC8, 0x6D, 0xD6, 0xF9, 0xE1, 0x22, 0x27, 0x57, 0x2D, 0xF2, 0x2B, 0xD6, 0x48, 0x7A, 0x86, 0x3A, 0x51, 0xCA, 0x54, 0x4B, 0x8C, 0x5D, 0xE2, 0xB4, 0x7F, 0x80, 0x13, 0x72, 0xA8, 0x81, 0xCB, 0x99, 0x6A, 0x97, 0xD9, 0xA9, 0x8A, 0xA8, 0x25},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xE9, 0xA0, 0x48, 0x55, 0x9F, 0x37, 0x04, 0x25, 0xE9, 0xC8, 0xE5, 0x4A, 0x46, 0x0E, 0xC9, 0x1B, 0xCC, 0x93, 0x0A},
+		{0x4A, 0x80, 0x0E, 0x24, 0xDE, 0x65, 0xE5, 0xC5, 0x7D, 0x4C, 0xAB, 0x4D, 0xD1, 0xEF, 0x7B, 0x6C, 0x38, 0xA2, 0xF0, 0xAA, 0x5C, 0xFD, 0x3A, 0x57, 0x1A, 0x4B, 0x55, 0x2F, 0xB1, 0x99, 0x3E, 0x69, 0xD9, 0xC8, 0x9F, 0xB9, 0x83, 0x64, 0x0A, 0x7E, 0x65, 0xED, 0xF6, 0x32, 0xCA, 0xCD, 0x1D, 0xE0, 0x82, 0x3B, 0x7E, 0xFB, 0xC7, 0x98, 0xFC, 0x1F, 0x7B, 0xBF, 0xAC, 0xDD, 0xA7, 0x39, 0x89, 0x55},
+		-1},
+	{"CAVP SHA-1 #7",
+		{0xF3, 0x03, 0x3D, 0x1E, 0x54, 0x8D, 0x24, 0x5B, 0x5E, 0x45, 0xFF, 0x11, 0x47, 0xDB, 0x8C, 0xD4, 0x4D, 0xB8, 0xA1, 0xF2, 0x82, 0x3C, 0x3C, 0x16, 0x41, 0x25, 0xBE, 0x88, 0xF9, 0xA9, 0x82, 0xC2, 0x3C, 0x07, 0x8F, 0x6C, 0xEE, 0x2F, 0x50, 0xE9, 0x5E, 0x89, 0x16, 0xAA, 0x9C, 0x4E, 0x93, 0xDE, 0x3F, 0xDF, 0x9B, 0x04, 0x5A, 0xBA, 0xC6, 0xF7, 0x07, 0xCF, 0xCB, 0x22, 0xD0, 0x65, 0x63, 0x8E},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xD3, 0x8E, 0x4C, 0x6A, 0x90, 0x5A, 0x81, 0x4B, 0x04, 0xC2, 0x84, 0x1D, 0x89, 0x8E, 0xD6, 0xDA, 0x02, 0x3C, 0x34},
+		{0xD4, 0x25, 0x5D, 0xB8, 0x6A, 0x41, 0x6A, 0x5A, 0x68, 0x8D, 0xE4, 0xE2, 0x38, 0x07, 0x1E, 0xF1, 0x6E, 0x5F, 0x2A, 0x20, 0xE3, 0x1B, 0x94, 0x90, 0xC0, 0x3D, 0xEE, 0x9A, 0xE6, 0x16, 0x4C, 0x34, 0x4E, 0x0A, 0xC1, 0xE1, 0xA6, 0x72, 0x5B, 0xF7, 0xC6, 0xBD, 0x20, 0x74, 0x39, 0xB2, 0xD3, 0x70, 0xC5, 0xF2, 0xDE, 0xA1, 0xFF, 0x4D, 0xEC, 0xF1, 0x65, 0x0A, 0xB8, 0x4C, 0x77, 0x69, 0xEF, 0xC0},
+		0},
+	{"CAVP SHA-1 #8",
+		{0x0E, 0xA0, 0xA6, 0xBB, 0x6C, 0x70, 0x96, 0x6F, 0xAD, 0x1A, 0x23, 0x07, 0x47, 0x9C, 0x12, 0xDE, 0x23, 0x22, 0x79, 0x5B, 0xDE, 0xCB, 0x70, 0xE4, 0xB2, 0x86, 0xBD, 0x62, 0x00, 0xBA, 0x9C, 0x1A, 0xC4, 0x0E, 0xDA, 0x39, 0x47, 0x02, 0x13, 0x48, 0xDB, 0x69, 0x1A, 0xC4, 0x08, 0x6F, 0xB6, 0xC0, 0x6B, 0x58, 0x7C, 0xE3, 0x7C, 0x15, 0x5B, 0xB0, 0xA7, 0xD9, 0x12, 0xB9, 0x32, 0x26, 0xDE, 0x81},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0xBF, 0x1B, 0x67, 0xAB, 0xC0, 0x3C, 0x1C, 0xD6, 0x9B, 0x0E, 0x24, 0x74, 0x3B, 0x5C, 0x2D, 0x49, 0xE5, 0x06},
+		{0xF5, 0x50, 0x9D, 0xEF, 0xF7, 0xBF, 0xDA, 0x3F, 0x37, 0x59, 0x80, 0x0F, 0xA4, 0x03, 0x3A, 0xF6, 0xA8, 0x44, 0x66, 0xB1, 0x14, 0xEC, 0xB4, 0x8E, 0xAC, 0x37, 0xEF, 0xF4, 0x8D, 0x2A, 0xE1, 0xB3, 0x8C, 0x4B, 0x62, 0xDC, 0xE2, 0x08, 0x2F, 0x80, 0xCA, 0xF2, 0x20, 0xCD, 0xBB, 0x1D, 0x02, 0x56, 0x7B, 0xBD, 0xFA, 0xB4, 0x05, 0x64, 0xB9, 0x0E, 0xF3, 0x1D, 0x86, 0xE3, 0xE1, 0x0C, 0xE8, 0x0A},
+		-1},
+	{"CAVP SHA-1 #9",
+		{0xE7, 0xA5, 0x7E, 0x0F, 0x6E, 0xC0, 0xFA, 0x9C, 0x7C, 0x34, 0x97, 0x80, 0x34, 0xCF, 0x82, 0xF0, 0x39, 0xF8, 0xFD, 0x62, 0x80, 0x40, 0x70, 0xAD, 0x94, 0x35, 0x73, 0xFC, 0x8E, 0xFA, 0x57, 0x75, 0x87, 0xB2, 0xCC, 0x85, 0xDF, 0xFF, 0x2D, 0xAE, 0x56, 0x20, 0xFB, 0xE3, 0xE6, 0x25, 0x6B, 0xD7, 0x28, 0xDE, 0x28, 0xFC, 0x9D, 0xC1, 0xB5, 0xEB, 0x6B, 0x5D, 0x7B, 0xD5, 0xD2, 0x91, 0x86, 0xAD},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xC5, 0xDC, 0x03, 0x44, 0xB1, 0x44, 0x2D, 0xFD, 0xB5, 0xF8, 0x83, 0x62, 0x51, 0x89, 0x3D, 0x6C, 0x4E, 0xCB, 0xE9},
+		{0x97, 0x64, 0x20, 0x38, 0x93, 0x2F, 0xDD, 0xDB, 0xE2, 0x02, 0x1E, 0xC1, 0xAF, 0x53, 0xAE, 0x6B, 0x9A, 0xF0, 0x0E, 0xF9, 0xC8, 0xB9, 0xF2, 0x6A, 0xEA, 0x58, 0x28, 0x92, 0xE8, 0x0E, 0x62, 0x85, 0x9C, 0xB1, 0x49, 0x18, 0x35, 0x93, 0x38, 0x04, 0x1C, 0xF7, 0x95, 0xCF, 0x67, 0x81, 0xE4, 0x90, 0x58, 0x37, 0xFA, 0x5C, 0xE3, 0xB3, 0xE5, 0x0F, 0xFA, 0xFB, 0x5F, 0x13, 0xC7, 0x3B, 0x5B, 0xC8},
+		-1},
+	{"CAVP SHA-1 #10",
+		{0xBE, 0x7A, 0x65, 0x1B, 0xE0, 0xC8, 0x72, 0x78, 0x56, 0x99, 0x87, 0xCF, 0x62, 0xD7, 0xFA, 0x1D, 0xD1, 0xB3, 0xD6, 0xE1, 0xB8, 0x68, 0xD8, 0xF4, 0xDF, 0xB5, 0x61, 0x35, 0xA9, 0x96, 0x0E, 0xEC, 0xB7, 0xA6, 0x2C, 0x58, 0x8A, 0x98, 0x77, 0x60, 0xB9, 0x15, 0xED, 0xBD, 0x7F, 0x95, 0x50, 0x68, 0x70, 0xC6, 0x0F, 0x04, 0x24, 0x71, 0xDE, 0x1D, 0x8B, 0x2D, 0x4C, 0xD9, 0xD6, 0x56, 0x33, 0x91},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x93, 0xEE, 0x45, 0xDB, 0x13, 0x3A, 0x14, 0xC2, 0x6D, 0x41, 0x8C, 0x2F, 0xFD, 0x34, 0x70, 0xAE, 0x63, 0xBF, 0x50},
+		{0xAA, 0x88, 0x9F, 0xB6, 0x08, 0xB6, 0x93, 0x9F, 0x6E, 0xEA, 0xCF, 0x2F, 0x64, 0xC3, 0xB2, 0xE3, 0xA6, 0x06, 0x1F, 0x28, 0x34, 0x05, 0x8C, 0x7E, 0x72, 0x43, 0x21, 0x72, 0x0B, 0x73, 0x7A, 0x63, 0x6C, 0xD6, 0xD0, 0xEF, 0x2B, 0x93, 0xA7, 0x60, 0xDA, 0xA9, 0x14, 0xE1, 0x1B, 0x9B, 0x41, 0x4B, 0xD4, 0xD7, 0x24, 0x57, 0x40, 0x5F, 0x00, 0xA6, 0x2A, 0xB6, 0x3F, 0x36, 0xD7, 0x6E, 0xFB, 0x73},
+		-1},
+	{"CAVP SHA-1 #11",
+		{0x76, 0xDD, 0xC4, 0x6D, 0x8D, 0xB8, 0xD7, 0xCE, 0x2C, 0xE8, 0x37, 0xF6, 0x0C, 0xDA, 0xBC, 0xEE, 0x92, 0xB7, 0xC7, 0x81, 0x7E, 0xE4, 0x1C, 0x8F, 0x06, 0x6F, 0x1A, 0xE6, 0x5F, 0x85, 0xC3, 0x18, 0xBE, 0xA4, 0x71, 0x91, 0xF1, 0xC5, 0x84, 0xC8, 0x72, 0x50, 0x37, 0x0C, 0xE3, 0x37, 0xA1, 0xDE, 0x15, 0x83, 0xBC, 0xFC, 0x20, 0xCC, 0xC2, 0x3B, 0x7A, 0x82, 0xE8, 0x3F, 0x19, 0xAD, 0xAA, 0x88},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x36, 0xA5, 0x47, 0x0F, 0xF9, 0xD4, 0x52, 0x14, 0xA0, 0xB2, 0xC3, 0x00, 0x04, 0x2E, 0xFE, 0xA8, 0xFF, 0x72, 0x66},
+		{0x84, 0xA4, 0x2E, 0xFB, 0xF7, 0xEC, 0x04, 0x16, 0x6A, 0xD1, 0x44, 0xD1, 0x9C, 0xD9, 0x8C, 0x12, 0x0A, 0xA2, 0xE7, 0x9D, 0x48, 0x3B, 0x5E, 0xEA, 0x6F, 0xBD, 0xFA, 0x7F, 0x12, 0x22, 0xE0, 0x7B, 0xE4, 0x15, 0x31, 0x20, 0x5E, 0x69, 0x1E, 0x65, 0x66, 0x8F, 0x69, 0xF5, 0x18, 0xAB, 0xC7, 0xB6, 0x0F, 0x32, 0xC3, 0x73, 0x43, 0x48, 0x72, 0xA0, 0x43, 0xB7, 0x35, 0x84, 0x62, 0xBA, 0xBF, 0x83},
+		-1},
+	{"CAVP SHA-1 #12",
+		{0x2F, 0x71, 0xB9, 0x32, 0xF7, 0x70, 0xBA, 0x9D, 0xAF, 0x7C, 0x1D, 0xD4, 0x74, 0x44, 0xAB, 0x6C, 0xB8, 0x88, 0x1F, 0x71, 0xA1, 0xC5, 0x97, 0xE7, 0x19, 0x84, 0x5B, 0x15, 0xCB, 0x84, 0xCA, 0x35, 0xAB, 0x92, 0x86, 0x25, 0xB4, 0x0E, 0xC0, 0x73, 0x8D, 0x0F, 0xC8, 0xDB, 0xC4, 0xDF, 0x4A, 0x1F, 0x65, 0xD2, 0x0B, 0xC0, 0x44, 0x7B, 0x69, 0xCF, 0xA1, 0x3B, 0xB2, 0x0B, 0x95, 0xBB, 0x41, 0xD4},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x60, 0x93, 0xBB, 0x37, 0xC1, 0x26, 0x4C, 0xA3, 0xEA, 0xD4, 0x39, 0xE4, 0xF6, 0x78, 0x72, 0x19, 0x12, 0xC8, 0xC4},
+		{0x63, 0xFC, 0xA1, 0x72, 0xBB, 0xCA, 0x61, 0x97, 0xCD, 0x28, 0x02, 0xA9, 0xCB, 0x61, 0xD7, 0x4C, 0x2B, 0x47, 0xCF, 0x35, 0xF6, 0xD3, 0x52, 0x03, 0xE6, 0x7F, 0xFB, 0xAA, 0x83, 0x8B, 0xE7, 0x75, 0xE7, 0x0E, 0xC2, 0x83, 0xCD, 0x21, 0x2D, 0xF6, 0xBA, 0x37, 0x23, 0xE2, 0x6B, 0x69, 0x75, 0x01, 0xF1, 0x12, 0xD7, 0xCF, 0x64, 0xE4, 0xF4, 0x51, 0x85, 0xDA, 0xE7, 0x60, 0x55, 0xE0, 0x9F, 0x1E},
+		0},
+	{"CAVP SHA-1 #13",
+		{0xCE, 0x77, 0x56, 0x48, 0xB9, 0x28, 0xDB, 0x82, 0xAC, 0x5E, 0xDB, 0x3B, 0x00, 0x9D, 0x32, 0x95, 0x9A, 0x73, 0xB8, 0x6C, 0x45, 0xE9, 0x6D, 0x4B, 0x8D, 0x5B, 0x6E, 0x64, 0x0B, 0x7C, 0x27, 0x90, 0x52, 0x45, 0x5C, 0xAF, 0x08, 0xEE, 0x94, 0xD8, 0x6F, 0x09, 0x84, 0xE9, 0xEC, 0x92, 0x68, 0xD7, 0x48, 0x23, 0xF2, 0x10, 0x2D, 0xD9, 0x7F, 0xCE, 0xD5, 0x96, 0x38, 0x05, 0x5F, 0x6A, 0xF1, 0x8E},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x48, 0x07, 0xAC, 0xB2, 0x9E, 0x30, 0x91, 0xA0, 0x23, 0xC4, 0x2B, 0x98, 0x85, 0xC4, 0x94, 0x52, 0x49, 0xE1},
+		{0x2A, 0x64, 0xB2, 0x91, 0x46, 0x58, 0x8F, 0x31, 0x53, 0xFE, 0xE1, 0x02, 0x9A, 0x01, 0x31, 0xAC, 0x0A, 0x8A, 0x25, 0xBA, 0x2E, 0xCC, 0x49, 0x4F, 0x69, 0x7C, 0x16, 0x6C, 0x7C, 0x91, 0xFC, 0x08, 0x7B, 0x42, 0x9B, 0xC1, 0x2A, 0x72, 0xCA, 0x3D, 0x76, 0xC1, 0x19, 0xEE, 0xA9, 0xF4, 0x09, 0x86, 0x33, 0xCC, 0x31, 0xC8, 0x78, 0x31, 0xE5, 0x4D, 0x5D, 0x93, 0xAF, 0xD6, 0xE8, 0xD2, 0x0F, 0x4F},
+		-1},
+	{"CAVP SHA-1 #14",
+		{0xCD, 0x2F, 0x29, 0xA5, 0x3F, 0x0C, 0xE5, 0x7E, 0x0E, 0x4A, 0x54, 0x2C, 0x32, 0x56, 0xE6, 0x5E, 0xBB, 0xDC, 0x30, 0x41, 0x5F, 0x4D, 0xE7, 0x71, 0xD5, 0xD7, 0x06, 0xD3, 0xAE, 0xAC, 0xC8, 0x52, 0xDB, 0xBF, 0x2C, 0x12, 0x9F, 0x30, 0xD1, 0x1F, 0xE7, 0x7D, 0x78, 0x16, 0xA2, 0x41, 0x87, 0x76, 0x4E, 0xAE, 0x3F, 0xB2, 0xFF, 0x70, 0xC1, 0xEC, 0x74, 0x5E, 0x87, 0x6E, 0x26, 0xF5, 0x23, 0x2F},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0xE3, 0x5B, 0x13, 0x49, 0x42, 0x29, 0x5C, 0x16, 0xD0, 0x03, 0x74, 0x2F, 0xD6, 0xBC, 0xE5, 0xBD, 0xAB, 0x45},
+		{0x24, 0x54, 0xC5, 0xEE, 0x84, 0xE4, 0xF7, 0x7B, 0x55, 0x4A, 0xCD, 0x36, 0x8D, 0xD4, 0x12, 0x38, 0x9D, 0xB8, 0xC7, 0x84, 0x29, 0x59, 0x0A, 0x09, 0x2F, 0x24, 0xDB, 0x2D, 0xA4, 0x3C, 0xB7, 0x61, 0x63, 0xE8, 0x70, 0xCE, 0x2F, 0xA4, 0x08, 0x5D, 0x4F, 0xF1, 0xE3, 0x60, 0xF7, 0xA5, 0xC1, 0x01, 0xA1, 0xF8, 0xB2, 0x88, 0xAB, 0xE7, 0x1C, 0xCA, 0x56, 0x88, 0x7E, 0x61, 0x3A, 0xD0, 0x34, 0xB7},
+		0},
+	{"CAVP SHA-224 #0",
+		{0x84, 0x3F, 0x6D, 0x83, 0xD7, 0x77, 0xAA, 0xC7, 0x5B, 0x75, 0x8D, 0x58, 0xC6, 0x70, 0xF4, 0x17, 0xC8, 0xDE, 0xEA, 0x8D, 0x33, 0x9A, 0x44, 0x0B, 0xB6, 0x26, 0x11, 0x43, 0x18, 0xC3, 0x4F, 0x29, 0x83, 0xE0, 0xC7, 0x00, 0x08, 0x52, 0x1C, 0x85, 0x09, 0x04, 0x4B, 0x72, 0x44, 0x20, 0x46, 0x3E, 0x34, 0x78, 0xE3, 0xC9, 0x18, 0x74, 0xD4, 0x24, 0xBE, 0x44, 0x41, 0x3D, 0x1C, 0xE5, 0x55, 0xF3},
+		{0x00, 0x00, 0x00, 0x00, 0xCD, 0xA2, 0xC7, 0xAD, 0x9A, 0xBB, 0x2A, 0x85, 0x8C, 0x49, 0x81, 0x55, 0x0F, 0x78, 0x97, 0x4C, 0x69, 0xE4, 0x1C, 0xC3, 0x1F, 0xA3, 0x35, 0x09, 0xE3, 0xE8, 0x3D, 0xC2},
+		{0xD0, 0x8E, 0x9A, 0x5D, 0xB4, 0x11, 0x01, 0x9D, 0x82, 0x6B, 0x20, 0xAC, 0x88, 0x92, 0x27, 0xED, 0x24, 0x55, 0x03, 0xA6, 0xD8, 0x39, 0x49, 0x4D, 0xB1, 0xE8, 0xD7, 0x99, 0x5A, 0x6B, 0x24, 0x5B, 0x8D, 0x46, 0xA2, 0x04, 0x05, 0x41, 0x25, 0xD0, 0xDC, 0x77, 0x6A, 0xB1, 0x05, 0x53, 0x02, 0xEC, 0x4E, 0xB0, 0xF2, 0x0B, 0x90, 0xBC, 0xA6, 0xD2, 0x05, 0xF2, 0x1D, 0x3C, 0xEF, 0xD2, 0x90, 0x97},
+		0},
+	{"CAVP SHA-224 #1",
+		{0xF0, 0x8B, 0x56, 0xF7, 0x3F, 0x7A, 0x0E, 0x09, 0x84, 0x44, 0xF6, 0xF0, 0xA0, 0x2A, 0xD8, 0x1C, 0xE0, 0xB9, 0x14, 0xA1, 0x1C, 0xAF, 0xA1, 0x58, 0x93, 0xD1, 0xC8, 0x47, 0x04, 0xE1, 0xC5, 0x64, 0xBB, 0xEE, 0x9A, 0xEB, 0x91, 0xCD, 0xC2, 0xD1, 0xD1, 0x43, 0x7B, 0x41, 0x68, 0xDF, 0x73, 0xAC, 0xFD, 0x64, 0xE8, 0xB0, 0x29, 0x62, 0xB1, 0x4C, 0x85, 0xE6, 0x71, 0x87, 0xE1, 0xEF, 0x80, 0xA4},
+		{0x00, 0x00, 0x00, 0x00, 0x54, 0x53, 0xC2, 0x65, 0x65, 0x50, 0xE9, 0xB3, 0xDC, 0x6C, 0x40, 0xA3, 0xF1, 0x36, 0x2A, 0x73, 0x52, 0x23, 0x96, 0xBC, 0x35, 0xD3, 0x83, 0xDD, 0x64, 0x51, 0x12, 0x8F},
+		{0x71, 0xB3, 0xEC, 0x98, 0x27, 0x25, 0xA0, 0x07, 0xAC, 0x18, 0xA5, 0xCF, 0x60, 0x58, 0x7E, 0x1F, 0xD1, 0xBE, 0xB5, 0x76, 0x85, 0xA1, 0xF9, 0xDF, 0x3C, 0xDD, 0xD9, 0xDF, 0x25, 0xDC, 0xBC, 0x18, 0x40, 0x7E, 0x41, 0x21, 0x73, 0x25, 0xF9, 0x2F, 0x8A, 0x03, 0x1C, 0xFC, 0xC4, 0xEB, 0x64, 0xC1, 0xA4, 0xB1, 0x7B, 0x0A, 0x74, 0x59, 0xC2, 0x54, 0xAF, 0x75, 0x4A, 0x7E, 0xA9, 0xEA, 0xC9, 0x97},
+		-1},
+	{"CAVP SHA-224 #2",
+		{0x0B, 0x68, 0x8E, 0x76, 0x1E, 0x1D, 0xDD, 0xA2, 0x30, 0x5E, 0x00, 0x28, 0x09, 0xDA, 0x65, 0xBF, 0x59, 0x16, 0xDF, 0xE1, 0x35, 0x6A, 0x5B, 0x99, 0xB6, 0x1F, 0x55, 0x76, 0xA9, 0xB9, 0x0E, 0xFA, 0x90, 0xEC, 0x95, 0x8E, 0x2E, 0x3A, 0x67, 0x6E, 0x7B, 0xBF, 0x8E, 0x93, 0x94, 0xF7, 0x27, 0x42, 0x87, 0x58, 0x36, 0x12, 0x5A, 0x31, 0x7B, 0x0A, 0xE3, 0x83, 0x74, 0x95, 0x3F, 0x74, 0x6A, 0x91},
+		{0x00, 0x00, 0x00, 0x00, 0x72, 0x89, 0x57, 0x3D, 0x6B, 0xB7, 0x48, 0x6E, 0x42, 0x8E, 0x08, 0x6B, 0xEC, 0x9D, 0xA9, 0xD7, 0xFF, 0x3C, 0x5F, 0x8B, 0xD0, 0xDB, 0x2E, 0xC2, 0x09, 0xFE, 0xD6, 0xAE},
+		{0xEF, 0x89, 0xDF, 0x3B, 0xBF, 0x07, 0x9F, 0xB2, 0x50, 0xF7, 0xE8, 0x82, 0xC4, 0xF8, 0x5C, 0x00, 0x23, 0xFC, 0x38, 0x04, 0xE8, 0x62, 0xD9, 0xEF, 0x4D, 0x95, 0x30, 0xA1, 0x5F, 0x10, 0x13, 0xF0, 0x4B, 0xA9, 0x85, 0xE9, 0x00, 0xE6, 0x73, 0x7B, 0x8E, 0x07, 0xEA, 0xC6, 0x38, 0xF7, 0xB3, 0x82, 0x77, 0xEA, 0xD4, 0xFA, 0xEE, 0x6D, 0x20, 0x76, 0xA2, 0xEE, 0xE9, 0x0F, 0xD2, 0xA6, 0xBF, 0x0F},
+		-1},
+	{"CAVP SHA-224 #3",
+		{0x0B, 0x64, 0x48, 0x07, 0x83, 0xE2, 0x60, 0xE1, 0xE9, 0xCA, 0xEF, 0x37, 0xB4, 0xCC, 0x9C, 0x65, 0x0D, 0x2D, 0x57, 0xE2, 0xC5, 0x94, 0xB1, 0x10, 0x63, 0x14, 0x84, 0x3D, 0x8D, 0x7A, 0xB7, 0x4E, 0x29, 0xD3, 0x73, 0xD8, 0x52, 0x2D, 0xEF, 0xFE, 0x40, 0x05, 0x5A, 0xEF, 0x53, 0x9F, 0x53, 0xF3, 0x89, 0x37, 0xEB, 0x79, 0x9B, 0x44, 0xF0, 0x5A, 0x8D, 0x8C, 0x0B, 0x38, 0x1F, 0x12, 0x90, 0x7F},
+		{0x00, 0x00, 0x00, 0x00, 0x49, 0x76, 0x56, 0xE7, 0x80, 0x36, 0x0E, 0xC3, 0xB4, 0xBD, 0x1B, 0xE9, 0x75, 0x70, 0x61, 0x5E, 0x4A, 0x32, 0x46, 0x79, 0x82, 0xCD, 0x93, 0x30, 0xBC, 0x6A, 0xA2, 0x24},
+		{0xC5, 0xC2, 0x6B, 0x0B, 0x21, 0xEE, 0xF0, 0xF7, 0xA0, 0xF1, 0xCF, 0xF3, 0x8D, 0x00, 0x79, 0xD8, 0x90, 0x37, 0x67, 0x59, 0x36, 0x9B, 0x01, 0xD8, 0xD8, 0xE9, 0x59, 0xC1, 0xC7, 0x85, 0xE2, 0x03, 0xFE, 0xCC, 0x40, 0x0B, 0xF0, 0xDE, 0xAB, 0x99, 0xD8, 0x7D, 0xA1, 0x68, 0xB9, 0xD0, 0xDD, 0x31, 0xD2, 0xDF, 0xA3, 0x43, 0x5B, 0x0F, 0xE9, 0xD3, 0x8B, 0x5F, 0xB8, 0xEF, 0xD4, 0x51, 0x95, 0xA4},
+		-1},
+	{"CAVP SHA-224 #4",
+		{0x7F, 0x78, 0xA8, 0xFD, 0x88, 0x0C, 0x50, 0x99, 0x40, 0xE2, 0xB8, 0x3D, 0xE6, 0x7C, 0x9A, 0xB5, 0x53, 0xAB, 0x91, 0x48, 0x9B, 0xAE, 0x75, 0xCD, 0xC1, 0xD5, 0xB5, 0x23, 0xB0, 0x6A, 0xB7, 0xF5, 0x77, 0x86, 0xAE, 0xE7, 0x03, 0x2C, 0x37, 0x3C, 0xDF, 0xAD, 0x7D, 0x9D, 0xDB, 0x6F, 0xA0, 0x9A, 0x02, 0x6F, 0x6D, 0xA3, 0x0F, 0xD4, 0x77, 0xAB, 0x01, 0x4D, 0x30, 0xA2, 0x89, 0xD5, 0x42, 0xA1},
+		{0x00, 0x00, 0x00, 0x00, 0x6D, 0x88, 0xDA, 0x9E, 0x83, 0xAE, 0x94, 0x57, 0xE2, 0x33, 0xD7, 0x97, 0x71, 0x72, 0xC0, 0x62, 0xDF, 0xBD, 0xD1, 0x7D, 0x36, 0x56, 0x94, 0x51, 0x52, 0x51, 0xE0, 0x31},
+		{0xC9, 0x3A, 0xDA, 0x69, 0xDB, 0x32, 0x6F, 0x76, 0xB1, 0x36, 0x2D, 0x61, 0x0C, 0xB8, 0xBC, 0xC6, 0xE7, 0xEF, 0x1D, 0xC0, 0x3D, 0x3D, 0x11, 0x36, 0x7E, 0x15, 0x3C, 0x0E, 0x39, 0xD5, 0xDC, 0x86, 0xD0, 0xC0, 0x2C, 0x71, 0xB1, 0x4E, 0xF7, 0xA4, 0xAF, 0x4E, 0x23, 0xBD, 0x20, 0x7C, 0xE9, 0x84, 0x49, 0xF5, 0xD6, 0xE7, 0xE5, 0xB3, 0xEC, 0x8C, 0xBB, 0xCA, 0x95, 0x49, 0xE9, 0x7D, 0x37, 0x9D},
+		0},
+	{"CAVP SHA-224 #5",
+		{0xE5, 0x8C, 0xDC, 0x20, 0x7C, 0x56, 0xF6, 0x2E, 0x0B, 0xB7, 0xC0, 0xB5, 0x5B, 0x7F, 0x72, 0x36, 0xA6, 0xB3, 0x08, 0xF8, 0xFC, 0x4D, 0xE3, 0xE6, 0x1C, 0xDB, 0x3B, 0xF2, 0x0A, 0xD2, 0xF6, 0x2C, 0x60, 0x56, 0xC0, 0xEE, 0x82, 0x7E, 0x85, 0xBA, 0x28, 0x48, 0x38, 0x95, 0x4D, 0x0C, 0x6C, 0xC0, 0x96, 0xDF, 0x03, 0xB4, 0x61, 0x1B, 0x1E, 0x0F, 0x7F, 0x90, 0x02, 0xBA, 0xC8, 0x68, 0x56, 0xD4},
+		{0x00, 0x00, 0x00, 0x00, 0x3F, 0x9A, 0x97, 0xB8, 0xEA, 0x80, 0x7E, 0xDC, 0x88, 0x78, 0x8D, 0xF8, 0x95, 0x6C, 0x29, 0x6B, 0x1D, 0xAA, 0xED, 0x8D, 0xD1, 0x2D, 0x50, 0xC7, 0x12, 0x34, 0x40, 0x91},
+		{0x2D, 0xF3, 0x90, 0x65, 0x27, 0xAD, 0x32, 0x20, 0x00, 0x28, 0x5B, 0xCC, 0xDD, 0x11, 0xDD, 0x09, 0x13, 0x0D, 0x63, 0x3C, 0xF4, 0x35, 0x34, 0xF5, 0x80, 0x26, 0x04, 0x63, 0x9E, 0xB8, 0x47, 0xE0, 0xAD, 0xAA, 0xAD, 0x19, 0xB7, 0xC6, 0x68, 0x36, 0xEF, 0x0F, 0x4A, 0xFE, 0xFF, 0x8A, 0xC5, 0xE8, 0x98, 0xCD, 0x25, 0x23, 0x24, 0x6A, 0x74, 0xA1, 0xA2, 0x91, 0xA3, 0xA1, 0xFF, 0x58, 0x33, 0x22},
+		0},
+	{"CAVP SHA-224 #6",
+		{0x70, 0xB4, 0xBB, 0xA1, 0x0B, 0x7B, 0xBC, 0x6D, 0x41, 0x75, 0xAD, 0xA8, 0xD4, 0x85, 0xF3, 0x68, 0x5B, 0x13, 0x91, 0x6D, 0x0C, 0x99, 0x23, 0x01, 0xF4, 0x7E, 0x45, 0xB6, 0x29, 0xC6, 0x3D, 0x0E, 0x25, 0x7A, 0x93, 0xBE, 0x31, 0xB0, 0x9F, 0xF4, 0xCD, 0x22, 0xE3, 0x37, 0x5E, 0x30, 0xB5, 0xA7, 0x9F, 0x3B, 0xF3, 0xC7, 0x4C, 0x80, 0xDD, 0xE9, 0x3E, 0x5D, 0x65, 0xE8, 0x8C, 0x07, 0xC1, 0xC4},
+		{0x00, 0x00, 0x00, 0x00, 0xCC, 0x3A, 0x0D, 0x3A, 0x5D, 0x4F, 0x28, 0xDC, 0x91, 0x44, 0xA3, 0xCD, 0xB2, 0x76, 0xEB, 0x92, 0x26, 0x5F, 0x11, 0x57, 0xA8, 0xD8, 0x19, 0x2C, 0xF6, 0x28, 0x67, 0x3C},
+		{0x6E, 0x71, 0x4A, 0x73, 0x7B, 0x07, 0xA4, 0x78, 0x4D, 0x26, 0xBD, 0xE0, 0x39, 0x9D, 0x8E, 0xEE, 0x81, 0x99, 0x8A, 0x13, 0x36, 0x37, 0x85, 0xE2, 0xE4, 0xFB, 0x52, 0x7E, 0x6A, 0x5C, 0x9E, 0x4E, 0x94, 0xC0, 0x22, 0x0F, 0x0F, 0x3F, 0xA6, 0x6F, 0xF2, 0x4F, 0x96, 0x71, 0x7F, 0x46, 0x4B, 0x66, 0xAE, 0x3A, 0x7B, 0x0F, 0x22, 0x8A, 0xB6, 0xA0, 0xB5, 0x77, 0x50, 0x38, 0xDA, 0x13, 0x76, 0x8A},
+		-1},
+	{"CAVP SHA-224 #7",
+		{0x8B, 0x11, 0xB4, 0x8D, 0x23, 0x97, 0x35, 0x50, 0x00, 0xA5, 0x28, 0x9D, 0x81, 0x6B, 0x98, 0x92, 0xAE, 0x64, 0xDF, 0xFC, 0x84, 0x2A, 0xBE, 0xC0, 0x2A, 0x2F, 0xB2, 0xDB, 0x2B, 0xB3, 0x43, 0x10, 0xFC, 0x1A, 0x42, 0x52, 0x8A, 0x04, 0x73, 0xCF, 0xC2, 0xC2, 0xE1, 0x84, 0xB8, 0xBC, 0x50, 0x55, 0x09, 0x63, 0x50, 0xFE, 0x15, 0x49, 0xD2, 0x4B, 0x52, 0x6D, 0x65, 0x36, 0x68, 0x10, 0x26, 0xE8},
+		{0x00, 0x00, 0x00, 0x00, 0xF3, 0x40, 0xE4, 0x91, 0xFA, 0x93, 0x5B, 0xE8, 0x94, 0x5B, 0x8C, 0xAA, 0x48, 0x5D, 0x06, 0x99, 0xC6, 0x63, 0x31, 0xE0, 0xE1, 0x7C, 0x74, 0x07, 0xDA, 0x1B, 0x01, 0x8E},
+		{0x61, 0xA9, 0x1D, 0xD1, 0xC8, 0x00, 0x49, 0xE7, 0x0D, 0xC4, 0xAE, 0xA8, 0x4B, 0xDA, 0x0E, 0xFC, 0x6E, 0xC9, 0xC7, 0xB9, 0xDD, 0x16, 0xEC, 0xBC, 0xCF, 0x68, 0x72, 0x44, 0xC5, 0x11, 0x84, 0xCE, 0xE3, 0x81, 0xE7, 0xB3, 0x2B, 0xAB, 0x49, 0x57, 0x8C, 0x7E, 0x7C, 0xE7, 0x78, 0x4C, 0xE1, 0x92, 0x63, 0xE4, 0xA7, 0xDA, 0xB4, 0xB6, 0x14, 0xDF, 0x41, 0x1D, 0x20, 0xEA, 0xEB, 0xFC, 0x39, 0x1C},
+		-1},
+	{"CAVP SHA-224 #8",
+		{0x7B, 0xAD, 0x1B, 0x3D, 0x8B, 0xAD, 0x43, 0x55, 0xA4, 0x45, 0x11, 0xD2, 0xEB, 0x50, 0xDA, 0xEA, 0xE7, 0x93, 0xAF, 0x99, 0x41, 0x8A, 0xDA, 0x11, 0x83, 0x27, 0x35, 0x99, 0x36, 0xAA, 0x0E, 0x1D, 0xE7, 0xEF, 0xF4, 0x03, 0x34, 0xB7, 0xA5, 0x45, 0x5F, 0x6B, 0x0D, 0x0E, 0xCD, 0xCD, 0xC5, 0x13, 0x70, 0x28, 0x57, 0xBB, 0x5B, 0xBB, 0x73, 0xC9, 0x10, 0xC8, 0x67, 0x46, 0x09, 0x2B, 0xCD, 0x7D},
+		{0x00, 0x00, 0x00, 0x00, 0x9C, 0xF8, 0x45, 0x46, 0xC0, 0x46, 0xB3, 0x70, 0xC3, 0x72, 0xC1, 0x67, 0xEB, 0xBA, 0x39, 0xAF, 0x6A, 0xAD, 0xD6, 0x04, 0x63, 0x62, 0x64, 0x53, 0x78, 0x7B, 0xB0, 0x58},
+		{0xFD, 0x96, 0x1B, 0x60, 0xB2, 0x1B, 0xE3, 0x2B, 0x47, 0xAB, 0xAF, 0xA7, 0x7E, 0x22, 0x19, 0x7D, 0xC9, 0x9A, 0xF6, 0x82, 0x5D, 0xCC, 0xA4, 0x6E, 0x0E, 0x3B, 0x19, 0x91, 0xA9, 0x0A, 0xA2, 0x02, 0xA0, 0x47, 0x7F, 0x97, 0xB9, 0x4A, 0x1C, 0x26, 0xA3, 0xB2, 0xD1, 0x86, 0x79, 0x1D, 0x7F, 0xC9, 0xDF, 0xA8, 0x13, 0x0B, 0xBA, 0xE7, 0x9C, 0x28, 0xFA, 0x11, 0xEC, 0x93, 0xA3, 0xAE, 0xAC, 0x0B},
+		-1},
+	{"CAVP SHA-224 #9",
+		{0x40, 0x7D, 0x92, 0xC9, 0xB2, 0x87, 0x23, 0x60, 0x2B, 0xF0, 0x9F, 0x20, 0xF0, 0xDE, 0x00, 0x2A, 0xFD, 0xF9, 0x0E, 0x22, 0xCB, 0x70, 0x9A, 0x8D, 0x38, 0xE3, 0xC5, 0x1E, 0x82, 0xCB, 0xA9, 0x6C, 0x45, 0x30, 0x65, 0x94, 0x32, 0xE1, 0xDD, 0x74, 0x23, 0x77, 0x68, 0x13, 0x3E, 0x1F, 0x98, 0x08, 0xE6, 0x2D, 0x0F, 0xBE, 0x5D, 0x1D, 0x97, 0x9D, 0x15, 0x71, 0xBA, 0xF6, 0x45, 0xDC, 0xB8, 0x4C},
+		{0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0xCD, 0x48, 0xC9, 0x3F, 0x45, 0x47, 0x2D, 0x25, 0x41, 0x96, 0xBE, 0xBE, 0xA4, 0xBD, 0xDB, 0x27, 0x2A, 0x2A, 0xDF, 0xF2, 0x3B, 0xAB, 0x8C, 0x3A, 0xDF, 0x99},
+		{0xA7, 0xDC, 0x65, 0x29, 0x3E, 0xE3, 0xDE, 0xB0, 0x00, 0x8A, 0xE3, 0xE2, 0xD7, 0xEF, 0x9E, 0x9A, 0x4E, 0xBB, 0x8B, 0xF7, 0xB1, 0x0D, 0x16, 0x5F, 0x80, 0xAB, 0x8B, 0xED, 0x58, 0xD6, 0xFD, 0xEF, 0x3E, 0x83, 0x00, 0xA3, 0xEE, 0x60, 0x3A, 0x8D, 0x82, 0x34, 0xFE, 0x26, 0x5C, 0x62, 0x8E, 0x70, 0x50, 0x15, 0xBF, 0x19, 0x03, 0xEB, 0x74, 0xC9, 0x43, 0x32, 0x30, 0x50, 0x62, 0x6F, 0x70, 0x1F},
+		-1},
+	{"CAVP SHA-224 #10",
+		{0x26, 0xAE, 0xA3, 0xDD, 0x5C, 0x53, 0xF9, 0x84, 0xDB, 0xDA, 0xF4, 0x15, 0xC7, 0xF2, 0x6E, 0x1E, 0x73, 0x04, 0x86, 0x58, 0xA5, 0x48, 0xEB, 0x3B, 0x59, 0xDD, 0x5F, 0x72, 0x18, 0x99, 0x91, 0x9A, 0xDF, 0xF1, 0x5F, 0x57, 0xBD, 0x9B, 0x08, 0x64, 0x4D, 0x49, 0xCB, 0xB2, 0x14, 0x40, 0x36, 0x47, 0x19, 0x57, 0x25, 0xCD, 0x4D, 0x45, 0x11, 0xBC, 0x8A, 0x48, 0xB0, 0x77, 0x04, 0x66, 0xAE, 0x9F},
+		{0x00, 0x00, 0x00, 0x00, 0x75, 0xD6, 0xB6, 0xB5, 0x75, 0xD0, 0xA2, 0xC8, 0x95, 0x28, 0xB8, 0x3C, 0x94, 0xEF, 0x86, 0x4C, 0x82, 0x5B, 0x66, 0x25, 0x3A, 0xB6, 0x62, 0xB3, 0x6B, 0xB0, 0xE7, 0x16},
+		{0x72, 0x6A, 0xF9, 0x2A, 0xFE, 0x53, 0xE8, 0x12, 0x5B, 0x0B, 0x9F, 0x36, 0x59, 0x74, 0x5B, 0xE4, 0x01, 0xA3, 0x7A, 0xE6, 0x58, 0xB7, 0xB1, 0xAA, 0x88, 0xC3, 0xCB, 0x97, 0xE9, 0xDE, 0x22, 0xC3, 0x79, 0x44, 0x84, 0xC5, 0x83, 0x7A, 0x41, 0x9E, 0xFE, 0x11, 0xA4, 0xE4, 0x29, 0x33, 0x41, 0xA6, 0xFA, 0x36, 0xD2, 0x12, 0x30, 0x92, 0x5A, 0x0E, 0x5E, 0x13, 0x58, 0x87, 0x30, 0x2A, 0xCC, 0xA9},
+		-1},
+	{"CAVP SHA-224 #11",
+		{0xE7, 0x34, 0x18, 0x67, 0x7C, 0xE0, 0x44, 0xB3, 0x31, 0xA6, 0xD6, 0x07, 0x73, 0xCB, 0xAE, 0x19, 0x92, 0x21, 0x69, 0x9D, 0x31, 0xE1, 0xBE, 0xC4, 0xB6, 0x8B, 0x9B, 0xC0, 0xB8, 0x7E, 0x4C, 0xD0, 0x37, 0x21, 0x5D, 0xB4, 0xE3, 0xD9, 0x16, 0x1F, 0x33, 0x51, 0xB3, 0x85, 0xA6, 0x1D, 0xDB, 0x2F, 0xCF, 0x1C, 0xEC, 0x46, 0x9D, 0x16, 0x59, 0xE7, 0x57, 0x46, 0x10, 0xED, 0x27, 0xFE, 0x87, 0x9F},
+		{0x00, 0x00, 0x00, 0x00, 0xDC, 0xBB, 0x92, 0xE3, 0xBE, 0x39, 0x51, 0xD3, 0x7E, 0x37, 0x85, 0x2D, 0x50, 0x8F, 0x78, 0xDA, 0x29, 0xC8, 0x18, 0x3C, 0x5D, 0xBE, 0x59, 0xD6, 0x54, 0x9F, 0x78, 0xED},
+		{0xAC, 0x46, 0x92, 0x90, 0xA8, 0xF6, 0x1A, 0x2A, 0x8C, 0x6A, 0xDC, 0x75, 0x33, 0xDD, 0x5C, 0xFE, 0x80, 0x4E, 0x2E, 0x7B, 0xF1, 0x01, 0xCC, 0x74, 0xE5, 0xF6, 0x24, 0xF3, 0x01, 0xBC, 0xCD, 0x23, 0x4C, 0x32, 0x8C, 0x3B, 0xC2, 0x59, 0x31, 0x66, 0x41, 0xFF, 0xF4, 0x47, 0x53, 0x74, 0x3A, 0xFE, 0xBE, 0x89, 0xB8, 0x62, 0x7F, 0x90, 0x4D, 0xF7, 0x24, 0x5E, 0x42, 0xAD, 0xCF, 0xF2, 0xDC, 0x76},
+		-1},
+	{"CAVP SHA-224 #12",
+		{0xB0, 0x89, 0x2B, 0x19, 0xC5, 0x08, 0xB3, 0x54, 0x3A, 0x5A, 0xE8, 0x64, 0xBA, 0x91, 0x94, 0x08, 0x4C, 0x8F, 0x7A, 0xE5, 0x44, 0x76, 0x07, 0x59, 0x55, 0x0C, 0xC1, 0x60, 0x97, 0x2E, 0x87, 0xFF, 0x92, 0x08, 0xE9, 0xB0, 0xC8, 0x6A, 0xD6, 0xBC, 0x83, 0x3E, 0x53, 0x02, 0x6F, 0x23, 0x3D, 0xB9, 0xA4, 0x22, 0x98, 0xCD, 0xB3, 0x5D, 0x90, 0x63, 0x26, 0x00, 0x83, 0x77, 0x52, 0x0B, 0x7D, 0x98},
+		{0x00, 0x00, 0x00, 0x00, 0x90, 0x33, 0x3F, 0xAC, 0xB4, 0xF5, 0x06, 0x8C, 0x1D, 0x05, 0xD1, 0xA4, 0x78, 0xFB, 0x46, 0xD0, 0x2F, 0x36, 0x7E, 0x27, 0x1A, 0x00, 0x04, 0x74, 0xC0, 0x6A, 0x5F, 0xEC},
+		{0xA6, 0x2D, 0xD0, 0xD1, 0x51, 0x8C, 0x6B, 0x9C, 0x60, 0xDE, 0x76, 0x6B, 0x95, 0x23, 0x12, 0xA8, 0xD8, 0xC6, 0xEA, 0xA3, 0x6A, 0x68, 0x19, 0x6D, 0x2A, 0x30, 0xA4, 0x6F, 0xB1, 0x7D, 0xC0, 0x67, 0xB9, 0xDE, 0xD6, 0x60, 0xE9, 0x78, 0x12, 0x92, 0x77, 0xF7, 0x4C, 0x1D, 0x43, 0x60, 0x03, 0xD1, 0xE6, 0xD5, 0x56, 0xDC, 0x8E, 0xED, 0x9D, 0x50, 0x5B, 0xBA, 0xF4, 0xC6, 0x7C, 0xB1, 0x3D, 0x21},
+		-1},
+	{"CAVP SHA-224 #13",
+		{0x8C, 0x5C, 0x41, 0xCB, 0x07, 0xD8, 0x28, 0xA6, 0xA8, 0x6B, 0xE4, 0x53, 0x3A, 0xEF, 0x79, 0x1D, 0x3A, 0x70, 0xA9, 0x5C, 0xB2, 0x85, 0xAA, 0x29, 0x56, 0xB2, 0x1F, 0xEE, 0xAC, 0x2F, 0x8C, 0x49, 0x84, 0x10, 0x15, 0x81, 0xCA, 0xD7, 0xA4, 0x8B, 0x7D, 0x05, 0x96, 0xDF, 0x7F, 0xFE, 0xD4, 0x70, 0x85, 0xD2, 0x2E, 0x8A, 0x4A, 0xF6, 0x85, 0xCD, 0xDB, 0xEE, 0xB3, 0x2E, 0xA6, 0x9A, 0xE1, 0x90},
+		{0x00, 0x00, 0x00, 0x00, 0x8B, 0xB5, 0x2B, 0xD0, 0x45, 0xC9, 0x85, 0x16, 0x7F, 0x67, 0x3C, 0x07, 0xB6, 0x13, 0xA3, 0x40, 0x2F, 0x43, 0x5A, 0x54, 0xC1, 0x22, 0x87, 0x7B, 0xC0, 0xC5, 0xFE, 0x34},
+		{0x98, 0x12, 0x44, 0x9D, 0xF0, 0xA5, 0x1F, 0x7A, 0x2A, 0x8F, 0x78, 0xAA, 0x9A, 0x58, 0x9C, 0xA9, 0x64, 0x4D, 0xCE, 0x28, 0x5F, 0x1E, 0x69, 0x65, 0x8D, 0xAA, 0xEA, 0x75, 0x9F, 0xA5, 0xBD, 0x7E, 0xBE, 0xB4, 0xC2, 0x7C, 0x74, 0x8A, 0x79, 0x44, 0xE3, 0x7A, 0xFE, 0x86, 0x15, 0x76, 0xF7, 0x6B, 0x5A, 0x74, 0x9A, 0x8C, 0xCB, 0xBD, 0x7D, 0xEC, 0x00, 0x83, 0x8B, 0xA2, 0x50, 0xDD, 0xFE, 0x1A},
+		-1},
+	{"CAVP SHA-224 #14",
+		{0x78, 0x8D, 0x7E, 0x54, 0xAB, 0x03, 0x02, 0x0E, 0x49, 0x54, 0xF4, 0x12, 0x59, 0x05, 0x2E, 0xE5, 0xAF, 0x68, 0x36, 0x14, 0x92, 0xB1, 0x80, 0xDA, 0x31, 0xFB, 0xBE, 0x68, 0xD8, 0x68, 0xAA, 0x95, 0x98, 0x2A, 0x3A, 0xBA, 0xBA, 0x6D, 0x35, 0x16, 0x49, 0xE5, 0x6D, 0xA3, 0xFA, 0xEB, 0x71, 0x60, 0xB9, 0xDE, 0x74, 0xE2, 0x2F, 0xE9, 0x3A, 0x06, 0xEA, 0xD1, 0xBD, 0x9A, 0x8D, 0xFF, 0xDF, 0x7E},
+		{0x00, 0x00, 0x00, 0x00, 0x98, 0x70, 0xAE, 0x25, 0xB0, 0xF0, 0x40, 0x3E, 0xFF, 0x10, 0x79, 0xB9, 0x46, 0x69, 0xCF, 0x95, 0xFB, 0x25, 0x0F, 0xB0, 0x98, 0xEE, 0xB8, 0x85, 0xFF, 0x08, 0xF1, 0x17},
+		{0x3D, 0xDE, 0xA0, 0x6B, 0xF8, 0xAA, 0x4A, 0x1B, 0x0C, 0x68, 0x67, 0x4A, 0x2C, 0x47, 0x96, 0xDE, 0xF0, 0xBF, 0xB5, 0x22, 0x36, 0xF4, 0xEF, 0xB3, 0x33, 0x22, 0x04, 0xA4, 0x1F, 0xD8, 0xEA, 0x89, 0x87, 0x12, 0x37, 0x03, 0x94, 0x31, 0xA4, 0x1A, 0xEE, 0xFC, 0xDD, 0x08, 0xF6, 0x78, 0x48, 0xB2, 0xB0, 0x90, 0x67, 0xE3, 0xA1, 0x34, 0x4C, 0x8E, 0xD9, 0xB3, 0x72, 0xD1, 0xB1, 0xC7, 0x54, 0xA6},
+		-1},
+	{"CAVP SHA-256 #0",
+		{0x87, 0xF8, 0xF2, 0xB2, 0x18, 0xF4, 0x98, 0x45, 0xF6, 0xF1, 0x0E, 0xEC, 0x38, 0x77, 0x13, 0x62, 0x69, 0xF5, 0xC1, 0xA5, 0x47, 0x36, 0xDB, 0xDF, 0x69, 0xF8, 0x99, 0x40, 0xCA, 0xD4, 0x15, 0x55, 0xE1, 0x5F, 0x36, 0x90, 0x36, 0xF4, 0x98, 0x42, 0xFA, 0xC7, 0xA8, 0x6C, 0x8A, 0x2B, 0x05, 0x57, 0x60, 0x97, 0x76, 0x81, 0x44, 0x48, 0xB8, 0xF5, 0xE8, 0x4A, 0xA9, 0xF4, 0x39, 0x52, 0x05, 0xE9},
+		{0xA8, 0x2C, 0x31, 0x41, 0x2F, 0x53, 0x71, 0x35, 0xD1, 0xC4, 0x18, 0xBD, 0x71, 0x36, 0xFB, 0x5F, 0xDE, 0x94, 0x26, 0xE7, 0x0C, 0x70, 0xE7, 0xC2, 0xFB, 0x11, 0xF0, 0x2F, 0x30, 0xFD, 0xEA, 0xE2},
+		{0xD1, 0x9F, 0xF4, 0x8B, 0x32, 0x49, 0x15, 0x57, 0x64, 0x16, 0x09, 0x7D, 0x25, 0x44, 0xF7, 0xCB, 0xDF, 0x87, 0x68, 0xB1, 0x45, 0x4A, 0xD2, 0x0E, 0x0B, 0xAA, 0xC5, 0x0E, 0x21, 0x1F, 0x23, 0xB0, 0xA3, 0xE8, 0x1E, 0x59, 0x31, 0x1C, 0xDF, 0xFF, 0x2D, 0x47, 0x84, 0x94, 0x9F, 0x7A, 0x2C, 0xB5, 0x0B, 0xA6, 0xC3, 0xA9, 0x1F, 0xA5, 0x47, 0x10, 0x56, 0x8E, 0x61, 0xAC, 0xA3, 0xE8, 0x47, 0xC6},
+		-1},
+	{"CAVP SHA-256 #1",
+		{0x5C, 0xF0, 0x2A, 0x00, 0xD2, 0x05, 0xBD, 0xFE, 0xE2, 0x01, 0x6F, 0x74, 0x21, 0x80, 0x7F, 0xC3, 0x8A, 0xE6, 0x9E, 0x6B, 0x7C, 0xCD, 0x06, 0x4E, 0xE6, 0x89, 0xFC, 0x1A, 0x94, 0xA9, 0xF7, 0xD2, 0xEC, 0x53, 0x0C, 0xE3, 0xCC, 0x5C, 0x9D, 0x1A, 0xF4, 0x63, 0xF2, 0x64, 0xD6, 0x85, 0xAF, 0xE2, 0xB4, 0xDB, 0x4B, 0x58, 0x28, 0xD7, 0xE6, 0x1B, 0x74, 0x89, 0x30, 0xF3, 0xCE, 0x62, 0x2A, 0x85},
+		{0x59, 0x84, 0xEA, 0xB8, 0x85, 0x4D, 0x0A, 0x9A, 0xA5, 0xF0, 0xC7, 0x0F, 0x96, 0xDE, 0xEB, 0x51, 0x0E, 0x5F, 0x9F, 0xF8, 0xC5, 0x1B, 0xEF, 0xCD, 0xC3, 0xC4, 0x1B, 0xAC, 0x53, 0x57, 0x7F, 0x22},
+		{0xDC, 0x23, 0xD1, 0x30, 0xC6, 0x11, 0x7F, 0xB5, 0x75, 0x12, 0x01, 0x45, 0x5E, 0x99, 0xF3, 0x6F, 0x59, 0xAB, 0xA1, 0xA6, 0xA2, 0x1C, 0xF2, 0xD0, 0xE7, 0x48, 0x1A, 0x97, 0x45, 0x1D, 0x66, 0x93, 0xD6, 0xCE, 0x77, 0x08, 0xC1, 0x8D, 0xBF, 0x35, 0xD4, 0xF8, 0xAA, 0x72, 0x40, 0x92, 0x2D, 0xC6, 0x82, 0x3F, 0x2E, 0x70, 0x58, 0xCB, 0xC1, 0x48, 0x4F, 0xCA, 0xD1, 0x59, 0x9D, 0xB5, 0x01, 0x8C},
+		-1},
+	{"CAVP SHA-256 #2",
+		{0x2D, 0xDF, 0xD1, 0x45, 0x76, 0x78, 0x83, 0xFF, 0xBB, 0x0A, 0xC0, 0x03, 0xAB, 0x4A, 0x44, 0x34, 0x6D, 0x08, 0xFA, 0x25, 0x70, 0xB3, 0x12, 0x0D, 0xCC, 0xE9, 0x45, 0x62, 0x42, 0x22, 0x44, 0xCB, 0x5F, 0x70, 0xC7, 0xD1, 0x1A, 0xC2, 0xB7, 0xA4, 0x35, 0xCC, 0xFB, 0xBA, 0xE0, 0x2C, 0x3D, 0xF1, 0xEA, 0x6B, 0x53, 0x2C, 0xC0, 0xE9, 0xDB, 0x74, 0xF9, 0x3F, 0xFF, 0xCA, 0x7C, 0x6F, 0x9A, 0x64},
+		{0x44, 0xB0, 0x2A, 0xD3, 0x08, 0x80, 0x76, 0xF9, 0x97, 0x22, 0x0A, 0x68, 0xFF, 0x0B, 0x27, 0xA5, 0x8E, 0xCF, 0xA5, 0x28, 0xB6, 0x04, 0x42, 0x70, 0x97, 0xCC, 0xE5, 0xCA, 0x95, 0x62, 0x74, 0xC5},
+		{0x99, 0x13, 0x11, 0x1C, 0xFF, 0x6F, 0x20, 0xC5, 0xBF, 0x45, 0x3A, 0x99, 0xCD, 0x2C, 0x20, 0x19, 0xA4, 0xE7, 0x49, 0xA4, 0x97, 0x24, 0xA0, 0x87, 0x74, 0xD1, 0x4E, 0x4C, 0x11, 0x3E, 0xDD, 0xA8, 0x94, 0x67, 0xCD, 0x4C, 0xD2, 0x1E, 0xCB, 0x56, 0xB0, 0xCA, 0xB0, 0xA9, 0xA4, 0x53, 0xB4, 0x33, 0x86, 0x84, 0x54, 0x59, 0x12, 0x7A, 0x95, 0x24, 0x21, 0xF5, 0xC6, 0x38, 0x28, 0x66, 0xC5, 0xCC},
+		-1},
+	{"CAVP SHA-256 #3",
+		{0xE4, 0x24, 0xDC, 0x61, 0xD4, 0xBB, 0x3C, 0xB7, 0xEF, 0x43, 0x44, 0xA7, 0xF8, 0x95, 0x7A, 0x0C, 0x51, 0x34, 0xE1, 0x6F, 0x7A, 0x67, 0xC0, 0x74, 0xF8, 0x2E, 0x6E, 0x12, 0xF4, 0x9A, 0xBF, 0x3C, 0x97, 0x0E, 0xED, 0x7A, 0xA2, 0xBC, 0x48, 0x65, 0x15, 0x45, 0x94, 0x9D, 0xE1, 0xDD, 0xDA, 0xF0, 0x12, 0x7E, 0x59, 0x65, 0xAC, 0x85, 0xD1, 0x24, 0x3D, 0x6F, 0x60, 0xE7, 0xDF, 0xAE, 0xE9, 0x27},
+		{0xD1, 0xB8, 0xEF, 0x21, 0xEB, 0x41, 0x82, 0xEE, 0x27, 0x06, 0x38, 0x06, 0x10, 0x63, 0xA3, 0xF3, 0xC1, 0x6C, 0x11, 0x4E, 0x33, 0x93, 0x7F, 0x69, 0xFB, 0x23, 0x2C, 0xC8, 0x33, 0x96, 0x5A, 0x94},
+		{0xBF, 0x96, 0xB9, 0x9A, 0xA4, 0x9C, 0x70, 0x5C, 0x91, 0x0B, 0xE3, 0x31, 0x42, 0x01, 0x7C, 0x64, 0x2F, 0xF5, 0x40, 0xC7, 0x63, 0x49, 0xB9, 0xDA, 0xB7, 0x2F, 0x98, 0x1F, 0xD9, 0x34, 0x7F, 0x4F, 0x17, 0xC5, 0x50, 0x95, 0x81, 0x90, 0x89, 0xC2, 0xE0, 0x3B, 0x9C, 0xD4, 0x15, 0xAB, 0xDF, 0x12, 0x44, 0x4E, 0x32, 0x30, 0x75, 0xD9, 0x8F, 0x31, 0x92, 0x0B, 0x9E, 0x0F, 0x57, 0xEC, 0x87, 0x1C},
+		0},
+	{"CAVP SHA-256 #4",
+		{0xE0, 0xFC, 0x6A, 0x6F, 0x50, 0xE1, 0xC5, 0x74, 0x75, 0x67, 0x3E, 0xE5, 0x4E, 0x3A, 0x57, 0xF9, 0xA4, 0x9F, 0x33, 0x28, 0xE7, 0x43, 0xBF, 0x52, 0xF3, 0x35, 0xE3, 0xEE, 0xAA, 0x3D, 0x28, 0x64, 0x7F, 0x59, 0xD6, 0x89, 0xC9, 0x1E, 0x46, 0x36, 0x07, 0xD9, 0x19, 0x4D, 0x99, 0xFA, 0xF3, 0x16, 0xE2, 0x54, 0x32, 0x87, 0x08, 0x16, 0xDD, 0xE6, 0x3F, 0x5D, 0x4B, 0x37, 0x3F, 0x12, 0xF2, 0x2A},
+		{0xB9, 0x33, 0x6A, 0x8D, 0x1F, 0x3E, 0x8E, 0xDE, 0x00, 0x1D, 0x19, 0xF4, 0x13, 0x20, 0xBC, 0x76, 0x72, 0xD7, 0x72, 0xA3, 0xD2, 0xCB, 0x0E, 0x43, 0x5F, 0xFF, 0x3C, 0x27, 0xD6, 0x80, 0x4A, 0x2C},
+		{0x1D, 0x75, 0x83, 0x0C, 0xD3, 0x6F, 0x4C, 0x9A, 0xA1, 0x81, 0xB2, 0xC4, 0x22, 0x1E, 0x87, 0xF1, 0x76, 0xB7, 0xF0, 0x5B, 0x7C, 0x87, 0x82, 0x4E, 0x82, 0xE3, 0x96, 0xC8, 0x83, 0x15, 0xC4, 0x07, 0xCB, 0x2A, 0xCB, 0x01, 0xDA, 0xC9, 0x6E, 0xFC, 0x53, 0xA3, 0x2D, 0x4A, 0x0D, 0x85, 0xD0, 0xC2, 0xE4, 0x89, 0x55, 0x21, 0x47, 0x83, 0xEC, 0xF5, 0x0A, 0x4F, 0x04, 0x14, 0xA3, 0x19, 0xC0, 0x5A},
+		0},
+	{"CAVP SHA-256 #5",
+		{0xA8, 0x49, 0xBE, 0xF5, 0x75, 0xCA, 0xC3, 0xC6, 0x92, 0x0F, 0xBC, 0xE6, 0x75, 0xC3, 0xB7, 0x87, 0x13, 0x62, 0x09, 0xF8, 0x55, 0xDE, 0x19, 0xFF, 0xE2, 0xE8, 0xD2, 0x9B, 0x31, 0xA5, 0xAD, 0x86, 0xBF, 0x5F, 0xE4, 0xF7, 0x85, 0x8F, 0x9B, 0x80, 0x5B, 0xD8, 0xDC, 0xC0, 0x5A, 0xD5, 0xE7, 0xFB, 0x88, 0x9D, 0xE2, 0xF8, 0x22, 0xF3, 0xD8, 0xB4, 0x16, 0x94, 0xE6, 0xC5, 0x5C, 0x16, 0xB4, 0x71},
+		{0x64, 0x0C, 0x13, 0xE2, 0x90, 0x14, 0x7A, 0x48, 0xC8, 0x3E, 0x0E, 0xA7, 0x5A, 0x0F, 0x92, 0x72, 0x3C, 0xDA, 0x12, 0x5E, 0xE2, 0x1A, 0x74, 0x7E, 0x34, 0xC8, 0xD1, 0xB3, 0x6F, 0x16, 0xCF, 0x2D},
+		{0x25, 0xAC, 0xC3, 0xAA, 0x9D, 0x9E, 0x84, 0xC7, 0xAB, 0xF0, 0x8F, 0x73, 0xFA, 0x41, 0x95, 0xAC, 0xC5, 0x06, 0x49, 0x1D, 0x6F, 0xC3, 0x7C, 0xB9, 0x07, 0x45, 0x28, 0xA7, 0xDB, 0x87, 0xB9, 0xD6, 0x9B, 0x21, 0xD5, 0xB5, 0x25, 0x9E, 0xD3, 0xF2, 0xEF, 0x07, 0xDF, 0xEC, 0x6C, 0xC9, 0x0D, 0x3A, 0x37, 0x85, 0x5D, 0x1C, 0xE1, 0x22, 0xA8, 0x5B, 0xA6, 0xA3, 0x33, 0xF3, 0x07, 0xD3, 0x15, 0x37},
+		-1},
+	{"CAVP SHA-256 #6",
+		{0x3D, 0xFB, 0x6F, 0x40, 0xF2, 0x47, 0x1B, 0x29, 0xB7, 0x7F, 0xDC, 0xCB, 0xA7, 0x2D, 0x37, 0xC2, 0x1B, 0xBA, 0x01, 0x9E, 0xFA, 0x40, 0xC1, 0xC8, 0xF9, 0x1E, 0xC4, 0x05, 0xD7, 0xDC, 0xC5, 0xDF, 0xF2, 0x2F, 0x95, 0x3F, 0x1E, 0x39, 0x5A, 0x52, 0xEA, 0xD7, 0xF3, 0xAE, 0x3F, 0xC4, 0x74, 0x51, 0xB4, 0x38, 0x11, 0x7B, 0x1E, 0x04, 0xD6, 0x13, 0xBC, 0x85, 0x55, 0xB7, 0xD6, 0xE6, 0xD1, 0xBB},
+		{0x8A, 0x3E, 0x7A, 0xD7, 0xB9, 0xB1, 0xB0, 0xCD, 0xC4, 0x8E, 0x58, 0xD1, 0xE6, 0x51, 0xFE, 0x6D, 0x71, 0x0F, 0xEF, 0x14, 0x20, 0xAD, 0xDE, 0xB6, 0x15, 0x82, 0xBD, 0xD9, 0x82, 0xD2, 0xB4, 0x4C},
+		{0x54, 0x88, 0x86, 0x27, 0x8E, 0x5E, 0xC2, 0x6B, 0xED, 0x81, 0x1D, 0xBB, 0x72, 0xDB, 0x1E, 0x15, 0x4B, 0x6F, 0x17, 0xBE, 0x70, 0xDE, 0xB1, 0xB2, 0x10, 0x10, 0x7D, 0xEC, 0xB1, 0xEC, 0x2A, 0x5A, 0xE9, 0x3B, 0xFE, 0xBD, 0x2F, 0x14, 0xF3, 0xD8, 0x27, 0xCA, 0x32, 0xB4, 0x64, 0xBE, 0x6E, 0x69, 0x18, 0x7F, 0x5E, 0xDB, 0xD5, 0x2D, 0xEF, 0x4F, 0x96, 0x59, 0x9C, 0x37, 0xD5, 0x8E, 0xEE, 0x75},
+		-1},
+	{"CAVP SHA-256 #7",
+		{0x69, 0xB7, 0x66, 0x70, 0x56, 0xE1, 0xE1, 0x1D, 0x6C, 0xAF, 0x6E, 0x45, 0x64, 0x3F, 0x8B, 0x21, 0xE7, 0xA4, 0xBE, 0xBD, 0xA4, 0x63, 0xC7, 0xFD, 0xBC, 0x13, 0xBC, 0x98, 0xEF, 0xBD, 0x02, 0x14, 0xD3, 0xF9, 0xB1, 0x2E, 0xB4, 0x6C, 0x7C, 0x6F, 0xDA, 0x0D, 0xA3, 0xFC, 0x85, 0xBC, 0x1F, 0xD8, 0x31, 0x55, 0x7F, 0x9A, 0xBC, 0x90, 0x2A, 0x3B, 0xE3, 0xCB, 0x3E, 0x8B, 0xE7, 0xD1, 0xAA, 0x2F},
+		{0xD8, 0x0E, 0x99, 0x33, 0xE8, 0x67, 0x69, 0x73, 0x1E, 0xC1, 0x6F, 0xF3, 0x1E, 0x68, 0x21, 0x53, 0x1B, 0xCF, 0x07, 0xFC, 0xBA, 0xD9, 0xE2, 0xAC, 0x16, 0xEC, 0x9E, 0x6C, 0xB3, 0x43, 0xA8, 0x70},
+		{0x28, 0x8F, 0x7A, 0x1C, 0xD3, 0x91, 0x84, 0x2C, 0xCE, 0x21, 0xF0, 0x0E, 0x6F, 0x15, 0x47, 0x1C, 0x04, 0xDC, 0x18, 0x2F, 0xE4, 0xB1, 0x4D, 0x92, 0xDC, 0x18, 0x91, 0x08, 0x79, 0x79, 0x97, 0x90, 0x24, 0x7B, 0x3C, 0x4E, 0x89, 0xA3, 0xBC, 0xAD, 0xFE, 0xA7, 0x3C, 0x7B, 0xFD, 0x36, 0x1D, 0xEF, 0x43, 0x71, 0x5F, 0xA3, 0x82, 0xB8, 0xC3, 0xED, 0xF4, 0xAE, 0x15, 0xD6, 0xE5, 0x5E, 0x99, 0x79},
+		-1},
+	{"CAVP SHA-256 #8",
+		{0xBF, 0x02, 0xCB, 0xCF, 0x6D, 0x8C, 0xC2, 0x6E, 0x91, 0x76, 0x6D, 0x8A, 0xF0, 0xB1, 0x64, 0xFC, 0x59, 0x68, 0x53, 0x5E, 0x84, 0xC1, 0x58, 0xEB, 0x3B, 0xC4, 0xE2, 0xD7, 0x9C, 0x3C, 0xC6, 0x82, 0x06, 0x9B, 0xA6, 0xCB, 0x06, 0xB4, 0x9D, 0x60, 0x81, 0x20, 0x66, 0xAF, 0xA1, 0x6E, 0xCF, 0x7B, 0x51, 0x35, 0x2F, 0x2C, 0x03, 0xBD, 0x93, 0xEC, 0x22, 0x08, 0x22, 0xB1, 0xF3, 0xDF, 0xBA, 0x03},
+		{0x7C, 0x10, 0x48, 0x88, 0x45, 0x58, 0x96, 0x1C, 0x7E, 0x17, 0x8B, 0x3A, 0x9B, 0x22, 0x58, 0x3F, 0xCA, 0x0D, 0x17, 0xF3, 0x55, 0xA9, 0x88, 0x7E, 0x2F, 0x96, 0xD3, 0x63, 0xD2, 0xA7, 0x76, 0xA3},
+		{0xF5, 0xAC, 0xB0, 0x6C, 0x59, 0xC2, 0xB4, 0x92, 0x7F, 0xB8, 0x52, 0xFA, 0xA0, 0x7F, 0xAF, 0x4B, 0x18, 0x52, 0xBB, 0xB5, 0xD0, 0x68, 0x40, 0x93, 0x5E, 0x84, 0x9C, 0x4D, 0x29, 0x3D, 0x1B, 0xAD, 0x04, 0x9D, 0xAB, 0x79, 0xC8, 0x9C, 0xC0, 0x2F, 0x14, 0x84, 0xC4, 0x37, 0xF5, 0x23, 0xE0, 0x80, 0xA7, 0x5F, 0x13, 0x49, 0x17, 0xFD, 0xA7, 0x52, 0xF2, 0xD5, 0xCA, 0x39, 0x7A, 0xDD, 0xFE, 0x5D},
+		-1},
+	{"CAVP SHA-256 #9",
+		{0x22, 0x4A, 0x4D, 0x65, 0xB9, 0x58, 0xF6, 0xD6, 0xAF, 0xB2, 0x90, 0x48, 0x63, 0xEF, 0xD2, 0xA7, 0x34, 0xB3, 0x17, 0x98, 0x88, 0x48, 0x01, 0xFC, 0xAB, 0x5A, 0x59, 0x0F, 0x4D, 0x6D, 0xA9, 0xDE, 0x17, 0x8D, 0x51, 0xFD, 0xDA, 0xDA, 0x62, 0x80, 0x6F, 0x09, 0x7A, 0xA6, 0x15, 0xD3, 0x3B, 0x8F, 0x24, 0x04, 0xE6, 0xB1, 0x47, 0x9F, 0x5F, 0xD4, 0x85, 0x9D, 0x59, 0x57, 0x34, 0xD6, 0xD2, 0xB9},
+		{0x4C, 0x8D, 0x1A, 0xFB, 0x72, 0x4A, 0xD0, 0xC2, 0xEC, 0x45, 0x8D, 0x86, 0x6A, 0xC1, 0xDB, 0xB4, 0x49, 0x7E, 0x27, 0x3B, 0xBF, 0x05, 0xF8, 0x81, 0x53, 0x10, 0x29, 0x87, 0xE3, 0x76, 0xFA, 0x75},
+		{0x87, 0xB9, 0x3E, 0xE2, 0xFE, 0xCF, 0xDA, 0x54, 0xDE, 0xB8, 0xDF, 0xF8, 0xE4, 0x26, 0xF3, 0xC7, 0x2C, 0x88, 0x64, 0x99, 0x1F, 0x8E, 0xC2, 0xB3, 0x20, 0x5B, 0xB3, 0xB4, 0x16, 0xDE, 0x93, 0xD2, 0x40, 0x44, 0xA2, 0x4D, 0xF8, 0x5B, 0xE0, 0xCC, 0x76, 0xF2, 0x1A, 0x44, 0x30, 0xB7, 0x5B, 0x8E, 0x77, 0xB9, 0x32, 0xA8, 0x7F, 0x51, 0xE4, 0xEC, 0xCB, 0xC4, 0x5C, 0x26, 0x3E, 0xBF, 0x8F, 0x66},
+		-1},
+	{"CAVP SHA-256 #10",
+		{0x43, 0x69, 0x1C, 0x77, 0x95, 0xA5, 0x7E, 0xAD, 0x8C, 0x5C, 0x68, 0x53, 0x6F, 0xE9, 0x34, 0x53, 0x8D, 0x46, 0xF1, 0x28, 0x89, 0x68, 0x0A, 0x9C, 0xB6, 0xD0, 0x55, 0xA0, 0x66, 0x22, 0x83, 0x69, 0xF8, 0x79, 0x01, 0x10, 0xB3, 0xC3, 0xB2, 0x81, 0xAA, 0x1E, 0xAE, 0x03, 0x7D, 0x4F, 0x12, 0x34, 0xAF, 0xF5, 0x87, 0xD9, 0x03, 0xD9, 0x3B, 0xA3, 0xAF, 0x22, 0x5C, 0x27, 0xDD, 0xC9, 0xCC, 0xAC},
+		{0x85, 0x81, 0x03, 0x4E, 0xC7, 0xD7, 0xA6, 0xB1, 0x63, 0xD7, 0x18, 0x20, 0x92, 0x3F, 0x61, 0x6B, 0x36, 0x27, 0x48, 0xF2, 0x84, 0x60, 0x42, 0xC9, 0x89, 0x6D, 0x8E, 0x4B, 0xF7, 0x57, 0x79, 0x60},
+		{0x8A, 0xCD, 0x62, 0xE8, 0xC2, 0x62, 0xFA, 0x50, 0xDD, 0x98, 0x40, 0x48, 0x09, 0x69, 0xF4, 0xEF, 0x70, 0xF2, 0x18, 0xEB, 0xF8, 0xEF, 0x95, 0x84, 0xF1, 0x99, 0x03, 0x11, 0x32, 0xC6, 0xB1, 0xCE, 0xCF, 0xCA, 0x7E, 0xD3, 0xD4, 0x34, 0x7F, 0xB2, 0xA2, 0x9E, 0x52, 0x6B, 0x43, 0xC3, 0x48, 0xAE, 0x1C, 0xE6, 0xC6, 0x0D, 0x44, 0xF3, 0x19, 0x1B, 0x6D, 0x8E, 0xA3, 0xA2, 0xD9, 0xC9, 0x21, 0x54},
+		-1},
+	{"CAVP SHA-256 #11",
+		{0x91, 0x57, 0xDB, 0xFC, 0xF8, 0xCF, 0x38, 0x5F, 0x5B, 0xB1, 0x56, 0x8A, 0xD5, 0xC6, 0xE2, 0xA8, 0x65, 0x2B, 0xA6, 0xDF, 0xC6, 0x3B, 0xC1, 0x75, 0x3E, 0xDF, 0x52, 0x68, 0xCB, 0x7E, 0xB5, 0x96, 0x97, 0x25, 0x70, 0xF4, 0x31, 0x3D, 0x47, 0xFC, 0x96, 0xF7, 0xC0, 0x2D, 0x55, 0x94, 0xD7, 0x7D, 0x46, 0xF9, 0x1E, 0x94, 0x98, 0x08, 0x82, 0x5B, 0x3D, 0x31, 0xF0, 0x29, 0xE8, 0x29, 0x64, 0x05},
+		{0xE5, 0xB3, 0x0E, 0x00, 0x41, 0xA3, 0x32, 0x81, 0x21, 0x06, 0x44, 0x93, 0x8D, 0x9A, 0xAA, 0x15, 0xEF, 0x2C, 0x12, 0x47, 0xB4, 0x17, 0x8F, 0x7C, 0xA1, 0xEE, 0x93, 0x5C, 0xE2, 0x3D, 0xAA, 0xBC},
+		{0xDF, 0xAE, 0xA6, 0xF2, 0x97, 0xFA, 0x32, 0x0B, 0x70, 0x78, 0x66, 0x12, 0x5C, 0x2A, 0x7D, 0x5D, 0x51, 0x5B, 0x51, 0xA5, 0x03, 0xBE, 0xE8, 0x17, 0xDE, 0x9F, 0xAA, 0x34, 0x3C, 0xC4, 0x8E, 0xEB, 0x8F, 0x78, 0x0A, 0xD7, 0x13, 0xF9, 0xC3, 0xE5, 0xA4, 0xF7, 0xFA, 0x4C, 0x51, 0x98, 0x33, 0xDF, 0xEF, 0xC6, 0xA7, 0x43, 0x23, 0x89, 0xB1, 0xE4, 0xAF, 0x46, 0x39, 0x61, 0xF0, 0x97, 0x64, 0xF2},
+		-1},
+	{"CAVP SHA-256 #12",
+		{0x07, 0x2B, 0x10, 0xC0, 0x81, 0xA4, 0xC1, 0x71, 0x3A, 0x29, 0x4F, 0x24, 0x8A, 0xEF, 0x85, 0x0E, 0x29, 0x79, 0x91, 0xAC, 0xA4, 0x7F, 0xA9, 0x6A, 0x74, 0x70, 0xAB, 0xE3, 0xB8, 0xAC, 0xFD, 0xDA, 0x95, 0x81, 0x14, 0x5C, 0xCA, 0x04, 0xA0, 0xFB, 0x94, 0xCE, 0xDC, 0xE7, 0x52, 0xC8, 0xF0, 0x37, 0x08, 0x61, 0x91, 0x6D, 0x2A, 0x94, 0xE7, 0xC6, 0x47, 0xC5, 0x37, 0x3C, 0xE6, 0xA4, 0xC8, 0xF5},
+		{0xED, 0xD7, 0x2D, 0xC0, 0xAA, 0x91, 0x64, 0x9E, 0x09, 0xE2, 0x48, 0x9C, 0x37, 0xEC, 0x27, 0xEF, 0xAB, 0x3B, 0x61, 0x95, 0x37, 0x62, 0xC6, 0xB4, 0x53, 0x2A, 0x9B, 0x1C, 0xD0, 0x8A, 0x50, 0x0D},
+		{0x09, 0xF5, 0x48, 0x3E, 0xCC, 0xEC, 0x80, 0xF9, 0xD1, 0x04, 0x81, 0x5A, 0x1B, 0xE9, 0xCC, 0x1A, 0x8E, 0x5B, 0x12, 0xB6, 0xEB, 0x48, 0x2A, 0x65, 0xC6, 0x90, 0x7B, 0x74, 0x80, 0xCF, 0x4F, 0x19, 0xA4, 0xF9, 0x0E, 0x56, 0x0C, 0x5E, 0x4E, 0xB8, 0x69, 0x6C, 0xB2, 0x76, 0xE5, 0x16, 0x5B, 0x6A, 0x9D, 0x48, 0x63, 0x45, 0xDE, 0xDF, 0xB0, 0x94, 0xA7, 0x6E, 0x84, 0x42, 0xD0, 0x26, 0x37, 0x8D},
+		-1},
+	{"CAVP SHA-256 #13",
+		{0x09, 0x30, 0x8E, 0xA5, 0xBF, 0xAD, 0x6E, 0x5A, 0xDF, 0x40, 0x86, 0x34, 0xB3, 0xD5, 0xCE, 0x92, 0x40, 0xD3, 0x54, 0x42, 0xF7, 0xFE, 0x11, 0x64, 0x52, 0xAA, 0xEC, 0x0D, 0x25, 0xBE, 0x8C, 0x24, 0xF4, 0x0C, 0x93, 0xE0, 0x23, 0xEF, 0x49, 0x4B, 0x1C, 0x30, 0x79, 0xB2, 0xD1, 0x0E, 0xF6, 0x7F, 0x31, 0x70, 0x74, 0x04, 0x95, 0xCE, 0x2C, 0xC5, 0x7F, 0x8E, 0xE4, 0xB0, 0x61, 0x8B, 0x8E, 0xE5},
+		{0x0D, 0x06, 0xBA, 0x42, 0xD2, 0x56, 0x06, 0x2E, 0x16, 0xB3, 0x19, 0xA0, 0xF3, 0x09, 0x91, 0x09, 0x51, 0x8A, 0x76, 0x5F, 0x26, 0xBA, 0xC3, 0xB9, 0xF5, 0x69, 0x30, 0xD9, 0x65, 0x61, 0x77, 0x26},
+		{0x5C, 0xC8, 0xAA, 0x7C, 0x35, 0x74, 0x3E, 0xC0, 0xC2, 0x3D, 0xDE, 0x88, 0xDA, 0xBD, 0x5E, 0x4F, 0xCD, 0x01, 0x92, 0xD2, 0x11, 0x6F, 0x69, 0x26, 0xFE, 0xF7, 0x88, 0xCD, 0xDB, 0x75, 0x4E, 0x73, 0x9C, 0x9C, 0x04, 0x5E, 0xBA, 0xA1, 0xB8, 0x28, 0xC3, 0x2F, 0x82, 0xAC, 0xE0, 0xD1, 0x8D, 0xAE, 0xBF, 0x5E, 0x15, 0x6E, 0xB7, 0xCB, 0xFD, 0xC1, 0xEF, 0xF4, 0x39, 0x9A, 0x8A, 0x90, 0x0A, 0xE7},
+		-1},
+	{"CAVP SHA-256 #14",
+		{0x2D, 0x98, 0xEA, 0x01, 0xF7, 0x54, 0xD3, 0x4B, 0xBC, 0x30, 0x03, 0xDF, 0x50, 0x50, 0x20, 0x0A, 0xBF, 0x44, 0x5E, 0xC7, 0x28, 0x55, 0x6D, 0x7E, 0xD7, 0xD5, 0xC5, 0x4C, 0x55, 0x55, 0x2B, 0x6D, 0x9B, 0x52, 0x67, 0x27, 0x42, 0xD6, 0x37, 0xA3, 0x2A, 0xDD, 0x05, 0x6D, 0xFD, 0x6D, 0x87, 0x92, 0xF2, 0xA3, 0x3C, 0x2E, 0x69, 0xDA, 0xFA, 0xBE, 0xA0, 0x9B, 0x96, 0x0B, 0xC6, 0x1E, 0x23, 0x0A},
+		{0x41, 0x00, 0x78, 0x76, 0x92, 0x6A, 0x20, 0xF8, 0x21, 0xD7, 0x2D, 0x9C, 0x6F, 0x2C, 0x9D, 0xAE, 0x6C, 0x03, 0x95, 0x41, 0x23, 0xEA, 0x6E, 0x69, 0x39, 0xD7, 0xE6, 0xE6, 0x69, 0x43, 0x88, 0x91},
+		{0x06, 0x10, 0x8E, 0x52, 0x5F, 0x84, 0x5D, 0x01, 0x55, 0xBF, 0x60, 0x19, 0x32, 0x22, 0xB3, 0x21, 0x9C, 0x98, 0xE3, 0xD4, 0x94, 0x24, 0xC2, 0xFB, 0x2A, 0x09, 0x87, 0xF8, 0x25, 0xC1, 0x79, 0x59, 0x62, 0xB5, 0xCD, 0xD5, 0x91, 0xE5, 0xB5, 0x07, 0xE5, 0x60, 0x16, 0x7B, 0xA8, 0xF6, 0xF7, 0xCD, 0xA7, 0x46, 0x73, 0xEB, 0x31, 0x56, 0x80, 0xCB, 0x89, 0xCC, 0xBC, 0x4E, 0xEC, 0x47, 0x7D, 0xCE},
+		0},
+	{"CAVP SHA-384 #0",
+		{0x40, 0xDE, 0xD1, 0x3D, 0xBB, 0xE7, 0x2C, 0x62, 0x9C, 0x38, 0xF0, 0x7F, 0x7F, 0x95, 0xCF, 0x75, 0xA5, 0x0E, 0x2A, 0x52, 0x48, 0x97, 0x60, 0x4C, 0x84, 0xFA, 0xFD, 0xE5, 0xE4, 0xCA, 0xFB, 0x9F, 0xA1, 0x72, 0x02, 0xE9, 0x2D, 0x7D, 0x6A, 0x37, 0xC4, 0x38, 0x77, 0x93, 0x49, 0xFD, 0x79, 0x56, 0x7D, 0x75, 0xA4, 0x0E, 0xF2, 0x2B, 0x7D, 0x09, 0xCA, 0x21, 0xCC, 0xF4, 0xAE, 0xC9, 0xA6, 0x6C},
+		{0x5A, 0xA8, 0xE8, 0xA6, 0xF0, 0x62, 0x2B, 0x84, 0x14, 0x16, 0xE1, 0xA7, 0x0D, 0x79, 0xA5, 0x46, 0x41, 0xD2, 0xC6, 0x99, 0xA0, 0x75, 0xB6, 0x96, 0x0F, 0xE5, 0xDC, 0xF9, 0x63, 0x01, 0xDA, 0x8C},
+		{0xBE, 0x34, 0x73, 0x0C, 0x31, 0x73, 0x0B, 0x4E, 0x41, 0x2E, 0x6C, 0x52, 0xC2, 0x3E, 0xDB, 0xD3, 0x65, 0x83, 0xAC, 0xE2, 0x10, 0x2B, 0x39, 0xAF, 0xA1, 0x1D, 0x24, 0xB6, 0x84, 0x8C, 0xB7, 0x7F, 0x03, 0x65, 0x52, 0x02, 0xD5, 0xFD, 0x8C, 0x9E, 0x3A, 0xE9, 0x71, 0xB6, 0xF0, 0x80, 0x64, 0x0C, 0x40, 0x61, 0x12, 0xFD, 0x95, 0xE7, 0x01, 0x58, 0x74, 0xE9, 0xB6, 0xEE, 0x77, 0x75, 0x2B, 0x10},
+		-1},
+	{"CAVP SHA-384 #1",
+		{0x1F, 0x80, 0xE1, 0x9F, 0xFE, 0xB5, 0x1D, 0xD7, 0x4F, 0x1C, 0x39, 0x7A, 0xC3, 0xDF, 0xD3, 0x41, 0x5A, 0xB1, 0x6E, 0xBD, 0x08, 0x47, 0xED, 0x11, 0x9E, 0x6C, 0x3B, 0x15, 0xA1, 0xA8, 0x84, 0xB8, 0x9B, 0x39, 0x57, 0x87, 0x37, 0x1D, 0xBF, 0xB5, 0x5D, 0x13, 0x47, 0xD7, 0xBE, 0xD1, 0xC2, 0x61, 0xD2, 0x90, 0x81, 0x21, 0xFB, 0x78, 0xDE, 0x1D, 0x1B, 0xF2, 0xD0, 0x06, 0x66, 0xA6, 0x2A, 0xED},
+		{0x24, 0x46, 0x56, 0x18, 0x6C, 0x11, 0xC2, 0xE6, 0x7B, 0xE8, 0x80, 0x99, 0xD5, 0x5E, 0x60, 0xF4, 0xB6, 0x8E, 0x61, 0xFB, 0xA0, 0xB2, 0x14, 0xAA, 0xC3, 0x39, 0x9D, 0xC5, 0x59, 0xCF, 0xCC, 0xC0},
+		{0x24, 0x9C, 0xA2, 0xC3, 0xEB, 0x6E, 0x04, 0xAC, 0x57, 0x33, 0x4C, 0x2F, 0x75, 0xDC, 0x5E, 0x65, 0x8B, 0xBB, 0x48, 0x5B, 0xF1, 0x87, 0x10, 0x07, 0x74, 0xF5, 0x09, 0x9D, 0xD1, 0x3E, 0xF7, 0x07, 0x97, 0x36, 0x3A, 0x05, 0x20, 0x2B, 0x60, 0x2D, 0x13, 0x16, 0x63, 0x46, 0x69, 0x4E, 0x38, 0x13, 0x5B, 0xBC, 0xE0, 0x25, 0xBE, 0x94, 0x95, 0x0E, 0x92, 0x33, 0xF4, 0xC8, 0x01, 0x3B, 0xF5, 0xBF},
+		-1},
+	{"CAVP SHA-384 #2",
+		{0xCE, 0x4D, 0xCF, 0xA7, 0x38, 0x4C, 0x83, 0x44, 0x3A, 0xCE, 0x0F, 0xB8, 0x2C, 0x4A, 0xC1, 0xAD, 0xFA, 0x10, 0x0A, 0x9B, 0x2C, 0x7B, 0xF0, 0x9F, 0x09, 0x3F, 0x8B, 0x6D, 0x08, 0x4E, 0x50, 0xC2, 0xD9, 0x8A, 0xE7, 0xB9, 0x1A, 0xBE, 0xE6, 0x48, 0xD0, 0xBF, 0xDE, 0x19, 0x27, 0x03, 0x74, 0x1A, 0xC2, 0x1D, 0xAA, 0xD7, 0x26, 0x2A, 0xF4, 0x18, 0xB5, 0x0E, 0x40, 0x6D, 0x82, 0x5E, 0xB0, 0xD6},
+		{0xAD, 0xAE, 0xAD, 0xDA, 0x3F, 0x0E, 0x94, 0x1F, 0xBA, 0x1D, 0x3E, 0x20, 0x6A, 0x84, 0xE6, 0xD7, 0x53, 0x0D, 0x80, 0x0E, 0x0F, 0x21, 0x5B, 0x3D, 0xDD, 0x82, 0x02, 0x2F, 0x27, 0xC5, 0xBE, 0x44},
+		{0x59, 0x7E, 0x1E, 0x04, 0xD9, 0x3A, 0x6B, 0x44, 0x4C, 0xCC, 0x44, 0x7A, 0x48, 0x65, 0x1F, 0x17, 0x65, 0x7F, 0xF4, 0x3F, 0xB6, 0x5F, 0xE9, 0x44, 0x61, 0xD2, 0xBF, 0x81, 0x6B, 0x01, 0xAF, 0x40, 0x35, 0x9F, 0xE3, 0x81, 0x79, 0x63, 0x54, 0x8E, 0x67, 0x6D, 0x6D, 0xA3, 0x4C, 0x2D, 0x08, 0x66, 0xAA, 0x42, 0x49, 0x92, 0x37, 0xB6, 0x82, 0x00, 0x28, 0x89, 0xEA, 0xF8, 0x89, 0x38, 0x14, 0xD2},
+		0},
+	{"CAVP SHA-384 #3",
+		{0x1B, 0x67, 0x7F, 0x53, 0x5A, 0xC6, 0x9D, 0x1A, 0xCD, 0x45, 0x92, 0xC0, 0xD1, 0x2F, 0xAC, 0x13, 0xC9, 0x13, 0x1E, 0x5A, 0x6F, 0x8A, 0xB4, 0xF9, 0xD0, 0xAF, 0xDC, 0xB3, 0xA3, 0xF3, 0x27, 0xE0, 0x5D, 0xCA, 0x2C, 0x73, 0xEC, 0x89, 0xE5, 0x8E, 0xF8, 0x26, 0x7C, 0xBA, 0x2B, 0xB5, 0xEB, 0x0F, 0x55, 0x1F, 0x41, 0x2F, 0x9D, 0xC0, 0x87, 0xC1, 0xA6, 0x94, 0x4F, 0x0C, 0xE4, 0x75, 0x27, 0x7A},
+		{0xE3, 0x4A, 0x54, 0x1F, 0x87, 0xFF, 0x0E, 0xAA, 0x0C, 0x64, 0x0F, 0x55, 0x5C, 0xAE, 0xC6, 0xBF, 0x11, 0xA1, 0x32, 0x0C, 0x74, 0xC4, 0x7A, 0x8F, 0xF1, 0x72, 0xC4, 0xE2, 0xEC, 0x90, 0x2E, 0x48},
+		{0xDF, 0x0B, 0x0C, 0xD7, 0x6D, 0x25, 0x55, 0xD4, 0xC3, 0x8B, 0x3D, 0x70, 0xBF, 0xDF, 0x96, 0x48, 0x84, 0xD0, 0xBE, 0xEB, 0x9F, 0x74, 0x38, 0x5F, 0x08, 0x93, 0xE8, 0x7D, 0x20, 0xC9, 0x64, 0x2D, 0x12, 0x82, 0x99, 0xAA, 0xBF, 0x1F, 0x54, 0x96, 0x11, 0x2B, 0xE1, 0xFE, 0x04, 0x36, 0x5F, 0x5F, 0x82, 0x15, 0xB0, 0x8A, 0x04, 0x0A, 0xBD, 0xFE, 0xCA, 0x46, 0x26, 0xF4, 0xD1, 0x5C, 0x00, 0x5B},
+		-1},
+	{"CAVP SHA-384 #4",
+		{0x7F, 0xFC, 0x28, 0x53, 0xF3, 0xE1, 0x78, 0x87, 0xDD, 0xA1, 0x3B, 0x0E, 0xB4, 0x3F, 0x18, 0x3C, 0xE5, 0x0A, 0x5A, 0xC0, 0xF8, 0xBB, 0xA7, 0x5F, 0xB1, 0x92, 0x11, 0x72, 0x48, 0x4F, 0x9B, 0x94, 0x4C, 0xC5, 0x23, 0xD1, 0x41, 0x92, 0xF8, 0x0B, 0xD5, 0xB2, 0x7D, 0x30, 0xB3, 0xB4, 0x1E, 0x06, 0x4D, 0xA8, 0x7B, 0xFB, 0xAE, 0x15, 0x57, 0x2D, 0xD3, 0x82, 0xB9, 0xA1, 0x76, 0xC1, 0x23, 0xA2},
+		{0x06, 0x89, 0x92, 0x7A, 0x38, 0x48, 0x6C, 0xCC, 0xF2, 0x8F, 0xE9, 0x45, 0x4E, 0x08, 0xE0, 0xD7, 0x48, 0x43, 0x42, 0x4B, 0x89, 0xBE, 0x4C, 0xDE, 0xE8, 0xE4, 0x8F, 0x39, 0xA6, 0x9A, 0xDD, 0xEC},
+		{0x31, 0x56, 0x17, 0x6D, 0x52, 0xEB, 0x26, 0xF9, 0x39, 0x12, 0x29, 0xDE, 0x42, 0x51, 0x99, 0x3A, 0x41, 0xB8, 0x17, 0x2F, 0x78, 0x97, 0x0B, 0xB7, 0x0E, 0x32, 0xA2, 0x45, 0xBE, 0x4B, 0xB6, 0x53, 0x62, 0x82, 0x7A, 0x29, 0xE1, 0x2D, 0x2F, 0x29, 0xB0, 0x0F, 0xB2, 0xD0, 0x2D, 0xD5, 0xF2, 0xD5, 0x41, 0x2E, 0x17, 0xA4, 0x45, 0x5F, 0x44, 0x31, 0xA5, 0xC9, 0x96, 0x88, 0x1F, 0xDF, 0xC0, 0xEE},
+		-1},
+	{"CAVP SHA-384 #5",
+		{0x55, 0x69, 0xF7, 0x6D, 0xC9, 0x42, 0x43, 0xCD, 0xE8, 0x19, 0xFB, 0x6F, 0xC8, 0x51, 0x44, 0xEC, 0x67, 0xE2, 0xB5, 0xD4, 0x95, 0x39, 0xF6, 0x2E, 0x24, 0xD4, 0x06, 0xD1, 0xB6, 0x8F, 0x00, 0x58, 0x12, 0x08, 0xC3, 0x8D, 0xBE, 0x25, 0x87, 0x0D, 0xEA, 0xB5, 0x3C, 0x48, 0x6F, 0x79, 0x3A, 0x1E, 0x25, 0x0C, 0x9D, 0x1B, 0x8E, 0x7C, 0x14, 0x7E, 0xA6, 0x8B, 0x71, 0x19, 0x6C, 0x44, 0x07, 0x30},
+		{0x97, 0xF8, 0xF8, 0xCE, 0xA4, 0x35, 0x28, 0x2A, 0xC7, 0x46, 0x73, 0x0A, 0xC7, 0x44, 0xBF, 0x97, 0xD8, 0x5D, 0x4E, 0x24, 0x9C, 0x0B, 0x1D, 0x9C, 0x7B, 0x83, 0xC7, 0xE5, 0x9A, 0xED, 0x17, 0x2F},
+		{0x70, 0x6F, 0x2B, 0xA4, 0x02, 0x5E, 0x7C, 0x06, 0xB6, 0x6D, 0x63, 0x69, 0xA3, 0xF9, 0x3B, 0x2F, 0xEC, 0x46, 0xC5, 0x1E, 0xCE, 0xFF, 0x42, 0xA1, 0x58, 0xF7, 0x43, 0x19, 0x19, 0x50, 0x6C, 0xFB, 0xB4, 0xE7, 0x5A, 0xC3, 0x4A, 0x96, 0x39, 0x32, 0x37, 0xFC, 0x43, 0x37, 0x78, 0x9E, 0x37, 0x16, 0x8D, 0x79, 0x38, 0x27, 0x05, 0xB2, 0x48, 0x05, 0x1C, 0x9C, 0x72, 0xBC, 0xBA, 0xC5, 0xF5, 0x16},
+		-1},
+	{"CAVP SHA-384 #6",
+		{0xE4, 0xB4, 0x70, 0xC6, 0x5B, 0x2C, 0x04, 0xDB, 0x06, 0x0D, 0x71, 0x05, 0xEC, 0x69, 0x11, 0x58, 0x98, 0x63, 0xD3, 0xC7, 0xF7, 0xCE, 0x48, 0x72, 0x6B, 0xA3, 0xF3, 0x69, 0xEA, 0x34, 0x67, 0xE8, 0x44, 0xC3, 0x8D, 0x3A, 0xE0, 0x98, 0xDE, 0x05, 0xF5, 0x91, 0x5A, 0x58, 0x68, 0xC1, 0x7F, 0xEE, 0x29, 0x6A, 0x6E, 0x15, 0x0B, 0xEB, 0x1F, 0x00, 0x0D, 0xF5, 0xF3, 0xBE, 0xC8, 0xFC, 0x45, 0x32},
+		{0x5B, 0x93, 0x7A, 0x2A, 0xF4, 0x6D, 0xBF, 0x18, 0xB4, 0xA6, 0xFB, 0x04, 0x2E, 0xA3, 0x53, 0xA6, 0x87, 0x8E, 0x0D, 0x4B, 0xEA, 0xC0, 0x16, 0x00, 0x2B, 0x3D, 0x91, 0xA4, 0x2B, 0xCB, 0xA5, 0x28},
+		{0xC9, 0xC3, 0x47, 0xEE, 0x57, 0x17, 0xE4, 0xC7, 0x59, 0xDD, 0xAF, 0x09, 0xE8, 0x6F, 0x4E, 0x1D, 0xB2, 0xC8, 0x65, 0x85, 0x93, 0x17, 0x7C, 0xFD, 0xA4, 0xE6, 0x51, 0x4B, 0x5E, 0x3E, 0xCB, 0x87, 0xBA, 0xAE, 0x01, 0xE9, 0xE4, 0x4A, 0x7B, 0x04, 0xD6, 0x9C, 0x8E, 0xAA, 0xED, 0x77, 0xC9, 0xE3, 0xA3, 0x6C, 0xE8, 0x96, 0x2F, 0x95, 0xCC, 0x50, 0xA0, 0xDB, 0x14, 0x6B, 0x4E, 0x49, 0xEB, 0x40},
+		-1},
+	{"CAVP SHA-384 #7",
+		{0x96, 0x05, 0x0C, 0x5F, 0xA2, 0xDD, 0xD1, 0xB2, 0xE5, 0x45, 0x1D, 0x89, 0xEE, 0x74, 0xA0, 0xB7, 0xB5, 0x43, 0x47, 0x36, 0x4D, 0xDC, 0x02, 0x31, 0x71, 0x5A, 0x6E, 0xF1, 0x14, 0x6F, 0xE8, 0xDC, 0xE0, 0x88, 0x8A, 0x9E, 0x78, 0xAE, 0xEA, 0x87, 0xF6, 0xE1, 0xE9, 0x00, 0x2B, 0x26, 0x51, 0x16, 0x9F, 0x36, 0xC4, 0xEE, 0x53, 0x01, 0x3C, 0xFC, 0x8C, 0x99, 0x12, 0xB7, 0xFD, 0x50, 0x48, 0x58},
+		{0xB1, 0x23, 0xE0, 0x77, 0x44, 0xF0, 0x5A, 0xD5, 0x23, 0x79, 0x0E, 0xA5, 0xBF, 0xA3, 0xF8, 0x48, 0x86, 0x9A, 0x3B, 0xFD, 0xBF, 0x93, 0x6A, 0x49, 0x6C, 0x86, 0x06, 0xB5, 0x77, 0xED, 0x84, 0x27},
+		{0x23, 0x53, 0xD6, 0xCD, 0x3C, 0x21, 0xB8, 0xEA, 0x7D, 0xBC, 0x1C, 0xD9, 0x40, 0x51, 0x98, 0x12, 0xDB, 0xE3, 0x65, 0xA3, 0xB1, 0x5C, 0xD6, 0xAE, 0xBB, 0xA9, 0xD1, 0x1C, 0xF2, 0x69, 0x86, 0x7A, 0x85, 0xF5, 0x60, 0x27, 0x3C, 0xD9, 0xE8, 0x2E, 0x68, 0x01, 0xE4, 0xCB, 0x1C, 0x8C, 0xD2, 0x9C, 0xDA, 0xC3, 0x4A, 0x02, 0x0D, 0xA2, 0x11, 0xD7, 0x74, 0x53, 0x75, 0x6B, 0x60, 0x4B, 0x8F, 0xA7},
+		0},
+	{"CAVP SHA-384 #8",
+		{0x0C, 0x07, 0xBB, 0x79, 0xF4, 0x40, 0x12, 0x29, 0x9F, 0xBF, 0xD5, 0xA0, 0xF3, 0x13, 0x97, 0xAA, 0xF7, 0xD7, 0x57, 0xF8, 0xA3, 0x84, 0x37, 0x40, 0x7C, 0x1B, 0x09, 0x27, 0x1C, 0x65, 0x51, 0xA0, 0x84, 0xFE, 0x78, 0x46, 0xD5, 0xD4, 0x03, 0xDC, 0x92, 0xC0, 0x09, 0x1F, 0xBD, 0x39, 0xF3, 0xC5, 0xCB, 0xCA, 0x3F, 0x94, 0xC1, 0x0B, 0x5C, 0xAE, 0x44, 0xE2, 0xE9, 0x65, 0x62, 0x13, 0x1B, 0x13},
+		{0xFB, 0x8D, 0x12, 0x65, 0x2D, 0xE5, 0x9E, 0x63, 0xEF, 0x52, 0x97, 0x64, 0x1D, 0xFB, 0xCE, 0x08, 0x48, 0x08, 0xDE, 0x14, 0x67, 0x20, 0xE9, 0x06, 0x9C, 0x2E, 0xF8, 0x14, 0xBC, 0xD8, 0x0B, 0x61},
+		{0x49, 0xE9, 0x42, 0x5F, 0x82, 0xD0, 0xA8, 0xC5, 0x03, 0x00, 0x9C, 0xEA, 0xD2, 0x4E, 0x12, 0xAD, 0xC9, 0xD4, 0x8A, 0x08, 0x59, 0x40, 0x94, 0xCA, 0x4F, 0x6D, 0x13, 0xAD, 0x1E, 0x3C, 0x57, 0x1D, 0x1F, 0x1B, 0x70, 0xAA, 0xA3, 0x0A, 0x8F, 0xF6, 0x39, 0xAA, 0x09, 0x35, 0x94, 0x4E, 0x9B, 0x88, 0x32, 0x6A, 0x21, 0x3A, 0xB8, 0xFC, 0xE5, 0x19, 0x4C, 0x1A, 0x9D, 0xEC, 0x07, 0x0E, 0xB4, 0x33},
+		-1},
+	{"CAVP SHA-384 #9",
+		{0x71, 0xDB, 0x1D, 0xE1, 0xA1, 0xF3, 0x8F, 0x35, 0x6C, 0x91, 0xFE, 0xAF, 0xF5, 0xCF, 0xE3, 0x95, 0xD1, 0xA5, 0xB9, 0xD2, 0x3C, 0xF6, 0xAA, 0x19, 0xF3, 0x8A, 0xE0, 0xBC, 0xC9, 0x0A, 0x48, 0x6D, 0xEC, 0xDD, 0x6F, 0xFB, 0x17, 0x4A, 0x50, 0xF1, 0xCC, 0x79, 0x29, 0x85, 0xC2, 0xF9, 0x60, 0x8C, 0x39, 0x9C, 0x98, 0xB8, 0xA6, 0x4A, 0x69, 0xD2, 0xB5, 0xB7, 0xCD, 0xD9, 0x24, 0x1F, 0x67, 0xE2},
+		{0x2D, 0x8C, 0x65, 0x85, 0xA3, 0xB6, 0x31, 0x9A, 0x55, 0x6E, 0x27, 0xB5, 0x3D, 0x43, 0x4F, 0x45, 0x5F, 0x73, 0xE7, 0x71, 0xC8, 0xFC, 0x6A, 0x11, 0x5F, 0x5C, 0x92, 0xA8, 0xE9, 0xA8, 0x1C, 0xE2},
+		{0xB0, 0x44, 0x3B, 0x33, 0xA6, 0xF2, 0x49, 0x47, 0x0D, 0x2F, 0x94, 0x36, 0x75, 0x00, 0x9D, 0x21, 0xB9, 0xCC, 0xBE, 0xAD, 0x15, 0x25, 0xAE, 0x57, 0x81, 0x5D, 0xF8, 0x6B, 0xB2, 0x04, 0x70, 0xBF, 0x31, 0x6D, 0xBE, 0xE2, 0x7D, 0x99, 0x8E, 0x09, 0x12, 0x85, 0x39, 0xC2, 0x69, 0xE2, 0x97, 0xAC, 0x8F, 0x34, 0xB9, 0xEF, 0x82, 0x49, 0xA0, 0x61, 0x91, 0x68, 0xC3, 0x49, 0x5C, 0x5C, 0x11, 0x98},
+		-1},
+	{"CAVP SHA-384 #10",
+		{0x82, 0x19, 0xB2, 0x25, 0xAA, 0x15, 0x47, 0x22, 0x62, 0xC6, 0x48, 0xCA, 0xC8, 0xDE, 0x9A, 0xAD, 0x41, 0x73, 0xD1, 0x7A, 0x23, 0x1B, 0xA2, 0x43, 0x52, 0xA5, 0xA1, 0xC4, 0xEE, 0xA7, 0x0F, 0xAD, 0x0F, 0xEE, 0x2B, 0x08, 0xAD, 0x39, 0xFB, 0xF0, 0xDB, 0x00, 0x16, 0xEF, 0x28, 0x96, 0xCA, 0x99, 0xAD, 0xC0, 0x7E, 0xFC, 0x8C, 0x41, 0x5F, 0x64, 0x0F, 0x37, 0x20, 0x49, 0x8B, 0xE2, 0x60, 0x37},
+		{0xA4, 0xCC, 0x3B, 0x23, 0xF5, 0x4D, 0x9D, 0x48, 0xBA, 0x6B, 0x0A, 0xD3, 0xDA, 0x3B, 0x2E, 0x3A, 0x08, 0x06, 0xF4, 0x13, 0x48, 0xBD, 0x78, 0x44, 0xE9, 0xC9, 0xB8, 0x64, 0x87, 0x53, 0xBD, 0xEE},
+		{0x13, 0x4F, 0xB6, 0x89, 0x10, 0x1A, 0xAA, 0xD3, 0x95, 0x4D, 0xE2, 0x81, 0x9D, 0x9F, 0xBD, 0x12, 0x07, 0x2F, 0xE2, 0xBC, 0x36, 0xF4, 0x96, 0xBB, 0xF0, 0xD1, 0x3F, 0xA7, 0x21, 0x14, 0xAB, 0x96, 0xE6, 0x5C, 0x23, 0x2B, 0xD9, 0x15, 0xB5, 0x9E, 0x08, 0x7E, 0x7F, 0xD5, 0xEC, 0x90, 0xBF, 0x63, 0x6C, 0xFA, 0x80, 0x52, 0x63, 0x45, 0xC7, 0x9A, 0x0A, 0xDF, 0xD7, 0x50, 0x03, 0x04, 0x5D, 0x6F},
+		-1},
+	{"CAVP SHA-384 #11",
+		{0xC9, 0x34, 0x19, 0x5D, 0xE3, 0x3B, 0x60, 0xCF, 0x00, 0x46, 0x1F, 0xC3, 0xC4, 0x5D, 0xAD, 0x06, 0x8E, 0x9F, 0x5F, 0x7A, 0xF5, 0xC7, 0xFA, 0x78, 0x59, 0x1E, 0x95, 0xAE, 0xB0, 0x4E, 0x26, 0x17, 0xB5, 0x88, 0xDD, 0x5F, 0x99, 0x65, 0xFD, 0xAA, 0x52, 0x3B, 0x47, 0x5C, 0x28, 0x12, 0xC2, 0x51, 0xBC, 0x69, 0x73, 0xE2, 0xDF, 0x21, 0xD9, 0xBE, 0xAA, 0xCE, 0x97, 0x6A, 0xBF, 0x57, 0x28, 0xCB},
+		{0xB9, 0x62, 0xB6, 0x3A, 0x77, 0x43, 0xAD, 0x77, 0xF9, 0x07, 0x2F, 0x2F, 0x08, 0xD2, 0x77, 0xF6, 0xDD, 0xA8, 0xCC, 0x34, 0x20, 0xDD, 0xD3, 0x7D, 0x87, 0x37, 0x46, 0x00, 0x88, 0x95, 0x90, 0x2B},
+		{0x71, 0xF3, 0x02, 0x44, 0x0E, 0xB4, 0xED, 0x2A, 0x93, 0x9B, 0x69, 0xE3, 0x3E, 0x90, 0x5E, 0x6F, 0xDC, 0x54, 0x5C, 0x74, 0x34, 0x58, 0xD3, 0x8F, 0x7E, 0x1A, 0x1D, 0x45, 0x6E, 0x35, 0xF3, 0x89, 0x54, 0xEA, 0xA0, 0xEB, 0x9C, 0xD7, 0x50, 0x3B, 0x19, 0xA9, 0x65, 0x8F, 0x0A, 0x04, 0x95, 0x5D, 0x9F, 0x0A, 0xB2, 0x0E, 0xBC, 0x8A, 0x08, 0x77, 0xE3, 0x3C, 0x89, 0xEE, 0x88, 0xAD, 0x06, 0x8F},
+		-1},
+	{"CAVP SHA-384 #12",
+		{0x9E, 0x1A, 0xDC, 0xD4, 0x8E, 0x2E, 0x3F, 0x0E, 0x4C, 0x21, 0x35, 0x01, 0x80, 0x82, 0x28, 0xE5, 0x87, 0xC4, 0x05, 0x58, 0xF5, 0x2B, 0xB5, 0x4D, 0xDB, 0xB6, 0x10, 0x2D, 0x40, 0x48, 0xEA, 0x92, 0x34, 0xEF, 0xF9, 0x87, 0x04, 0x79, 0x09, 0x38, 0xE7, 0xE0, 0xBD, 0xF8, 0x7A, 0xE3, 0x98, 0x07, 0xA6, 0xB7, 0x7D, 0xFD, 0xC9, 0xEC, 0xDF, 0xE6, 0xDD, 0x0F, 0x24, 0x1A, 0xBA, 0xE1, 0xAE, 0xB2},
+		{0x21, 0xB8, 0x83, 0xFA, 0xE1, 0x59, 0x86, 0x77, 0x31, 0xB1, 0x23, 0xA2, 0x60, 0x6E, 0x9B, 0x33, 0x20, 0xFB, 0x53, 0xA0, 0x0E, 0x4A, 0x5D, 0xFE, 0x3B, 0xC3, 0x42, 0x9D, 0xD5, 0x3B, 0x80, 0x68},
+		{0xCE, 0x4F, 0x0D, 0x74, 0x80, 0x52, 0x2C, 0x8D, 0xD1, 0xB0, 0x2D, 0xD0, 0xEB, 0x38, 0x2F, 0x22, 0x40, 0x66, 0x42, 0xF0, 0x38, 0xC1, 0xED, 0xE9, 0x41, 0x18, 0x83, 0xD7, 0x2B, 0x3E, 0x7E, 0xD0, 0x85, 0x46, 0xE1, 0xEE, 0x3B, 0x77, 0xF9, 0x92, 0x7C, 0xDA, 0xCC, 0xBC, 0x2F, 0x1C, 0xF1, 0x9D, 0x6B, 0x55, 0x76, 0xB0, 0xF7, 0x38, 0xBB, 0x1B, 0x86, 0xA0, 0xC6, 0x6B, 0x39, 0xCA, 0x56, 0xFB},
+		-1},
+	{"CAVP SHA-384 #13",
+		{0x93, 0xED, 0xBE, 0xCB, 0x0B, 0x01, 0x9C, 0x2C, 0xC0, 0x30, 0x60, 0xF5, 0x4C, 0xB4, 0x90, 0x4B, 0x92, 0x0F, 0xDB, 0x34, 0xEB, 0x83, 0xBA, 0xDD, 0x75, 0x2B, 0xE9, 0x44, 0x30, 0x36, 0xAE, 0x13, 0xB4, 0x94, 0xE9, 0x29, 0x5E, 0x08, 0x0A, 0x90, 0x80, 0xFE, 0x7E, 0x73, 0x24, 0x9B, 0x3A, 0x59, 0x04, 0xAA, 0x84, 0xE1, 0xC0, 0x28, 0x12, 0x1E, 0xEC, 0xD3, 0xE2, 0xCF, 0x1A, 0x55, 0xF5, 0x98},
+		{0xFC, 0xC1, 0x7B, 0x88, 0x07, 0x75, 0x70, 0xC0, 0x53, 0x65, 0x0E, 0x1D, 0xE4, 0x2A, 0xE6, 0xBB, 0x15, 0x22, 0x90, 0x0B, 0x38, 0x99, 0x6D, 0xEC, 0xC8, 0x77, 0x04, 0xAA, 0xB6, 0xA8, 0x7A, 0xB0},
+		{0xEE, 0xC2, 0x98, 0x6D, 0x47, 0xB7, 0x19, 0x95, 0x89, 0x2B, 0x09, 0x15, 0xD3, 0xD5, 0xBE, 0xCC, 0x4D, 0xCB, 0x2A, 0xB5, 0x52, 0x06, 0xD7, 0x72, 0xE0, 0x18, 0x95, 0x41, 0xB2, 0x18, 0x4D, 0xDF, 0x8A, 0x6C, 0x1E, 0xDE, 0xB6, 0x45, 0x26, 0x27, 0xAD, 0x27, 0xC8, 0x31, 0x95, 0x99, 0xC5, 0x4A, 0xC4, 0x4C, 0xDD, 0x83, 0x1E, 0xA6, 0x6F, 0x13, 0xF4, 0x9D, 0x90, 0xAF, 0xFE, 0x6A, 0xD4, 0x5B},
+		0},
+	{"CAVP SHA-384 #14",
+		{0x32, 0x05, 0xBA, 0xE8, 0x76, 0xF9, 0xBD, 0x50, 0xB0, 0x71, 0x39, 0x59, 0xE7, 0x24, 0x57, 0x16, 0x5E, 0x82, 0x6C, 0xBB, 0xE3, 0x89, 0x5D, 0x67, 0x32, 0x09, 0x09, 0xDA, 0xA4, 0x8B, 0x0E, 0xBC, 0xD1, 0x59, 0x25, 0x62, 0x27, 0x3E, 0x5E, 0x0F, 0x57, 0xBB, 0xFB, 0x92, 0xCE, 0xDD, 0x9A, 0xF7, 0xF1, 0x33, 0x25, 0x56, 0x84, 0xEE, 0x05, 0x0A, 0xF9, 0xB6, 0xF0, 0x20, 0x19, 0xBB, 0xCA, 0xFA},
+		{0x29, 0x9A, 0x60, 0x70, 0xD3, 0x2A, 0x55, 0x57, 0x01, 0x07, 0x53, 0xD7, 0x55, 0x9D, 0xBD, 0x8D, 0x2B, 0xDE, 0x8A, 0x8F, 0xEA, 0xE5, 0x41, 0x76, 0x16, 0xCE, 0xB5, 0xB1, 0x67, 0x99, 0x7F, 0xD2},
+		{0x01, 0x24, 0xF3, 0xF1, 0xC6, 0x1E, 0xC4, 0x58, 0x56, 0x1A, 0x4E, 0xAA, 0x6C, 0x15, 0x5B, 0xD2, 0x9E, 0x59, 0x70, 0x3D, 0x14, 0x55, 0x63, 0x24, 0x92, 0x46, 0x83, 0xDB, 0x3A, 0x4C, 0xF4, 0x3B, 0x68, 0x8A, 0x5C, 0x5F, 0xC0, 0xC7, 0xBA, 0x92, 0x21, 0x0C, 0x50, 0xCC, 0xE5, 0xB5, 0x12, 0xA4, 0x68, 0xA8, 0x80, 0xE0, 0x5A, 0xCC, 0x21, 0xCA, 0x56, 0x57, 0x1D, 0x89, 0xF4, 0x5F, 0x60, 0x3A},
+		-1},
+	{"CAVP SHA-512 #0",
+		{0x48, 0x4E, 0x31, 0xE6, 0x9E, 0xF7, 0x0B, 0xB8, 0x52, 0x78, 0x53, 0xC2, 0x2C, 0x6B, 0x6B, 0x4C, 0xD2, 0xA5, 0x13, 0x11, 0xDD, 0xE6, 0x6C, 0x7B, 0x63, 0xF0, 0x97, 0xDB, 0xB6, 0xAB, 0x27, 0xBF, 0xE1, 0xFF, 0x81, 0x77, 0xF4, 0x06, 0x1D, 0x4F, 0xBB, 0xAC, 0xBB, 0xC7, 0x05, 0x19, 0xF0, 0xFC, 0x8C, 0x8B, 0x60, 0x53, 0xD7, 0x2A, 0xF0, 0xFE, 0x4F, 0x04, 0x8D, 0x61, 0x50, 0x04, 0xF7, 0x4E},
+		{0xF1, 0xE9, 0xCD, 0xA2, 0xE0, 0x96, 0xEC, 0xE9, 0xA1, 0xFC, 0x57, 0xE5, 0x5E, 0xEE, 0xB5, 0x6B, 0x1C, 0x63, 0x53, 0x80, 0xC0, 0xF9, 0xA1, 0x80, 0x0A, 0x4A, 0x1A, 0x5F, 0x10, 0x5D, 0x1F, 0xC0},
+		{0x91, 0xA3, 0x03, 0xD8, 0xFE, 0x3A, 0xB4, 0x17, 0x60, 0x70, 0xF6, 0x40, 0x62, 0x67, 0xF6, 0xB7, 0x9B, 0xFE, 0x5E, 0xB5, 0xF6, 0x2A, 0xE6, 0xAE, 0xB3, 0x74, 0xD9, 0x06, 0x67, 0x85, 0x85, 0x18, 0xE1, 0x52, 0x11, 0x9C, 0xEF, 0xA2, 0x68, 0x26, 0xEA, 0x07, 0xEC, 0x40, 0xA4, 0x28, 0x86, 0x91, 0x32, 0xD7, 0x08, 0x12, 0xC5, 0x57, 0x8C, 0x5A, 0x26, 0x0E, 0x48, 0xD6, 0x80, 0x0E, 0x04, 0x6A},
+		-1},
+	{"CAVP SHA-512 #1",
+		{0x8B, 0x75, 0xFC, 0x01, 0x29, 0xC9, 0xA7, 0x8F, 0x83, 0x95, 0xC6, 0x3A, 0xE9, 0x69, 0x4B, 0x05, 0xCD, 0x69, 0x50, 0x66, 0x5C, 0xF5, 0xDA, 0x7D, 0x66, 0x11, 0x8D, 0xE4, 0x51, 0x42, 0x26, 0x24, 0xB3, 0x94, 0x17, 0x19, 0x81, 0xD4, 0x89, 0x6D, 0x6E, 0x1B, 0x4E, 0xF2, 0x33, 0x6D, 0x9B, 0xEF, 0xE7, 0xD2, 0x7E, 0x1E, 0xB8, 0x7F, 0x1C, 0x14, 0xB8, 0xDD, 0xDA, 0x62, 0x2A, 0xF3, 0x79, 0xDC},
+		{0x05, 0x27, 0x19, 0x9F, 0xAD, 0xEA, 0x30, 0xF9, 0xE5, 0xE6, 0x61, 0x66, 0xA3, 0xEB, 0xCD, 0xF6, 0xAE, 0xDF, 0x90, 0x69, 0x84, 0x53, 0x5F, 0x48, 0x16, 0x5E, 0x59, 0x1E, 0xFF, 0x36, 0xF1, 0xC0},
+		{0x17, 0xE2, 0x98, 0xE6, 0x7A, 0xD2, 0xAF, 0x76, 0xF6, 0x89, 0x2F, 0xDC, 0xEA, 0xD0, 0x0A, 0x88, 0x25, 0x65, 0x73, 0x86, 0x8F, 0x79, 0xDC, 0x74, 0x43, 0x1B, 0x55, 0x10, 0x30, 0x58, 0xF0, 0xB0, 0x88, 0x13, 0x28, 0xCD, 0x91, 0xE4, 0x3D, 0x30, 0x13, 0x3F, 0x6E, 0x47, 0x1E, 0x0B, 0x9B, 0x04, 0x35, 0x3B, 0x17, 0x89, 0x3F, 0xB7, 0x61, 0x4F, 0xD7, 0x33, 0x3D, 0x81, 0x2A, 0x3D, 0xF6, 0xB4},
+		-1},
+	{"CAVP SHA-512 #2",
+		{0x76, 0xE5, 0x10, 0x86, 0xE0, 0x78, 0xB2, 0xB1, 0x16, 0xFD, 0x1E, 0x9C, 0x6F, 0xA3, 0xD5, 0x3F, 0x67, 0x5A, 0xE4, 0x02, 0x52, 0xFB, 0x9F, 0x0C, 0xC6, 0x28, 0x17, 0xBD, 0x9C, 0xE8, 0x83, 0x1D, 0xCA, 0x7E, 0x60, 0x9A, 0x0B, 0x1D, 0x14, 0xB7, 0xC9, 0x24, 0x9B, 0x53, 0xDA, 0x0B, 0x20, 0x50, 0x45, 0x0E, 0x2A, 0x25, 0xCB, 0x6C, 0x8F, 0x81, 0xC5, 0x31, 0x19, 0x74, 0xA7, 0xEF, 0xB5, 0x76},
+		{0xC9, 0x26, 0xA5, 0x02, 0x6D, 0x8F, 0x83, 0xFF, 0xA2, 0x09, 0x2C, 0xAF, 0x86, 0x3F, 0x2D, 0x8A, 0x88, 0x6A, 0xF3, 0x91, 0x46, 0x29, 0x69, 0xB1, 0x3A, 0x11, 0xD3, 0xC6, 0xC5, 0xFA, 0x66, 0xBB},
+		{0x23, 0xB6, 0x53, 0xFA, 0xAA, 0x7D, 0x45, 0x52, 0x38, 0x87, 0x71, 0x93, 0x18, 0x03, 0xCE, 0x93, 0x9D, 0xD5, 0xEE, 0x62, 0xD3, 0xFA, 0x72, 0xB0, 0x19, 0xBE, 0x1B, 0x22, 0x72, 0xC8, 0x55, 0x92, 0xA0, 0x3C, 0x6F, 0x5C, 0x54, 0xA1, 0x08, 0x61, 0xD6, 0xB8, 0x92, 0x28, 0x21, 0x70, 0x8E, 0x93, 0x06, 0xFD, 0x6D, 0x5D, 0x10, 0xD5, 0x66, 0x84, 0x5A, 0x10, 0x65, 0x39, 0xCB, 0xF4, 0xFA, 0xDD},
+		-1},
+	{"CAVP SHA-512 #3",
+		{0xBC, 0x7C, 0x8E, 0x09, 0xBD, 0x09, 0x34, 0x68, 0xF7, 0x06, 0x74, 0x0A, 0x41, 0x30, 0xC5, 0x44, 0x37, 0x4F, 0xDC, 0x92, 0x4A, 0x53, 0x5E, 0xF0, 0x2E, 0x9D, 0x3B, 0xE6, 0xC6, 0xD3, 0xBB, 0xFA, 0xAF, 0x3F, 0x81, 0x3A, 0xE6, 0x64, 0x6F, 0x5B, 0x6D, 0xBF, 0xB0, 0xF2, 0x61, 0xFD, 0x42, 0x53, 0x77, 0x05, 0xC8, 0x00, 0xBB, 0x16, 0x47, 0x38, 0x63, 0x43, 0x42, 0x8A, 0x9F, 0x2E, 0x10, 0xFC},
+		{0x4D, 0x74, 0x63, 0x1E, 0xB6, 0x7F, 0xD1, 0xA6, 0xFA, 0x93, 0xEC, 0xB6, 0xE6, 0x11, 0x2B, 0x66, 0x99, 0xE7, 0x8C, 0x1D, 0x4C, 0x24, 0xAE, 0x81, 0xD0, 0xD5, 0x84, 0x2E, 0xFE, 0x5D, 0x93, 0xC2},
+		{0x6B, 0xD7, 0xCE, 0x95, 0xAF, 0x25, 0xAB, 0xFB, 0xF1, 0x4A, 0xEF, 0x4B, 0x17, 0x39, 0x2F, 0x1D, 0xA8, 0x77, 0xAB, 0x56, 0x2E, 0xCA, 0x38, 0xD7, 0x85, 0xFE, 0x39, 0x68, 0x2E, 0x9C, 0x93, 0x24, 0x66, 0x88, 0xBE, 0xA2, 0x0C, 0x87, 0xBA, 0xB3, 0x4D, 0x42, 0x06, 0x42, 0xDA, 0x9B, 0xDD, 0x4C, 0x69, 0x45, 0x6B, 0xDE, 0xC5, 0x08, 0x35, 0x88, 0x73, 0x67, 0xBB, 0x4F, 0xB7, 0xCD, 0x86, 0x50},
+		-1},
+	{"CAVP SHA-512 #4",
+		{0x9C, 0xB0, 0xCF, 0x69, 0x30, 0x3D, 0xAF, 0xC7, 0x61, 0xD4, 0xE4, 0x68, 0x7B, 0x4E, 0xCF, 0x03, 0x9E, 0x6D, 0x34, 0xAB, 0x96, 0x4A, 0xF8, 0x08, 0x10, 0xD8, 0xD5, 0x58, 0xA4, 0xA8, 0xD6, 0xF7, 0x2D, 0x51, 0x23, 0x3A, 0x17, 0x88, 0x92, 0x0A, 0x86, 0xEE, 0x08, 0xA1, 0x96, 0x2C, 0x79, 0xEF, 0xA3, 0x17, 0xFB, 0x78, 0x79, 0xE2, 0x97, 0xDA, 0xD2, 0x14, 0x6D, 0xB9, 0x95, 0xFA, 0x1C, 0x78},
+		{0x02, 0x50, 0xF9, 0x3E, 0x69, 0x32, 0x88, 0x7D, 0xF5, 0x19, 0x92, 0x1F, 0x9A, 0x8D, 0xCF, 0xF1, 0x10, 0xBE, 0x07, 0x68, 0xDC, 0x35, 0x1E, 0xF7, 0x3A, 0x94, 0x0A, 0x57, 0x9F, 0xAE, 0x2D, 0x20},
+		{0x4B, 0x9F, 0x91, 0xE4, 0x28, 0x52, 0x87, 0x26, 0x1A, 0x1D, 0x1C, 0x92, 0x3C, 0xF6, 0x19, 0xCD, 0x52, 0xC1, 0x75, 0xCF, 0xE7, 0xF1, 0xBE, 0x60, 0xA5, 0x25, 0x8C, 0x61, 0x03, 0x48, 0xBA, 0x3D, 0x28, 0xC4, 0x5F, 0x90, 0x1D, 0x71, 0xC4, 0x1B, 0x29, 0x86, 0x38, 0xEC, 0x0D, 0x6A, 0x85, 0xD7, 0xFC, 0xB0, 0xC3, 0x3B, 0xBF, 0xEC, 0x5A, 0x9C, 0x81, 0x08, 0x46, 0xB6, 0x39, 0x28, 0x9A, 0x84},
+		0},
+	{"CAVP SHA-512 #5",
+		{0xE3, 0x10, 0x96, 0xC2, 0xD5, 0x12, 0xFB, 0xF8, 0x4F, 0x81, 0xE9, 0xBD, 0xB1, 0x6F, 0x33, 0x12, 0x17, 0x02, 0x89, 0x76, 0x05, 0xB4, 0x3A, 0x3D, 0xB5, 0x46, 0xF8, 0xFB, 0x69, 0x5B, 0x5F, 0x6F, 0x6F, 0xBE, 0xC6, 0xA0, 0x4A, 0x8C, 0x59, 0xD6, 0x1C, 0x90, 0x0A, 0x85, 0x1D, 0x8B, 0xF8, 0x52, 0x21, 0x87, 0xD3, 0xEC, 0x26, 0x37, 0xB1, 0x0F, 0xA8, 0xF3, 0x77, 0x68, 0x9E, 0x08, 0x6B, 0xBA},
+		{0xF9, 0x1B, 0x09, 0x10, 0x7D, 0x10, 0x90, 0x4D, 0x39, 0x68, 0xEC, 0x29, 0xF8, 0x5E, 0x45, 0x6A, 0xC4, 0xE8, 0x28, 0xF3, 0x2E, 0x8D, 0xA3, 0xDB, 0x6A, 0x13, 0xF5, 0x56, 0x6B, 0xFA, 0x62, 0x5E},
+		{0x1B, 0x24, 0x4C, 0x21, 0xC0, 0x8C, 0x0C, 0x0A, 0x10, 0x47, 0x7F, 0xB7, 0xA2, 0x13, 0x82, 0xD4, 0x05, 0xB9, 0x5C, 0x75, 0x50, 0x88, 0x29, 0x28, 0x59, 0xCA, 0x0E, 0x71, 0xBA, 0xB6, 0x83, 0x61, 0x85, 0x2F, 0x4C, 0xBF, 0xD3, 0x46, 0xE9, 0x0F, 0x40, 0x4E, 0x1D, 0xD5, 0xC4, 0xB2, 0xC1, 0xDE, 0xBC, 0xA3, 0xEA, 0x1A, 0xBE, 0xFE, 0x84, 0x00, 0x68, 0x5D, 0x70, 0x3A, 0xEA, 0x6C, 0x5C, 0x7F},
+		-1},
+	{"CAVP SHA-512 #6",
+		{0x63, 0x3C, 0x2E, 0xE5, 0x63, 0x0B, 0x62, 0xC9, 0xCE, 0x83, 0x9E, 0xFD, 0x4D, 0x48, 0x5A, 0x6D, 0x35, 0xE8, 0xB9, 0x43, 0x0D, 0x26, 0x4F, 0xFE, 0x50, 0x1D, 0x28, 0xDB, 0xAC, 0xE7, 0x91, 0x23, 0x4B, 0x66, 0x8A, 0x1A, 0x6D, 0x1A, 0x25, 0xB0, 0x89, 0xF7, 0x5C, 0x2B, 0xD8, 0xD8, 0xC6, 0xA9, 0xA1, 0x4F, 0xE7, 0xB7, 0x29, 0xF4, 0x5A, 0x82, 0x56, 0x5D, 0xA2, 0xE8, 0x66, 0xE2, 0xC4, 0x90},
+		{0x57, 0x5C, 0x64, 0xDF, 0x58, 0xC8, 0xDC, 0x51, 0x7C, 0xE6, 0x5B, 0x38, 0x8F, 0xA3, 0xED, 0x69, 0x47, 0x01, 0x63, 0xAF, 0xEC, 0xBA, 0xBC, 0x3F, 0xA9, 0x4B, 0x49, 0x7F, 0xF7, 0xF3, 0xFE, 0x36},
+		{0xBF, 0x21, 0x11, 0xC9, 0x3E, 0xC0, 0x55, 0xA7, 0xED, 0xA9, 0x0C, 0x10, 0x6F, 0xCE, 0x49, 0x4F, 0xD8, 0x66, 0x04, 0x56, 0x34, 0xFD, 0x2A, 0xA2, 0x8D, 0x6E, 0x01, 0x8F, 0x91, 0x06, 0x99, 0x4E, 0x86, 0xB0, 0x34, 0x12, 0x08, 0xA0, 0xAA, 0x55, 0xED, 0xEC, 0xFD, 0x27, 0x2F, 0x49, 0xCB, 0x34, 0x40, 0x8C, 0xE5, 0x4B, 0x7F, 0xEB, 0xC1, 0xD0, 0xA1, 0xC2, 0xCE, 0x77, 0xAB, 0x69, 0x88, 0xF8},
+		-1},
+	{"CAVP SHA-512 #7",
+		{0xF7, 0x8D, 0xCE, 0x40, 0xD1, 0xCB, 0x8C, 0x4A, 0xF2, 0x74, 0x9B, 0xF2, 0x2C, 0x6F, 0x8A, 0x9A, 0x47, 0x0B, 0x1E, 0x41, 0x11, 0x27, 0x96, 0x21, 0x5D, 0xD0, 0x17, 0xE5, 0x7D, 0xF1, 0xB3, 0x8A, 0x61, 0xB2, 0x9B, 0x0B, 0xC0, 0x3D, 0xFF, 0x7F, 0xA0, 0x06, 0x13, 0xB4, 0xDE, 0x1E, 0x23, 0x17, 0xCF, 0xBF, 0x2B, 0xAD, 0xD5, 0x0D, 0xEE, 0x33, 0x76, 0xC0, 0x32, 0xA8, 0x87, 0xC5, 0xB8, 0x65},
+		{0x4C, 0x09, 0x7F, 0x2F, 0x5B, 0x24, 0x89, 0xC9, 0x42, 0x58, 0xB3, 0x4D, 0x52, 0x96, 0x75, 0xBB, 0x5D, 0x77, 0xD4, 0xBE, 0x08, 0x3B, 0x51, 0xB0, 0x11, 0x88, 0xDD, 0x42, 0xB4, 0xB5, 0x47, 0x39},
+		{0x4A, 0x96, 0x16, 0x9A, 0x5D, 0xEA, 0x36, 0xA2, 0x59, 0x40, 0x11, 0x53, 0x7E, 0xE0, 0xDC, 0x19, 0xE8, 0xF9, 0xF7, 0x4E, 0x82, 0xC0, 0x74, 0x34, 0x07, 0x94, 0x47, 0x15, 0x5A, 0x83, 0x01, 0x52, 0xA2, 0x04, 0xEA, 0xA4, 0xE9, 0x7D, 0x75, 0x53, 0xA1, 0x52, 0x1D, 0x9F, 0x6B, 0xAA, 0xDC, 0x0B, 0x6D, 0x61, 0x83, 0xBA, 0x0F, 0x38, 0x5D, 0x85, 0x93, 0xD6, 0xCA, 0x83, 0x60, 0x7C, 0x4D, 0x82},
+		-1},
+	{"CAVP SHA-512 #8",
+		{0x3F, 0xCC, 0x3B, 0x3E, 0x1B, 0x10, 0x3F, 0xE4, 0x35, 0xAC, 0x21, 0x4C, 0x75, 0x6B, 0xDA, 0xAD, 0x30, 0x93, 0x89, 0xE1, 0xC8, 0x03, 0xE6, 0xD8, 0x4B, 0xBB, 0xC2, 0x70, 0x39, 0xFC, 0xF9, 0x00, 0x7F, 0x09, 0xED, 0xD1, 0xEC, 0x87, 0xA6, 0xD3, 0x6D, 0xC8, 0x1C, 0x15, 0x28, 0xD5, 0x2A, 0x62, 0x77, 0x6E, 0x66, 0x6C, 0x27, 0x44, 0x15, 0xA9, 0xF4, 0x41, 0xD6, 0xA8, 0xDF, 0x6B, 0x92, 0x37},
+		{0x1A, 0x3D, 0xD2, 0x1C, 0xB6, 0xAC, 0x1F, 0xA7, 0xFC, 0x19, 0x63, 0x19, 0xCF, 0x53, 0x4B, 0x76, 0x08, 0xAF, 0xB9, 0x38, 0x05, 0x42, 0x0F, 0xCB, 0x52, 0x50, 0xDF, 0xF4, 0x53, 0x56, 0x4A, 0x5B},
+		{0x1C, 0xAC, 0x13, 0xF2, 0x77, 0x35, 0x44, 0x56, 0xAE, 0x67, 0xAB, 0x09, 0xB0, 0x9E, 0x07, 0xEB, 0x1A, 0xF2, 0xA2, 0xBF, 0x45, 0x10, 0x8D, 0xA7, 0x0F, 0x5C, 0x8C, 0x6A, 0x4C, 0xBC, 0xD5, 0x38, 0x5D, 0x83, 0x75, 0x2E, 0x54, 0x05, 0x25, 0x60, 0x2B, 0xA7, 0xE6, 0xFE, 0xE4, 0xD4, 0x26, 0x3F, 0x3E, 0xDA, 0x59, 0xE6, 0x7D, 0xF2, 0x0A, 0xAC, 0x79, 0xCA, 0x67, 0xE8, 0x89, 0x9F, 0xED, 0x0D},
+		-1},
+	{"CAVP SHA-512 #9",
+		{0x5E, 0xC7, 0x02, 0xD4, 0x3A, 0x67, 0xAD, 0xA8, 0x6E, 0xFB, 0xFC, 0x13, 0x6C, 0xF1, 0x6D, 0x96, 0x07, 0x89, 0x06, 0x95, 0x4A, 0x3F, 0x1F, 0x9E, 0x44, 0x06, 0x74, 0xCD, 0x90, 0x7E, 0x46, 0x76, 0x05, 0xA6, 0x20, 0x44, 0xFE, 0xD8, 0x47, 0x0D, 0xD4, 0xFC, 0xA3, 0x8D, 0x89, 0xD5, 0x83, 0xCE, 0x36, 0xD5, 0x0D, 0x28, 0xB6, 0x6A, 0xB0, 0xB5, 0x19, 0x22, 0xB2, 0x1D, 0xA9, 0x2C, 0x56, 0xD9},
+		{0xC5, 0xC0, 0x16, 0xF6, 0xC9, 0xB5, 0x25, 0x98, 0x7D, 0xD8, 0x35, 0x13, 0x1D, 0xEF, 0x77, 0xCC, 0x72, 0xD8, 0x36, 0x0D, 0x36, 0x4E, 0xEC, 0xCD, 0xD7, 0xAF, 0x8B, 0x95, 0x71, 0x2B, 0x6C, 0xD4},
+		{0x75, 0xF3, 0x03, 0x72, 0x98, 0xF1, 0x45, 0x7D, 0xBA, 0x55, 0x74, 0x39, 0x99, 0x97, 0x6A, 0x1C, 0x26, 0x36, 0xB2, 0xB8, 0xAB, 0x2E, 0xD3, 0xDF, 0x47, 0x36, 0xA6, 0xD2, 0x93, 0x4A, 0xCC, 0x83, 0x19, 0xD4, 0x3A, 0xD1, 0x68, 0xDD, 0xA1, 0xBB, 0x8A, 0xC4, 0x23, 0xF8, 0xF0, 0x88, 0x76, 0x51, 0x52, 0x34, 0xB3, 0xD8, 0x41, 0xE5, 0x7F, 0xAE, 0xF1, 0xB5, 0xAB, 0x27, 0x35, 0x9B, 0x27, 0xEF},
+		-1},
+	{"CAVP SHA-512 #10",
+		{0xF6, 0x3A, 0xFE, 0x99, 0xE1, 0xB5, 0xFC, 0x65, 0x27, 0x82, 0xF8, 0x6B, 0x59, 0x92, 0x6A, 0xF2, 0x2E, 0x60, 0x72, 0xBE, 0x93, 0x39, 0x0F, 0xE4, 0x1F, 0x54, 0x12, 0x04, 0xF9, 0xC9, 0x35, 0xD1, 0xF6, 0xE1, 0x9C, 0xE5, 0x93, 0x5E, 0x33, 0x61, 0x83, 0xC2, 0x1B, 0xEC, 0xF6, 0x65, 0x96, 0xB8, 0xF5, 0x59, 0xD2, 0xD0, 0x2E, 0xE2, 0x82, 0xAA, 0x87, 0xA7, 0xD6, 0xF9, 0x36, 0xF7, 0x26, 0x0C},
+		{0x9E, 0xB2, 0xF9, 0xFA, 0x96, 0xA1, 0xF3, 0xFF, 0xCE, 0xF9, 0x60, 0x05, 0x22, 0x73, 0x0E, 0x86, 0xD2, 0x6D, 0x32, 0x8E, 0xC0, 0xC1, 0xBF, 0x2F, 0xBF, 0xE5, 0x5A, 0x38, 0x75, 0x46, 0x10, 0x34},
+		{0xCE, 0xF4, 0x83, 0x1E, 0x45, 0x15, 0xC7, 0x7C, 0xA0, 0x62, 0x28, 0x26, 0x14, 0xB5, 0x4A, 0x11, 0xB7, 0xDC, 0x40, 0x57, 0xE6, 0x99, 0x76, 0x85, 0xC2, 0xFB, 0xFA, 0x95, 0xB3, 0x92, 0xBF, 0x72, 0xF2, 0x0D, 0xC0, 0x1B, 0xF3, 0x8E, 0x13, 0x44, 0xBA, 0x67, 0x5A, 0x22, 0x23, 0x9D, 0x98, 0x93, 0xB3, 0xA3, 0xE3, 0x3D, 0x9A, 0x40, 0x33, 0x29, 0xA3, 0xD2, 0x16, 0x50, 0xE9, 0x12, 0x5B, 0x75},
+		0},
+	{"CAVP SHA-512 #11",
+		{0x6D, 0x11, 0xB0, 0x9D, 0x27, 0x67, 0xCF, 0x8D, 0x27, 0x5F, 0xAE, 0xE7, 0x46, 0xC2, 0x03, 0x48, 0x62, 0x59, 0xF6, 0x6D, 0xD2, 0xBF, 0xA3, 0xA6, 0x5C, 0x39, 0x37, 0x1A, 0x66, 0xB2, 0x33, 0x85, 0x4E, 0xB0, 0x5C, 0x73, 0xE0, 0x52, 0x61, 0xE9, 0x79, 0x18, 0x28, 0x33, 0xF2, 0x03, 0x11, 0xE5, 0x36, 0x6F, 0x72, 0xF4, 0xB9, 0x49, 0x66, 0x5F, 0xF2, 0x94, 0xF9, 0x59, 0x37, 0x55, 0x34, 0xC6},
+		{0x0E, 0x71, 0xB2, 0x8B, 0x0A, 0x1E, 0xAC, 0x7A, 0xA8, 0x81, 0xC0, 0x9D, 0xAE, 0xC6, 0x16, 0xC9, 0x3D, 0x9A, 0x92, 0x86, 0xB5, 0xF5, 0xFD, 0xF2, 0x64, 0x2D, 0x21, 0x10, 0x21, 0xB1, 0x25, 0xFA},
+		{0x15, 0xA6, 0x97, 0xCD, 0xB6, 0x14, 0xE1, 0x1C, 0x08, 0x10, 0xE1, 0xE7, 0x64, 0xCD, 0x50, 0x1F, 0xCA, 0xBC, 0x70, 0x87, 0x4C, 0x95, 0x75, 0x87, 0xBC, 0x48, 0x83, 0xD9, 0x43, 0x8E, 0x17, 0x7F, 0x7B, 0xF6, 0x24, 0x4F, 0x92, 0xBC, 0x76, 0x80, 0x63, 0xCE, 0xCB, 0x53, 0x36, 0xC8, 0xEA, 0xAC, 0xD2, 0x3D, 0xB9, 0x30, 0xB2, 0x87, 0x03, 0x56, 0x0F, 0x24, 0x1C, 0x7D, 0x93, 0x95, 0x0D, 0xFD},
+		-1},
+	{"CAVP SHA-512 #12",
+		{0xF3, 0x89, 0x9C, 0xAB, 0xA0, 0x38, 0xEF, 0xB5, 0x34, 0xC4, 0xCE, 0xA0, 0xBD, 0x27, 0x68, 0x14, 0xFF, 0xD8, 0x01, 0x94, 0x47, 0x3C, 0x90, 0x3B, 0x81, 0xAF, 0x11, 0xC8, 0xC0, 0x5C, 0xB6, 0xE6, 0x6E, 0xA6, 0xB1, 0x74, 0x02, 0xFC, 0xF2, 0xE8, 0xE7, 0x37, 0xD1, 0x1F, 0xFC, 0x7C, 0x2E, 0xD3, 0xB2, 0xD0, 0xBC, 0x3B, 0x8F, 0x27, 0x1A, 0x38, 0x1F, 0x42, 0x94, 0xCF, 0xF6, 0x26, 0x82, 0xC3},
+		{0x10, 0x4A, 0xCE, 0x16, 0x68, 0x9D, 0x78, 0x5D, 0xF0, 0x9A, 0x81, 0xC5, 0xCF, 0x47, 0xA4, 0x96, 0xDB, 0x30, 0xFB, 0xD6, 0x96, 0xAA, 0x4D, 0xF0, 0x80, 0x21, 0x94, 0x87, 0x57, 0x5A, 0x23, 0x64},
+		{0x57, 0xB9, 0x93, 0x80, 0x45, 0x2E, 0x1D, 0x37, 0xB1, 0x33, 0xC4, 0x9B, 0x9B, 0xA4, 0x93, 0xDE, 0xE8, 0x63, 0x09, 0x40, 0x47, 0x7C, 0xA3, 0x35, 0x1A, 0x43, 0xD9, 0x0B, 0x99, 0x87, 0x1E, 0x6A, 0xDF, 0x59, 0x9C, 0x3A, 0x37, 0x10, 0x5A, 0xF3, 0xEC, 0xC1, 0x59, 0xB3, 0xB6, 0x85, 0xCC, 0xB3, 0xE1, 0x51, 0xB7, 0xD5, 0xCF, 0x2D, 0x97, 0x14, 0x79, 0x74, 0xAE, 0x71, 0xF4, 0x66, 0xB6, 0x15},
+		-1},
+	{"CAVP SHA-512 #13",
+		{0x1F, 0xD6, 0xF4, 0xB9, 0x8D, 0x07, 0x55, 0x29, 0x1E, 0x7A, 0x23, 0x0E, 0x9F, 0x81, 0xEC, 0xF9, 0x09, 0xE6, 0x35, 0x0A, 0xAD, 0xB0, 0x8E, 0x42, 0xA3, 0x26, 0x2F, 0xF1, 0x92, 0x00, 0xFB, 0xD2, 0x55, 0x78, 0xFE, 0xF7, 0x9B, 0xC4, 0x77, 0xAC, 0xFB, 0x8E, 0xD0, 0xDC, 0x10, 0xC4, 0xF5, 0x80, 0x9C, 0x14, 0xDC, 0x54, 0x92, 0x40, 0x5B, 0x37, 0x92, 0xA7, 0x94, 0x06, 0x50, 0xB3, 0x05, 0xD7},
+		{0x76, 0x1A, 0x54, 0xF3, 0x71, 0x89, 0x85, 0xB6, 0xD7, 0xBC, 0xFD, 0xD5, 0x7D, 0x6C, 0x48, 0x23, 0xF8, 0x54, 0x83, 0x1B, 0xD2, 0x93, 0x05, 0xFC, 0xB0, 0x7E, 0x34, 0xE3, 0xF8, 0x25, 0xD4, 0x51},
+		{0x97, 0xA9, 0x9E, 0x96, 0xE4, 0x07, 0xB3, 0xAD, 0xA2, 0xC2, 0xDC, 0xF9, 0xCE, 0xEE, 0xB9, 0x84, 0xD9, 0xA4, 0xD0, 0xAA, 0x66, 0xDD, 0xF0, 0xA7, 0x4C, 0xA2, 0x3C, 0xAB, 0xFB, 0x15, 0x66, 0xCC, 0x0E, 0xCA, 0xC3, 0x15, 0xDC, 0x19, 0x9C, 0xFE, 0xA3, 0xC1, 0x53, 0x48, 0xC1, 0x30, 0x92, 0x4A, 0x1F, 0x78, 0x70, 0x19, 0xFE, 0x4C, 0xD3, 0xAE, 0x47, 0xCA, 0x8B, 0x11, 0x12, 0x68, 0x75, 0x4A},
+		-1},
+	{"CAVP SHA-512 #14",
+		{0x2D, 0xCB, 0xD8, 0x79, 0x0C, 0xEE, 0x55, 0x2E, 0x9F, 0x18, 0xF2, 0xB3, 0x14, 0x9A, 0x22, 0x52, 0xDC, 0xD5, 0x8B, 0x99, 0xCA, 0x7D, 0xC9, 0x68, 0x0B, 0x92, 0xC8, 0xC4, 0x3A, 0xA3, 0x38, 0x74, 0x5D, 0xBC, 0x8B, 0xB8, 0x81, 0x3C, 0x8E, 0x01, 0x9D, 0x80, 0xE1, 0x9A, 0xCD, 0xB0, 0x79, 0x2F, 0x53, 0x79, 0x80, 0xFE, 0xCD, 0xE9, 0x3D, 0xB6, 0x21, 0xAA, 0xF1, 0xF6, 0xD0, 0xE6, 0xEE, 0x34},
+		{0x45, 0xB0, 0x82, 0xE8, 0x04, 0x44, 0x3B, 0x53, 0xA8, 0x22, 0x29, 0xCD, 0xF1, 0x3E, 0x4C, 0x5F, 0x8F, 0x31, 0xFE, 0x93, 0x17, 0x0C, 0xC8, 0xA2, 0x3F, 0x63, 0xEE, 0xF5, 0x06, 0xCB, 0x77, 0x48},
+		{0x2B, 0xDB, 0xD8, 0xB0, 0xD7, 0x59, 0x59, 0x56, 0x62, 0xCC, 0x10, 0xB1, 0x02, 0x36, 0x13, 0x6E, 0xF6, 0xCE, 0x42, 0x96, 0x41, 0xF6, 0x8C, 0xF6, 0x48, 0x0F, 0x47, 0x2F, 0xCC, 0x77, 0xBC, 0x9F, 0x7E, 0x7D, 0xF0, 0xC8, 0xB8, 0x6F, 0x7D, 0xB0, 0x6C, 0xAF, 0x16, 0x10, 0x16, 0x6F, 0x7B, 0x9C, 0x4C, 0x75, 0x44, 0x7F, 0x99, 0x1D, 0x5A, 0xAF, 0x4D, 0xEA, 0x72, 0x0C, 0x25, 0x98, 0x5C, 0x8C},
+		0},
+	{"edge: reference signature",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		0},
+	{"edge: r = 0",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: s = 0",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+		-1},
+	{"edge: r = s = 0",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+		-1},
+	{"edge: r = n",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: s = n",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51},
+		-1},
+	{"edge: r = 2^256 - 1",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: s = 2^256 - 1",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		-1},
+	{"edge: high s (n - s)",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x89, 0x55, 0xE4, 0x80, 0x9B, 0x32, 0xFE, 0x5E, 0xDE, 0xF3, 0xC8, 0x29, 0xF8, 0x09, 0x93, 0xFB, 0x57, 0x5B, 0x17, 0x56, 0xE8, 0xAE, 0x19, 0xBE, 0x8F, 0xB6, 0xAC, 0x2E, 0x5C, 0x00, 0x0C, 0xD5},
+		0},
+	{"edge: small s",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x4E, 0xE7, 0xFE, 0xAF, 0x28, 0x76, 0x40, 0x7C, 0x1F, 0x2A, 0x9B, 0xF9, 0xE7, 0xE8, 0x72, 0x78, 0xE2, 0xFC, 0xBF, 0xDD, 0x08, 0x12, 0x6D, 0xD0, 0xC3, 0x8E, 0x07, 0x34, 0x12, 0xDE, 0x00, 0xF0},
+		{0x2A, 0xC7, 0x69, 0xAF, 0x43, 0xD8, 0x42, 0xD7, 0x4B, 0x67, 0x52, 0x04, 0x65, 0x61, 0xBA, 0x61, 0x05, 0x33, 0x58, 0x3A, 0x05, 0x14, 0x86, 0x2E, 0xE3, 0xD0, 0xB7, 0x04, 0x51, 0xC5, 0x41, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x45, 0x67},
+		0},
+	{"edge: small s + n",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x4E, 0xE7, 0xFE, 0xAF, 0x28, 0x76, 0x40, 0x7C, 0x1F, 0x2A, 0x9B, 0xF9, 0xE7, 0xE8, 0x72, 0x78, 0xE2, 0xFC, 0xBF, 0xDD, 0x08, 0x12, 0x6D, 0xD0, 0xC3, 0x8E, 0x07, 0x34, 0x12, 0xDE, 0x00, 0xF0},
+		{0x2A, 0xC7, 0x69, 0xAF, 0x43, 0xD8, 0x42, 0xD7, 0x4B, 0x67, 0x52, 0x04, 0x65, 0x61, 0xBA, 0x61, 0x05, 0x33, 0x58, 0x3A, 0x05, 0x14, 0x86, 0x2E, 0xE3, 0xD0, 0xB7, 0x04, 0x51, 0xC5, 0x41, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFD, 0x86, 0x6A, 0xB8},
+		-1},
+	{"edge: r = n - r",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0x48, 0x99, 0x02, 0xED, 0x29, 0x30, 0xD4, 0x3B, 0x2B, 0x1B, 0x07, 0xBE, 0x70, 0x4E, 0xB7, 0x82, 0x8A, 0x3B, 0xD6, 0xC7, 0x7B, 0xAC, 0xED, 0x20, 0x58, 0x44, 0x05, 0xC6, 0x75, 0x13, 0xCA, 0xE7, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: off-curve key, its own signature",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x45},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+		{0xEA, 0x44, 0xDF, 0xD3, 0x09, 0x53, 0x53, 0x59, 0xEA, 0x85, 0x59, 0x31, 0xE1, 0x2F, 0x8D, 0xFD, 0x53, 0xEE, 0x9A, 0x2F, 0xFE, 0x76, 0x7B, 0x69, 0xB6, 0xEF, 0xFD, 0xEB, 0x96, 0xD3, 0x66, 0xCE, 0xF6, 0x4B, 0x43, 0x6C, 0x3E, 0x2A, 0x4B, 0x9E, 0x57, 0x40, 0x3D, 0xEC, 0x30, 0xC7, 0x4C, 0xAF, 0x5A, 0xFF, 0xF5, 0x0D, 0x71, 0x62, 0x39, 0x48, 0xC6, 0xE0, 0x5F, 0x56, 0x51, 0xBD, 0x14, 0x11},
+		-1},
+	{"edge: public key (0, 0)",
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: public key x = p",
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: public key y = 2^256 - 1",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: small-x key",
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x92, 0x43, 0xB9, 0xAA, 0x58, 0x18, 0x06, 0xFE, 0x91, 0x3B, 0xCE, 0x99, 0x81, 0x7A, 0xDE, 0x11, 0xCA, 0x50, 0x3C, 0x64, 0xD9, 0xA3, 0xC5, 0x33, 0x41, 0x5C, 0x08, 0x32, 0x48, 0xFB, 0xCC},
+		{0x1D, 0xA4, 0x84, 0x9E, 0x5A, 0x2D, 0x90, 0x22, 0x57, 0x7A, 0x33, 0x6C, 0xC9, 0x9D, 0x53, 0x20, 0x5D, 0x0D, 0xB2, 0x55, 0x3A, 0x94, 0xB0, 0xF1, 0x40, 0x48, 0x4A, 0xA9, 0x37, 0xCB, 0x21, 0x7D},
+		{0x06, 0xF2, 0xEC, 0x4B, 0x02, 0xFE, 0xB5, 0x7C, 0xB4, 0x34, 0x02, 0xFE, 0x1A, 0xFC, 0x18, 0x36, 0x40, 0x2F, 0xB0, 0x25, 0xE0, 0xFB, 0xE2, 0xB1, 0x26, 0x03, 0x8D, 0x84, 0x4A, 0xBE, 0x8D, 0xE5, 0x07, 0xD6, 0x4F, 0x3C, 0xB5, 0xAB, 0x48, 0x24, 0x86, 0xBC, 0xE3, 0xFA, 0x51, 0x61, 0x31, 0xE9, 0xD8, 0x30, 0xBB, 0x78, 0x81, 0xA5, 0xF6, 0xC9, 0xF7, 0xD7, 0x29, 0x41, 0x43, 0x4C, 0x07, 0xEC},
+		0},
+	{"edge: small-x key with x + p",
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x45, 0x92, 0x43, 0xB9, 0xAA, 0x58, 0x18, 0x06, 0xFE, 0x91, 0x3B, 0xCE, 0x99, 0x81, 0x7A, 0xDE, 0x11, 0xCA, 0x50, 0x3C, 0x64, 0xD9, 0xA3, 0xC5, 0x33, 0x41, 0x5C, 0x08, 0x32, 0x48, 0xFB, 0xCC},
+		{0x1D, 0xA4, 0x84, 0x9E, 0x5A, 0x2D, 0x90, 0x22, 0x57, 0x7A, 0x33, 0x6C, 0xC9, 0x9D, 0x53, 0x20, 0x5D, 0x0D, 0xB2, 0x55, 0x3A, 0x94, 0xB0, 0xF1, 0x40, 0x48, 0x4A, 0xA9, 0x37, 0xCB, 0x21, 0x7D},
+		{0x06, 0xF2, 0xEC, 0x4B, 0x02, 0xFE, 0xB5, 0x7C, 0xB4, 0x34, 0x02, 0xFE, 0x1A, 0xFC, 0x18, 0x36, 0x40, 0x2F, 0xB0, 0x25, 0xE0, 0xFB, 0xE2, 0xB1, 0x26, 0x03, 0x8D, 0x84, 0x4A, 0xBE, 0x8D, 0xE5, 0x07, 0xD6, 0x4F, 0x3C, 0xB5, 0xAB, 0x48, 0x24, 0x86, 0xBC, 0xE3, 0xFA, 0x51, 0x61, 0x31, 0xE9, 0xD8, 0x30, 0xBB, 0x78, 0x81, 0xA5, 0xF6, 0xC9, 0xF7, 0xD7, 0x29, 0x41, 0x43, 0x4C, 0x07, 0xEC},
+		-1},
+	{"edge: small-y key",
+		{0xD7, 0x32, 0x5D, 0x76, 0x46, 0xCD, 0x60, 0xD8, 0x0A, 0x92, 0x73, 0x8C, 0xEB, 0x34, 0x5F, 0x84, 0x4C, 0xFF, 0xAF, 0x35, 0x84, 0x10, 0x22, 0xCA, 0xB1, 0x76, 0xF6, 0x92, 0xDE, 0x8D, 0xE1, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05},
+		{0x2B, 0x66, 0xBB, 0xE4, 0x78, 0xC7, 0xAD, 0xB8, 0xA7, 0x6C, 0x1F, 0x69, 0x76, 0x68, 0x4F, 0x51, 0xA4, 0x7B, 0xBF, 0x6D, 0xD0, 0x7A, 0xD6, 0x37, 0x5E, 0x15, 0xB5, 0xA5, 0x3B, 0x59, 0xEB, 0xA2},
+		{0xDB, 0xC3, 0x81, 0x44, 0x9D, 0xF9, 0xC3, 0x1A, 0xD1, 0x26, 0x9A, 0x55, 0x8E, 0x6B, 0x7B, 0xDC, 0x12, 0x97, 0x79, 0x16, 0xDE, 0x0E, 0xC2, 0xD9, 0xDC, 0x8A, 0x72, 0x87, 0x88, 0xAE, 0x8F, 0x0D, 0x57, 0x41, 0x1D, 0x69, 0xB5, 0x65, 0xD7, 0x67, 0xDF, 0x01, 0x6D, 0x06, 0xC3, 0xA5, 0xF7, 0x08, 0x7A, 0xEA, 0x29, 0x3C, 0xBC, 0x20, 0xC5, 0x54, 0x92, 0x02, 0x0F, 0x68, 0xD0, 0x07, 0x91, 0x35},
+		0},
+	{"edge: small-y key with y + p",
+		{0xD7, 0x32, 0x5D, 0x76, 0x46, 0xCD, 0x60, 0xD8, 0x0A, 0x92, 0x73, 0x8C, 0xEB, 0x34, 0x5F, 0x84, 0x4C, 0xFF, 0xAF, 0x35, 0x84, 0x10, 0x22, 0xCA, 0xB1, 0x76, 0xF6, 0x92, 0xDE, 0x8D, 0xE1, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04},
+		{0x2B, 0x66, 0xBB, 0xE4, 0x78, 0xC7, 0xAD, 0xB8, 0xA7, 0x6C, 0x1F, 0x69, 0x76, 0x68, 0x4F, 0x51, 0xA4, 0x7B, 0xBF, 0x6D, 0xD0, 0x7A, 0xD6, 0x37, 0x5E, 0x15, 0xB5, 0xA5, 0x3B, 0x59, 0xEB, 0xA2},
+		{0xDB, 0xC3, 0x81, 0x44, 0x9D, 0xF9, 0xC3, 0x1A, 0xD1, 0x26, 0x9A, 0x55, 0x8E, 0x6B, 0x7B, 0xDC, 0x12, 0x97, 0x79, 0x16, 0xDE, 0x0E, 0xC2, 0xD9, 0xDC, 0x8A, 0x72, 0x87, 0x88, 0xAE, 0x8F, 0x0D, 0x57, 0x41, 0x1D, 0x69, 0xB5, 0x65, 0xD7, 0x67, 0xDF, 0x01, 0x6D, 0x06, 0xC3, 0xA5, 0xF7, 0x08, 0x7A, 0xEA, 0x29, 0x3C, 0xBC, 0x20, 0xC5, 0x54, 0x92, 0x02, 0x0F, 0x68, 0xD0, 0x07, 0x91, 0x35},
+		-1},
+	{"edge: digest = n",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51},
+		{0xBC, 0x9B, 0x48, 0x07, 0xF7, 0xFF, 0x47, 0x77, 0xCC, 0xBA, 0x06, 0x93, 0x95, 0x94, 0x8F, 0x31, 0xA9, 0xFA, 0xF5, 0x33, 0x0B, 0xCC, 0xAC, 0x19, 0x45, 0x81, 0xE1, 0x25, 0x8C, 0x41, 0x27, 0x53, 0x4E, 0xCA, 0xE1, 0x34, 0xE8, 0xEF, 0x85, 0x4F, 0x53, 0xBE, 0xB8, 0xE7, 0x0A, 0xD3, 0x65, 0xCC, 0xFA, 0x8B, 0xDB, 0x47, 0xA9, 0xF4, 0x33, 0x1C, 0x10, 0x53, 0x7A, 0x4A, 0xD3, 0x0E, 0x02, 0x40},
+		0},
+	{"edge: digest = n + 1",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x52},
+		{0x2D, 0x18, 0x29, 0x84, 0x11, 0x83, 0x1E, 0xA4, 0xB7, 0xEF, 0x1C, 0xEA, 0xE9, 0x98, 0xAB, 0xE1, 0xEC, 0x45, 0x01, 0x7C, 0xA1, 0x1F, 0xA2, 0xDD, 0x1D, 0xE0, 0x26, 0xE0, 0x29, 0x30, 0xB2, 0x83, 0xC9, 0x7C, 0x12, 0x90, 0x1E, 0x84, 0xF8, 0x55, 0x62, 0x03, 0xB9, 0xA9, 0xDE, 0x3A, 0xA3, 0x02, 0x8F, 0x37, 0x5F, 0x8B, 0xAD, 0x28, 0x98, 0x2C, 0xCC, 0xDE, 0x3B, 0x0B, 0xDF, 0x3D, 0x54, 0xC7},
+		0},
+	{"edge: digest = 2^256 - 1",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		{0x4A, 0x50, 0xAB, 0xB0, 0xC0, 0x85, 0xB0, 0x96, 0x0C, 0x66, 0x6E, 0x25, 0x86, 0x1B, 0xBD, 0x7C, 0xF0, 0x87, 0x39, 0x02, 0xBD, 0xE6, 0x23, 0x91, 0x5B, 0xE6, 0x5B, 0x39, 0x55, 0xD2, 0xE1, 0xB8, 0xDF, 0x13, 0x83, 0xB9, 0x7D, 0x77, 0x7D, 0xF5, 0xEA, 0x95, 0x6A, 0x2E, 0xB0, 0xE1, 0x83, 0xB2, 0x52, 0x66, 0x73, 0x78, 0xCF, 0x6F, 0x25, 0x78, 0xF7, 0xA4, 0xBD, 0x2F, 0xE5, 0x4A, 0x79, 0x3D},
+		0},
+	{"edge: digest = 0",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+		{0xBC, 0x9B, 0x48, 0x07, 0xF7, 0xFF, 0x47, 0x77, 0xCC, 0xBA, 0x06, 0x93, 0x95, 0x94, 0x8F, 0x31, 0xA9, 0xFA, 0xF5, 0x33, 0x0B, 0xCC, 0xAC, 0x19, 0x45, 0x81, 0xE1, 0x25, 0x8C, 0x41, 0x27, 0x53, 0x4E, 0xCA, 0xE1, 0x34, 0xE8, 0xEF, 0x85, 0x4F, 0x53, 0xBE, 0xB8, 0xE7, 0x0A, 0xD3, 0x65, 0xCC, 0xFA, 0x8B, 0xDB, 0x47, 0xA9, 0xF4, 0x33, 0x1C, 0x10, 0x53, 0x7A, 0x4A, 0xD3, 0x0E, 0x02, 0x40},
+		0},
+	{"edge: digest = n signed as 0",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51},
+		{0xBC, 0x9B, 0x48, 0x07, 0xF7, 0xFF, 0x47, 0x77, 0xCC, 0xBA, 0x06, 0x93, 0x95, 0x94, 0x8F, 0x31, 0xA9, 0xFA, 0xF5, 0x33, 0x0B, 0xCC, 0xAC, 0x19, 0x45, 0x81, 0xE1, 0x25, 0x8C, 0x41, 0x27, 0x53, 0x4E, 0xCA, 0xE1, 0x34, 0xE8, 0xEF, 0x85, 0x4F, 0x53, 0xBE, 0xB8, 0xE7, 0x0A, 0xD3, 0x65, 0xCC, 0xFA, 0x8B, 0xDB, 0x47, 0xA9, 0xF4, 0x33, 0x1C, 0x10, 0x53, 0x7A, 0x4A, 0xD3, 0x0E, 0x02, 0x40},
+		0},
+	{"edge: u1*G + u2*Q = infinity",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x65, 0xBF, 0xBF, 0xC1, 0xE2, 0xF9, 0x80, 0x98, 0xAC, 0x35, 0x3C, 0xFF, 0xC9, 0xCF, 0x09, 0xEC, 0x06, 0xDA, 0x3A, 0x2A, 0x9A, 0x64, 0x3C, 0x21, 0xCA, 0x27, 0xC7, 0x0D, 0x2E, 0x7A, 0xA7, 0x2D},
+		{0xB7, 0x66, 0xFD, 0x11, 0xD6, 0xCF, 0x2B, 0xC5, 0xD4, 0xE4, 0xF8, 0x41, 0x8F, 0xB1, 0x48, 0x7D, 0x32, 0xAB, 0x23, 0xE6, 0x2B, 0x6A, 0xB1, 0x64, 0x9B, 0x75, 0xC4, 0xFC, 0x87, 0x4F, 0x5A, 0x6A, 0x76, 0xAA, 0x1B, 0x7E, 0x64, 0xCD, 0x01, 0xA2, 0x21, 0x0C, 0x37, 0xD6, 0x07, 0xF6, 0x6C, 0x04, 0x65, 0x8B, 0xE3, 0x56, 0xBE, 0x69, 0x84, 0xC6, 0x64, 0x03, 0x1E, 0x94, 0xA0, 0x63, 0x18, 0x7C},
+		-1},
+	{"edge: u1*G == u2*Q (doubling)",
+		{0xAD, 0x35, 0xB0, 0x68, 0x3B, 0x9C, 0xFD, 0xA7, 0x2F, 0x33, 0xFA, 0xAC, 0x59, 0xA7, 0x31, 0x89, 0x5F, 0x45, 0x00, 0x43, 0x55, 0x91, 0xE6, 0x3D, 0xC2, 0x32, 0xDF, 0xE8, 0x6D, 0x75, 0x9A, 0x7E, 0x9F, 0xEC, 0xC0, 0x05, 0x49, 0x05, 0x8D, 0xA7, 0xD2, 0xCF, 0xF1, 0xF7, 0x08, 0x7F, 0x92, 0x52, 0xB0, 0xD0, 0x70, 0x0B, 0x85, 0x12, 0x79, 0xC5, 0xD5, 0x73, 0x69, 0x12, 0x9B, 0x44, 0x10, 0x44},
+		{0x61, 0xB5, 0x59, 0x64, 0x1D, 0xE8, 0x87, 0x0E, 0x5E, 0xF3, 0xF0, 0x42, 0x44, 0xBC, 0x82, 0x88, 0xCC, 0xA1, 0x8C, 0x54, 0x8B, 0xFD, 0x9D, 0xDE, 0x09, 0xBA, 0x3D, 0x1E, 0xF0, 0x78, 0xFC, 0xE0},
+		{0xDF, 0xE2, 0xEF, 0x6C, 0x50, 0xED, 0xDC, 0x41, 0xC9, 0x26, 0xC4, 0x3A, 0x1C, 0x62, 0xFE, 0x66, 0xCF, 0x4E, 0x33, 0xF6, 0xDE, 0xDD, 0x40, 0xB3, 0xDA, 0xF7, 0xA6, 0xF7, 0xF9, 0xA6, 0x83, 0x97, 0xB8, 0xD6, 0x67, 0xD6, 0x7F, 0x6B, 0x3F, 0xFD, 0x07, 0xBA, 0xF1, 0xF2, 0x6A, 0xAB, 0x88, 0xFE, 0x4F, 0x55, 0x01, 0x78, 0xAE, 0x07, 0x21, 0x6D, 0xC1, 0xD5, 0x4D, 0xB8, 0xCA, 0xF2, 0x48, 0xA9},
+		0},
+	{"edge: Q = G",
+		{0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96, 0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16, 0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0x3A, 0x2C, 0x95, 0xE0, 0x97, 0x2C, 0xBC, 0x53, 0xB1, 0x8C, 0x83, 0xA1, 0x30, 0x5E, 0xEB, 0xA1, 0x06, 0xB8, 0xF8, 0xC5, 0xD3, 0x92, 0xCB, 0x77, 0x8C, 0x1D, 0xEE, 0x34, 0x8A, 0xAF, 0xB1, 0xE6, 0x7E, 0x0D, 0x7E, 0x68, 0xC6, 0x31, 0xF3, 0xE4, 0x75, 0x73, 0x2C, 0x23, 0x59, 0xE5, 0x70, 0xB7, 0xB5, 0x90, 0x8D, 0xAA, 0x62, 0x16, 0x13, 0x09, 0xC9, 0x7F, 0x28, 0x1C, 0x2B, 0x31, 0x11, 0x64},
+		0},
+	{"edge: Q = G, wrong digest",
+		{0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96, 0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16, 0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5},
+		{0xFD, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0x3A, 0x2C, 0x95, 0xE0, 0x97, 0x2C, 0xBC, 0x53, 0xB1, 0x8C, 0x83, 0xA1, 0x30, 0x5E, 0xEB, 0xA1, 0x06, 0xB8, 0xF8, 0xC5, 0xD3, 0x92, 0xCB, 0x77, 0x8C, 0x1D, 0xEE, 0x34, 0x8A, 0xAF, 0xB1, 0xE6, 0x7E, 0x0D, 0x7E, 0x68, 0xC6, 0x31, 0xF3, 0xE4, 0x75, 0x73, 0x2C, 0x23, 0x59, 0xE5, 0x70, 0xB7, 0xB5, 0x90, 0x8D, 0xAA, 0x62, 0x16, 0x13, 0x09, 0xC9, 0x7F, 0x28, 0x1C, 0x2B, 0x31, 0x11, 0x64},
+		-1},
+	{"edge: Q = -G",
+		{0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96, 0xB0, 0x1C, 0xBD, 0x1C, 0x01, 0xE5, 0x80, 0x65, 0x71, 0x18, 0x14, 0xB5, 0x83, 0xF0, 0x61, 0xE9, 0xD4, 0x31, 0xCC, 0xA9, 0x94, 0xCE, 0xA1, 0x31, 0x34, 0x49, 0xBF, 0x97, 0xC8, 0x40, 0xAE, 0x0A},
+		{0x7D, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xD3, 0x1D, 0x18, 0x66, 0x7E, 0xC9, 0x21, 0x4A, 0x3E, 0xE3, 0x29, 0x61, 0x9A, 0xB3, 0x53, 0x54, 0x68, 0x44, 0x64, 0x8F, 0x5A, 0x5A, 0x4B, 0x20, 0x7F, 0x49, 0xE5, 0x2B, 0xEE, 0x28, 0x2E, 0xF9, 0xA9, 0x05, 0x12, 0xF8, 0xF5, 0x8C, 0x8F, 0xF7, 0x30, 0x90, 0x69, 0x30, 0xB3, 0x23, 0x23, 0x50, 0xD7, 0xF4, 0xA3, 0x31, 0x6A, 0x2B, 0xEA, 0x99, 0xDD, 0xF3, 0x33, 0x27, 0x8E, 0x1B, 0xAB, 0x41},
+		0},
+	{"edge: Q = -G, wrong digest",
+		{0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96, 0xB0, 0x1C, 0xBD, 0x1C, 0x01, 0xE5, 0x80, 0x65, 0x71, 0x18, 0x14, 0xB5, 0x83, 0xF0, 0x61, 0xE9, 0xD4, 0x31, 0xCC, 0xA9, 0x94, 0xCE, 0xA1, 0x31, 0x34, 0x49, 0xBF, 0x97, 0xC8, 0x40, 0xAE, 0x0A},
+		{0xFD, 0x45, 0x20, 0x00, 0xD3, 0x5A, 0x5C, 0xFA, 0xBC, 0x45, 0x1F, 0xA8, 0xE0, 0xF1, 0x55, 0xF0, 0x69, 0x1C, 0x2A, 0x13, 0x99, 0xCE, 0x36, 0x59, 0x77, 0xB8, 0xCC, 0x76, 0xE3, 0x1E, 0x37, 0xFC},
+		{0xD3, 0x1D, 0x18, 0x66, 0x7E, 0xC9, 0x21, 0x4A, 0x3E, 0xE3, 0x29, 0x61, 0x9A, 0xB3, 0x53, 0x54, 0x68, 0x44, 0x64, 0x8F, 0x5A, 0x5A, 0x4B, 0x20, 0x7F, 0x49, 0xE5, 0x2B, 0xEE, 0x28, 0x2E, 0xF9, 0xA9, 0x05, 0x12, 0xF8, 0xF5, 0x8C, 0x8F, 0xF7, 0x30, 0x90, 0x69, 0x30, 0xB3, 0x23, 0x23, 0x50, 0xD7, 0xF4, 0xA3, 0x31, 0x6A, 0x2B, 0xEA, 0x99, 0xDD, 0xF3, 0x33, 0x27, 0x8E, 0x1B, 0xAB, 0x41},
+		-1},
+	{"edge: x(R) >= n, r = x - n",
+		{0xA7, 0x4A, 0xE2, 0x6F, 0x4F, 0x2C, 0x08, 0xB6, 0x32, 0xC2, 0xC3, 0x1F, 0x0B, 0x2D, 0x62, 0x03, 0x52, 0xF8, 0xD0, 0x20, 0x2C, 0x45, 0x27, 0x7F, 0x4F, 0xB9, 0xA7, 0x2C, 0x2C, 0x92, 0xE0, 0xCC, 0xC5, 0x02, 0x22, 0x9C, 0x18, 0x14, 0xCD, 0x3F, 0xC1, 0xF0, 0x83, 0x04, 0xBE, 0x2A, 0x0A, 0x9E, 0xE7, 0x11, 0x64, 0xBB, 0x00, 0xD5, 0xCA, 0x0D, 0xB1, 0x0B, 0xB3, 0xBF, 0x51, 0x8B, 0x3A, 0xCE},
+		{0x23, 0xA9, 0x98, 0xCF, 0x76, 0x0F, 0xE7, 0xFE, 0xBC, 0x76, 0x08, 0xBA, 0x54, 0x1F, 0xBB, 0x8D, 0xC5, 0xAB, 0x61, 0x2E, 0xAE, 0x78, 0x87, 0xFC, 0x9E, 0x48, 0xDF, 0x87, 0x13, 0xCE, 0xF0, 0x16},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x6C, 0x65, 0x1B, 0xCF, 0x8E, 0x28, 0x5C, 0xAA, 0x9C, 0xF7, 0x92, 0x5B, 0x46, 0xA7, 0x2C, 0x8D, 0x25, 0x93, 0x23, 0xD7, 0xC3, 0xBA, 0x75, 0xC9, 0x7E, 0x91, 0x8F, 0x84, 0xF4, 0x31, 0x75},
+		0},
+	{"edge: x(R) >= n, r = x",
+		{0xA7, 0x4A, 0xE2, 0x6F, 0x4F, 0x2C, 0x08, 0xB6, 0x32, 0xC2, 0xC3, 0x1F, 0x0B, 0x2D, 0x62, 0x03, 0x52, 0xF8, 0xD0, 0x20, 0x2C, 0x45, 0x27, 0x7F, 0x4F, 0xB9, 0xA7, 0x2C, 0x2C, 0x92, 0xE0, 0xCC, 0xC5, 0x02, 0x22, 0x9C, 0x18, 0x14, 0xCD, 0x3F, 0xC1, 0xF0, 0x83, 0x04, 0xBE, 0x2A, 0x0A, 0x9E, 0xE7, 0x11, 0x64, 0xBB, 0x00, 0xD5, 0xCA, 0x0D, 0xB1, 0x0B, 0xB3, 0xBF, 0x51, 0x8B, 0x3A, 0xCE},
+		{0x23, 0xA9, 0x98, 0xCF, 0x76, 0x0F, 0xE7, 0xFE, 0xBC, 0x76, 0x08, 0xBA, 0x54, 0x1F, 0xBB, 0x8D, 0xC5, 0xAB, 0x61, 0x2E, 0xAE, 0x78, 0x87, 0xFC, 0x9E, 0x48, 0xDF, 0x87, 0x13, 0xCE, 0xF0, 0x16},
+		{0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x54, 0xFA, 0x6C, 0x65, 0x1B, 0xCF, 0x8E, 0x28, 0x5C, 0xAA, 0x9C, 0xF7, 0x92, 0x5B, 0x46, 0xA7, 0x2C, 0x8D, 0x25, 0x93, 0x23, 0xD7, 0xC3, 0xBA, 0x75, 0xC9, 0x7E, 0x91, 0x8F, 0x84, 0xF4, 0x31, 0x75},
+		-1},
+};
+
+#endif /* P256_VECTORS_H_ */
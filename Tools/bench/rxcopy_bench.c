@@ -0,0 +1,263 @@
+/*
+ * rxcopy_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 DATA 패킷 수신 ~ flash 기록 직전까지의 byte 처리를 이전 방식과 비교한다.
+ *
+ *	- 이전: interrupt가 수신 버퍼에 받고, main loop가 sPacketIndex/sPacketData로 memcpy,
+ *	  payload 전체 XOR, flash_wrtie()가 word마다 union memcpy (fConvertString4BytesToInteger32Type)
+ *	- 지금: interrupt가 payload를 word 정렬 버퍼에 바로 받으며 XOR, main loop는 "번호,"만 XOR,
+ *	  flash 쪽은 정렬된 word를 그대로 읽는다
+ *
+ *	flash 프로그래밍 자체는 같으므로 word를 더하는 것으로 대신한다. 두 방식의 checksum과 word 합이
+ *	같은지 먼저 확인한 뒤 interrupt 쪽, main loop 쪽, 합계의 KB당 시간(ns)과 비율을 출력한다.
+ *	측정마다 BENCH_ROUNDS번 돌려 가장 짧은 값을 쓴다.
+ *
+ *	host -O2, 6번 실행: main loop 쪽은 0.11배로 줄지만 byte마다 상태를 확인하는 interrupt 쪽은 1.01~1.06배로
+ *	늘고, interrupt가 전체의 대부분이라 합계는 0.87~0.92배이다. 가장 짧은 값이 아니라 한번씩 잰 값으로는
+ *	interrupt 쪽이 10~40% 느리게, 합계는 비슷하게 나오기도 한다 (측정 잡음).
+ *	이 변경으로 얻는 것은 처리 시간보다 복사 버퍼 (sPacketData, sPacketIndex)가 없어지는 것과 payload의
+ *	"\r\n"이 패킷을 끊지 않는 것이다. host memcpy는 SIMD라 target에서는 없어진 복사 비용이 더 크다.
+ *
+ *	gcc -O2 Tools/bench/rxcopy_bench.c -o rxcopy_bench && ./rxcopy_bench
+ *
+ *	target에서는 END 때 interrupt 쪽 (fTransportRxIsr 안, exception 진입/복귀 제외)이
+ *	"[MCU]PERF,PACKET_RECEIVE,KB당 cycle,byte"로, main loop 쪽이 "[MCU]PERF,PACKET_PARSE,KB당 cycle,byte"로
+ *	보고된다. 둘 다 payload KB 기준이므로 더하면 수신 경로 전체이다.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define PACKET_SIZE			256
+#define PACKETLIMITELENGTH	(PACKET_SIZE + 32)
+#define BENCH_PACKETS		100000
+#define BENCH_ROUNDS		7
+
+#define RX_STATE_HEADER		0
+#define RX_STATE_PAYLOAD	1
+#define RX_STATE_TRAILER	2
+
+static uint8_t sWire[PACKETLIMITELENGTH];
+static int iWireLength;
+
+static uint8_t sReceiveBuffer[PACKETLIMITELENGTH];
+static volatile int iReceiveIndex;
+static char sPacketIndex[32];
+static char sPacketData[PACKETLIMITELENGTH];
+static uint32_t sPacketPayload[PACKET_SIZE / 4];
+static volatile int iPayloadIndex;
+static volatile uint8_t iPayloadXor;
+static volatile int iRxState;
+
+union uIntegerConvert
+{
+	int uIntegerData;
+	char uStringData[4];
+};
+
+static double fNow(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+static int fConvertStringToInt32(const char *source)
+{
+	int res = 0;
+	for (int i = 0; (source[i] >= '0') && (source[i] <= '9'); i++)
+	{
+		res = (res * 10) + (source[i] - '0');
+	}
+	return res;
+}
+
+static char crc_xor_calculation(const char *sData, int data_size)
+{
+	char res = sData[0];
+	for (int i = 1; i < data_size; i++)
+	{
+		res = res ^ sData[i];
+	}
+	return res;
+}
+
+static int fConvertString4BytesToInteger32Type(const char *sData)
+{
+	union uIntegerConvert uint;
+	memcpy(uint.uStringData, sData, sizeof(int));
+	return uint.uIntegerData;
+}
+
+/* 이전 interrupt: 수신 버퍼에만 받는다. target처럼 byte마다 따로 불리도록 inline 하지 않는다 */
+static __attribute__((noinline)) void fRxOld(uint8_t data)
+{
+	if (iReceiveIndex < PACKETLIMITELENGTH)
+	{
+		sReceiveBuffer[iReceiveIndex++] = data;
+	}
+}
+
+/* 지금 interrupt: bootcode.c getRxBuffer()와 같다 */
+static __attribute__((noinline)) void fRxNew(uint8_t data)
+{
+	if (iReceiveIndex == 0)
+	{
+		iRxState = RX_STATE_HEADER;
+	}
+	if (iRxState == RX_STATE_PAYLOAD)
+	{
+		((uint8_t *)sPacketPayload)[iPayloadIndex++] = data;
+		iPayloadXor ^= data;
+		if (iPayloadIndex >= PACKET_SIZE)
+		{
+			iRxState = RX_STATE_TRAILER;
+		}
+		return;
+	}
+	if (iReceiveIndex < PACKETLIMITELENGTH)
+	{
+		sReceiveBuffer[iReceiveIndex++] = data;
+	}
+	if ((iRxState == RX_STATE_HEADER) && (data == ',') && (sReceiveBuffer[0] == '[') && (sReceiveBuffer[1] == 'D') && (sReceiveBuffer[2] == 'A'))
+	{
+		iPayloadIndex = 0;
+		iPayloadXor = 0;
+		iRxState = RX_STATE_PAYLOAD;
+	}
+}
+
+/* 패킷 하나를 interrupt 쪽으로 넣는다 */
+static void fFeed(void (*fRx)(uint8_t))
+{
+	iReceiveIndex = 0;
+	for (int i = 0; i < iWireLength; i++)
+	{
+		fRx(sWire[i]);
+	}
+}
+
+/* 이전 main loop + flash_wrtie 입력 처리, 돌려주는 값은 checksum과 word 합 */
+static uint32_t fPacketOld(char *cXor)
+{
+	int iComma = 6;
+	uint32_t iSum = 0;
+
+	while (sReceiveBuffer[iComma] != ',')
+	{
+		iComma++;
+	}
+
+	memcpy(sPacketIndex, sReceiveBuffer + 6, iComma - 6);
+	memcpy(sPacketData, sReceiveBuffer + iComma + 1, PACKET_SIZE);
+	iSum += (uint32_t)fConvertStringToInt32(sPacketIndex);
+	*cXor = crc_xor_calculation((char *)sReceiveBuffer + 6, (iComma + 1 + PACKET_SIZE) - 6);
+	for (int i = 0; i < PACKET_SIZE; i += 4)
+	{
+		iSum += (uint32_t)fConvertString4BytesToInteger32Type((char *)sReceiveBuffer + iComma + 1 + i);
+	}
+	return iSum;
+}
+
+/* 지금 main loop + flash_wrtie 입력 처리 */
+static uint32_t fPacketNew(char *cXor)
+{
+	int iComma = 6;
+	uint32_t iSum = 0;
+
+	while (sReceiveBuffer[iComma] != ',')
+	{
+		iComma++;
+	}
+
+	iSum += (uint32_t)fConvertStringToInt32((char *)sReceiveBuffer + 6);
+	*cXor = crc_xor_calculation((char *)sReceiveBuffer + 6, (iComma + 1) - 6) ^ iPayloadXor;
+	for (int i = 0; i < PACKET_SIZE / 4; i++)
+	{
+		iSum += sPacketPayload[i];
+	}
+	return iSum;
+}
+
+int main(void)
+{
+	volatile uint32_t iSink = 0;
+	char cOld, cNew;
+	uint32_t iOld, iNew;
+	double fStart, fNs, fOldNs, fNewNs, fOldRxNs, fNewRxNs;
+
+	// "[DATA]1234," + payload + ",X\r\n"
+	iWireLength = sprintf((char *)sWire, "[DATA]1234,");
+	for (int i = 0; i < PACKET_SIZE; i++)
+	{
+		sWire[iWireLength++] = (uint8_t)((i * 37) + 11);
+	}
+	sWire[iWireLength++] = ',';
+	sWire[iWireLength++] = 'X';
+	sWire[iWireLength++] = '\r';
+	sWire[iWireLength++] = '\n';
+
+	fFeed(fRxOld);
+	iOld = fPacketOld(&cOld);
+	fFeed(fRxNew);
+	iNew = fPacketNew(&cNew);
+	if ((iOld != iNew) || (cOld != cNew))
+	{
+		printf("MISMATCH sum %08X/%08X xor %02X/%02X\n", iOld, iNew, (uint8_t)cOld, (uint8_t)cNew);
+		return 1;
+	}
+
+	// interrupt 쪽 (byte마다), 같은 패킷을 계속 넣는다
+	fOldRxNs = fNewRxNs = fOldNs = fNewNs = 1e30;
+	for (int r = 0; r < BENCH_ROUNDS; r++)
+	{
+		fStart = fNow();
+		for (int i = 0; i < BENCH_PACKETS; i++)
+		{
+			fFeed(fRxOld);
+		}
+		fNs = (fNow() - fStart) / BENCH_PACKETS;
+		fOldRxNs = (fNs < fOldRxNs) ? fNs : fOldRxNs;
+
+		fStart = fNow();
+		for (int i = 0; i < BENCH_PACKETS; i++)
+		{
+			fFeed(fRxNew);
+		}
+		fNs = (fNow() - fStart) / BENCH_PACKETS;
+		fNewRxNs = (fNs < fNewRxNs) ? fNs : fNewRxNs;
+
+		// main loop 쪽, 버퍼는 마지막으로 받은 그대로 (이전 방식 버퍼는 다시 채운다)
+		fStart = fNow();
+		for (int i = 0; i < BENCH_PACKETS; i++)
+		{
+			iSink += fPacketNew(&cNew);
+		}
+		fNs = (fNow() - fStart) / BENCH_PACKETS;
+		fNewNs = (fNs < fNewNs) ? fNs : fNewNs;
+
+		fFeed(fRxOld);
+		fStart = fNow();
+		for (int i = 0; i < BENCH_PACKETS; i++)
+		{
+			iSink += fPacketOld(&cOld);
+		}
+		fNs = (fNow() - fStart) / BENCH_PACKETS;
+		fOldNs = (fNs < fOldNs) ? fNs : fOldNs;
+	}
+
+	printf("%d byte payload, ns/KB      copy path  zero-copy   ratio\n", PACKET_SIZE);
+	printf("  receive interrupt        %9.1f  %9.1f  %5.2fx\n", fOldRxNs * 1024 / PACKET_SIZE, fNewRxNs * 1024 / PACKET_SIZE, fNewRxNs / fOldRxNs);
+	printf("  main loop + flash input  %9.1f  %9.1f  %5.2fx\n", fOldNs * 1024 / PACKET_SIZE, fNewNs * 1024 / PACKET_SIZE, fNewNs / fOldNs);
+	printf("  total                    %9.1f  %9.1f  %5.2fx\n", (fOldRxNs + fOldNs) * 1024 / PACKET_SIZE, (fNewRxNs + fNewNs) * 1024 / PACKET_SIZE,
+		(fNewRxNs + fNewNs) / (fOldRxNs + fOldNs));
+
+	(void)iSink;
+	return 0;
+}
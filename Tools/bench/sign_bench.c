@@ -0,0 +1,130 @@
+/*
+ * sign_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 이미지 서명 검증 비용을 잰다.
+ *
+ *	- SHA-256: 64 KB 이미지를 DATA 패킷 크기(256 Byte)로 나눠 넣는 streaming 계산, KB당 시간(ns)
+ *	- P-256 검증: fP256Verify() 한번 시간(us)과 Montgomery 곱셈 한번 시간(ns).
+ *	  검증 시간 / 곱셈 시간 = 곱셈 몇 번 분량인지 (덧셈, 비교 포함)를 같이 출력하므로 target의 곱셈 cycle을
+ *	  알면 검증 cycle을 어림할 수 있다. host는 UMAAL 대신 64 bit 곱셈 fallback을 쓴다.
+ *
+ *	고정된 test vector (Tools/p256.py로 만든 서명)가 통과하고, digest를 1 bit 바꾸면 실패하는지 먼저 확인한다.
+ *	검증기 정확성은 Tools/bench/p256_test.c (NIST CAVP, edge case vector)에서 본다.
+ *	p256.c의 static 함수도 재야 하므로 소스를 직접 include 한다.
+ *
+ *	gcc -O2 -I Core/Inc -I Core/Src Tools/bench/sign_bench.c Core/Src/sha256.c -o sign_bench && ./sign_bench
+ *
+ *	target에서는 END 때 "[MCU]PERF,IMAGE_HASH,KB당 cycle,byte"와 "[MCU]IMAGE,SIGNATURE,결과,us"로 보고된다.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "sha256.h"
+#include "p256.c"
+
+#define BENCH_IMAGE_SIZE	(64 * 1024)
+#define BENCH_PACKET_SIZE	256
+#define BENCH_HASH_ROUNDS	200
+#define BENCH_VERIFY_ROUNDS	200
+#define BENCH_MUL_ROUNDS	1000000
+
+// BENCH_IMAGE_SIZE byte pattern ((i * 2654435761) >> 24)의 SHA-256
+static const uint8_t sBenchDigest[32] =
+{
+	0x55, 0x92, 0x86, 0x07, 0x57, 0x22, 0x70, 0xEA, 0x0E, 0xAF, 0xC1, 0x08, 0x65, 0xD7, 0x05, 0xAD,
+	0xCF, 0x44, 0x83, 0xFC, 0x86, 0x16, 0x61, 0x36, 0xB6, 0x87, 0xAD, 0x06, 0xE5, 0xDC, 0x14, 0xFF,
+};
+static const uint8_t sBenchPublicKey[64] =
+{
+	0xE1, 0x56, 0x3A, 0x9B, 0x10, 0xFB, 0xBC, 0xA3, 0x05, 0x0B, 0x42, 0x47, 0xFC, 0x1B, 0x5B, 0xD5,
+	0xE0, 0xB5, 0x51, 0x8A, 0xC8, 0xC5, 0xE6, 0xCC, 0x46, 0x36, 0x8F, 0x0F, 0x2C, 0xE2, 0xA0, 0x40,
+	0xDC, 0xFC, 0xA0, 0xCB, 0x29, 0x3C, 0xD7, 0x8E, 0x46, 0xB2, 0xE6, 0xE3, 0xE1, 0x82, 0x2C, 0x5D,
+	0x95, 0x6F, 0x74, 0xFF, 0x64, 0x96, 0x13, 0xC7, 0xBF, 0x2C, 0x4C, 0xD0, 0x08, 0x3A, 0x0F, 0x6F,
+};
+static const uint8_t sBenchSignature[64] =
+{
+	0xA7, 0x4B, 0xDD, 0x62, 0x3D, 0xE2, 0x8A, 0xFE, 0x45, 0xF4, 0xBF, 0x4B, 0x4B, 0x3B, 0xFA, 0x4D,
+	0xB6, 0x33, 0x87, 0x08, 0xE1, 0x58, 0xAF, 0xB6, 0xD1, 0xCF, 0xB7, 0xCF, 0x98, 0xEB, 0x22, 0xBF,
+	0xDD, 0xC7, 0xA7, 0x09, 0x10, 0x25, 0xCB, 0x92, 0xC0, 0x52, 0xFC, 0x73, 0x85, 0x3B, 0x92, 0x62,
+	0xEA, 0x32, 0x80, 0xE3, 0x49, 0x6D, 0x63, 0xA1, 0xBA, 0x9D, 0xEB, 0xEA, 0xA0, 0x0A, 0xBF, 0x95,
+};
+
+static uint8_t sImage[BENCH_IMAGE_SIZE];
+
+static double fNow(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+int main(void)
+{
+	Sha256TypeDef sSha;
+	uint8_t sDigest[32];
+	uint8_t sBad[32];
+	uint32_t sA[P256_WORDS], sB[P256_WORDS];
+	volatile int iResult = 0;
+	double fStart, fHashNs, fVerifyNs, fMulNs;
+
+	for (uint32_t i = 0; i < BENCH_IMAGE_SIZE; i++)
+	{
+		sImage[i] = (uint8_t)((i * 2654435761U) >> 24);
+	}
+
+	// 패킷 단위 streaming 계산
+	fStart = fNow();
+	for (int r = 0; r < BENCH_HASH_ROUNDS; r++)
+	{
+		fSha256Init(&sSha);
+		for (uint32_t i = 0; i < BENCH_IMAGE_SIZE; i += BENCH_PACKET_SIZE)
+		{
+			fSha256Update(&sSha, &sImage[i], BENCH_PACKET_SIZE);
+		}
+		fSha256Final(&sSha, sDigest);
+	}
+	fHashNs = (fNow() - fStart) / BENCH_HASH_ROUNDS;
+
+	if (memcmp(sDigest, sBenchDigest, sizeof(sDigest)) != 0)
+	{
+		printf("SHA-256 mismatch\n");
+		return 1;
+	}
+	memcpy(sBad, sDigest, sizeof(sBad));
+	sBad[31] ^= 0x01;
+	if ((fP256Verify(sBenchPublicKey, sDigest, sBenchSignature) != 0) || (fP256Verify(sBenchPublicKey, sBad, sBenchSignature) != -1))
+	{
+		printf("P-256 verify mismatch\n");
+		return 1;
+	}
+
+	fStart = fNow();
+	for (int r = 0; r < BENCH_VERIFY_ROUNDS; r++)
+	{
+		iResult |= fP256Verify(sBenchPublicKey, sDigest, sBenchSignature);
+	}
+	fVerifyNs = (fNow() - fStart) / BENCH_VERIFY_ROUNDS;
+
+	memcpy(sA, sP256Gx, sizeof(sA));
+	memcpy(sB, sP256Gy, sizeof(sB));
+	fStart = fNow();
+	for (int r = 0; r < BENCH_MUL_ROUNDS; r++)
+	{
+		fP256MontMul(sA, sA, sB, &sP256P);
+	}
+	fMulNs = (fNow() - fStart) / BENCH_MUL_ROUNDS;
+	iResult |= (int)(sA[0] & 0);
+
+	printf("SHA-256, %d KB in %d byte packets : %8.1f ns/KB (%.1f MB/s)\n", BENCH_IMAGE_SIZE / 1024, BENCH_PACKET_SIZE,
+		fHashNs / (BENCH_IMAGE_SIZE / 1024), (BENCH_IMAGE_SIZE / 1e6) / (fHashNs / 1e9));
+	printf("P-256 Montgomery multiply         : %8.1f ns\n", fMulNs);
+	printf("P-256 verify                      : %8.1f us (%.0f multiplies)\n", fVerifyNs / 1000, fVerifyNs / fMulNs);
+	return iResult;
+}
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+gen_glyphs.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Generate Core/Inc/glyph.h (column-major glyph table) from Font12_Table in Core/Inc/font.h.
+
+  usage: python3 Tools/gen_glyphs.py            # regenerate Core/Inc/glyph.h
+         python3 Tools/gen_glyphs.py --check    # exit 1 if glyph.h is out of date
+
+Font12_Table is row-major: 12 bytes per glyph, one byte per pixel row, MSB = leftmost column.
+The SSD1306 is column-major: one byte per column per 8-row page, LSB = top row.
+Each glyph column becomes one uint16_t (bit n = row n), so display.c only needs to shift
+it to the target row and OR/mask it into at most 3 pages.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+FONT_H = os.path.join(ROOT, 'Core', 'Inc', 'font.h')
+GLYPH_H = os.path.join(ROOT, 'Core', 'Inc', 'glyph.h')
+
+FIRST_CHAR = 32
+WIDTH = 8
+HEIGHT = 12
+
+
+def load_font(path):
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    body = text[text.index('Font12_Table[]'):]
+    body = body[body.index('{') + 1:body.index('};')]
+    # 주석('//' 뒤 그림) 제거 후 숫자만
+    body = re.sub(r'//[^\n]*', '', body)
+    return [int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\d+', body)]
+
+
+def transpose(rows):
+    """12 row bytes -> 8 column words"""
+    columns = []
+    for x in range(WIDTH):
+        word = 0
+        for y in range(HEIGHT):
+            if (rows[y] >> (7 - x)) & 1:
+                word |= 1 << y
+        columns.append(word)
+    return columns
+
+
+def render(font):
+    count = len(font) // HEIGHT
+    lines = [
+        '/*',
+        ' * glyph.h',
+        ' *',
+        ' *  Generated by Tools/gen_glyphs.py from font.h, do not edit.',
+        ' */',
+        '',
+        '#ifndef INC_GLYPH_H_',
+        '#define INC_GLYPH_H_',
+        '',
+        '//define',
+        '// 첫 글자 (\' \')',
+        '#define GLYPH_FIRST_CHAR\t\t\t\t%d' % FIRST_CHAR,
+        '// 글자 수',
+        '#define GLYPH_COUNT\t\t\t\t\t\t%d' % count,
+        '// 글자 가로, 세로 pixel',
+        '#define GLYPH_WIDTH\t\t\t\t\t\t%d' % WIDTH,
+        '#define GLYPH_HEIGHT\t\t\t\t\t%d' % HEIGHT,
+        '',
+        '/* 글자별 column 데이터, bit n = n번째 행 (SSD1306 page 방향과 같다) */',
+        'static const uint16_t sGlyphTable[GLYPH_COUNT][GLYPH_WIDTH] =',
+        '{',
+    ]
+    for i in range(count):
+        columns = transpose(font[i * HEIGHT:(i + 1) * HEIGHT])
+        lines.append('\t{ %s },\t// \'%s\'' % (', '.join('0x%03X' % c for c in columns),
+                                               chr(FIRST_CHAR + i) if chr(FIRST_CHAR + i) != '\\' else 'backslash'))
+    lines += ['};', '', '#endif /* INC_GLYPH_H_ */', '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', action='store_true', help='only check that glyph.h is up to date')
+    args = parser.parse_args()
+
+    font = load_font(FONT_H)
+    if len(font) % HEIGHT != 0:
+        sys.exit('gen_glyphs: Font12_Table has %d bytes, not a multiple of %d' % (len(font), HEIGHT))
+    text = render(font)
+
+    if args.check:
+        with open(GLYPH_H, encoding='utf-8') as f:
+            if f.read() != text:
+                sys.exit('gen_glyphs: %s is out of date, run Tools/gen_glyphs.py' % GLYPH_H)
+        return 0
+
+    with open(GLYPH_H, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+    print('%s: %d glyphs, %d bytes' % (GLYPH_H, len(font) // HEIGHT, len(font) // HEIGHT * WIDTH * 2))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,369 @@
+#!/usr/bin/env python3
+"""
+gen_p256_vectors.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Generate Tools/bench/p256_vectors.h, the test vectors Tools/bench/p256_test.c runs through
+fP256Verify() (Core/Src/p256.c).
+
+  usage: python3 Tools/gen_p256_vectors.py --sigver SigVer.rsp[.bz2]
+         python3 Tools/gen_p256_vectors.py --sigver SigVer.rsp --wycheproof ecdsa_secp256r1_sha256_test.json
+         python3 Tools/gen_p256_vectors.py --sigver SigVer.rsp --check   # exit 1 if p256_vectors.h is out of date
+
+Sources:
+- NIST CAVP SigVer.rsp (186-4 ECDSA test vectors): every [P-256,SHA-*] section. The digest is the
+  hash of Msg cut to its leftmost 256 bits, as ECDSA does, so SHA-384/512 sections apply too.
+- Wycheproof ecdsa_secp256r1_sha256_test.json, when given. fP256Verify() takes raw r || s, so only
+  tests whose signature is strict DER with r and s of at most 32 bytes are kept; DER encoding tests
+  and "acceptable" results are skipped.
+- Edge cases built here with Tools/p256.py from fixed private keys, so the output is reproducible:
+  r or s = 0, n or 2^256 - 1, s + n for a small s, high s (n - s, valid for plain ECDSA),
+  public keys off the curve or with x + p / y + p, digests >= n, u1*G + u2*Q at infinity, u1*G == u2*Q (the
+  Shamir table addition doubles), Q = G and Q = -G (G + Q doubles or is infinity), and an R whose
+  x is >= n so only r + n matches.
+
+Expected result is 0 (valid) or -1 (invalid), the return values of fP256Verify().
+"""
+
+import argparse
+import bz2
+import hashlib
+import json
+import os
+import sys
+
+import p256
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+VECTORS_H = os.path.join(ROOT, 'Tools', 'bench', 'p256_vectors.h')
+
+HASHES = {'SHA-1': hashlib.sha1, 'SHA-224': hashlib.sha224, 'SHA-256': hashlib.sha256,
+          'SHA-384': hashlib.sha384, 'SHA-512': hashlib.sha512}
+
+
+def digest_of(hash_name, message):
+    """ECDSA digest: the hash, left-padded or cut to its leftmost 256 bits."""
+    value = HASHES[hash_name](message).digest()
+    return value[:32].rjust(32, b'\x00')
+
+
+def key_bytes(x, y):
+    return x.to_bytes(32, 'big') + y.to_bytes(32, 'big')
+
+
+def load_sigver(path):
+    opener = bz2.open if path.endswith('.bz2') else open
+    with opener(path, 'rt') as f:
+        lines = f.read().splitlines()
+    vectors = []
+    section = None
+    record = {}
+    for line in lines:
+        line = line.strip()
+        if line.startswith('['):
+            section = line[1:-1].split(',')
+            continue
+        if not section or section[0] != 'P-256' or '=' not in line:
+            continue
+        name, value = [v.strip() for v in line.split('=', 1)]
+        record[name] = value
+        if name != 'Result':
+            continue
+        count = sum(1 for v in vectors if v[0].startswith('CAVP %s' % section[1]))
+        vectors.append(('CAVP %s #%d' % (section[1], count),
+                        key_bytes(int(record['Qx'], 16), int(record['Qy'], 16)),
+                        digest_of(section[1], bytes.fromhex(record['Msg'])),
+                        int(record['R'], 16).to_bytes(32, 'big') + int(record['S'], 16).to_bytes(32, 'big'),
+                        0 if value.startswith('P') else -1))
+        record = {}
+    return vectors
+
+
+def der_integer(data, offset):
+    if data[offset] != 0x02 or data[offset + 1] >= 0x80:
+        raise ValueError
+    length = data[offset + 1]
+    value = data[offset + 2:offset + 2 + length]
+    if length == 0 or len(value) != length or value[0] & 0x80:
+        raise ValueError
+    if length > 1 and value[0] == 0 and not value[1] & 0x80:
+        raise ValueError
+    return int.from_bytes(value, 'big'), offset + 2 + length
+
+
+def der_signature(data):
+    """Strict DER SEQUENCE { r, s } -> raw r || s, ValueError if not representable."""
+    if len(data) < 2 or data[0] != 0x30 or data[1] >= 0x80 or data[1] != len(data) - 2:
+        raise ValueError
+    r, offset = der_integer(data, 2)
+    s, offset = der_integer(data, offset)
+    if offset != len(data) or r >= 2**256 or s >= 2**256:
+        raise ValueError
+    return r.to_bytes(32, 'big') + s.to_bytes(32, 'big')
+
+
+def load_wycheproof(path):
+    with open(path) as f:
+        suite = json.load(f)
+    vectors = []
+    skipped = 0
+    for group in suite['testGroups']:
+        key = group.get('publicKey', group.get('key'))
+        if group.get('sha', 'SHA-256') != 'SHA-256' or key.get('curve', 'secp256r1') != 'secp256r1':
+            continue
+        wx, wy = int(key['wx'], 16), int(key['wy'], 16)
+        for test in group['tests']:
+            if test['result'] == 'acceptable' or wx >= 2**256 or wy >= 2**256:
+                skipped += 1
+                continue
+            try:
+                signature = der_signature(bytes.fromhex(test['sig']))
+            except (ValueError, IndexError):
+                skipped += 1
+                continue
+            vectors.append(('Wycheproof tcId %d' % test['tcId'], key_bytes(wx, wy),
+                            digest_of('SHA-256', bytes.fromhex(test['msg'])), signature,
+                            0 if test['result'] == 'valid' else -1))
+    return vectors, skipped
+
+
+def fixed_private(label):
+    return int.from_bytes(hashlib.sha256(label.encode()).digest(), 'big') % (p256.N - 1) + 1
+
+
+def raw(r, s):
+    return r.to_bytes(32, 'big') + s.to_bytes(32, 'big')
+
+
+def lift_x(x):
+    """Point with this x (even y), or None if x is not on the curve."""
+    rhs = (x * x * x + p256.A * x + p256.B) % p256.P
+    y = pow(rhs, (p256.P + 1) // 4, p256.P)
+    if y * y % p256.P != rhs:
+        return None
+    return (x, y if y % 2 == 0 else p256.P - y)
+
+
+def forge(point, label, k1=None):
+    """Digest and signature that verify against this point without its private key:
+    R = k1*G + k2*Q, r = x(R), s = r / k2, e = k1 * s, so u1 = k1 and u2 = k2.
+    k1 = 0 keeps every addition on the curve the point lies on, even when that is not P-256."""
+    n = p256.N
+    k2 = fixed_private('p256 edge k2 ' + label)
+    if k1 is None:
+        k1 = fixed_private('p256 edge k1 ' + label)
+    r = p256.point_add(p256.point_mul(k1, p256.G), p256.point_mul(k2, point))[0] % n
+    s = r * pow(k2, -1, n) % n
+    return (k1 * s % n).to_bytes(32, 'big'), raw(r, s)
+
+
+def _poly_mulmod(a, b, f):
+    """a * b mod (f, p), polynomials as coefficient lists from x^0, f monic."""
+    result = [0] * (len(a) + len(b) - 1)
+    for i, x in enumerate(a):
+        for j, y in enumerate(b):
+            result[i + j] = (result[i + j] + x * y) % p256.P
+    while len(result) >= len(f):
+        top = result.pop()
+        for i in range(len(f) - 1):
+            result[len(result) - len(f) + 1 + i] = (result[len(result) - len(f) + 1 + i] - top * f[i]) % p256.P
+    return result
+
+
+def _poly_gcd(a, b):
+    while any(b):
+        while len(b) > 1 and b[-1] == 0:
+            b.pop()
+        inverse = pow(b[-1], -1, p256.P)
+        b = [v * inverse % p256.P for v in b]
+        remainder = list(a)
+        while len(remainder) >= len(b):
+            top = remainder.pop()
+            for i in range(len(b) - 1):
+                remainder[len(remainder) - len(b) + 1 + i] = (remainder[len(remainder) - len(b) + 1 + i] - top * b[i]) % p256.P
+        a, b = b, remainder or [0]
+    return a
+
+
+def lift_y(y):
+    """Point with this y when x^3 - 3x + b = y^2 has exactly one root x, else None."""
+    f = [(p256.B - y * y) % p256.P, p256.A, 0, 1]
+    power, base, k = [1], [0, 1], p256.P
+    while k:
+        if k & 1:
+            power = _poly_mulmod(power, base, f)
+        base = _poly_mulmod(base, base, f)
+        k >>= 1
+    power = power + [0] * (3 - len(power))
+    power[1] = (power[1] - 1) % p256.P
+    g = _poly_gcd(f, power)
+    if len(g) != 2:
+        return None
+    return ((-g[0] * pow(g[1], -1, p256.P)) % p256.P, y)
+
+
+def edge_cases():
+    n, p = p256.N, p256.P
+    d = fixed_private('p256 edge key')
+    q = p256.point_mul(d, p256.G)
+    key = key_bytes(*q)
+    digest = hashlib.sha256(b'p256 edge message').digest()
+    signature = p256.sign_digest(d, digest)
+    r, s = int.from_bytes(signature[:32], 'big'), int.from_bytes(signature[32:], 'big')
+    vectors = [('edge: reference signature', key, digest, signature, 0)]
+
+    for name, bad_r, bad_s in (('r = 0', 0, s), ('s = 0', r, 0), ('r = s = 0', 0, 0),
+                               ('r = n', n, s), ('s = n', r, n), ('r = 2^256 - 1', 2**256 - 1, s),
+                               ('s = 2^256 - 1', r, 2**256 - 1)):
+        vectors.append(('edge: %s' % name, key, digest, raw(bad_r, bad_s), -1))
+    vectors.append(('edge: high s (n - s)', key, digest, raw(r, n - s), 0))
+    # s < 2^256 - n인 서명: s + n도 32 Byte에 들어가므로 범위 검사가 없으면 mod n으로 통과한다
+    k = fixed_private('p256 edge small s nonce')
+    r_small_s = p256.point_mul(k, p256.G)[0] % n
+    small_s = 0x1234567
+    e = (small_s * k - r_small_s * d) % n
+    vectors.append(('edge: small s', key, e.to_bytes(32, 'big'), raw(r_small_s, small_s), 0))
+    vectors.append(('edge: small s + n', key, e.to_bytes(32, 'big'), raw(r_small_s, small_s + n), -1))
+    vectors.append(('edge: r = n - r', key, digest, raw(n - r, s), -1))
+
+    # 곡선 밖의 공개키, 좌표 >= p. 덧셈/doubling 식에 b가 없으므로 곡선 검사를 빼먹으면 통과하는 서명을 만든다
+    off = (q[0], (q[1] + 1) % p)
+    vectors.append(('edge: off-curve key, its own signature', key_bytes(*off), *forge(off, 'off', 0), -1))
+    vectors.append(('edge: public key (0, 0)', bytes(64), digest, signature, -1))
+    vectors.append(('edge: public key x = p', key_bytes(p, q[1]), digest, signature, -1))
+    vectors.append(('edge: public key y = 2^256 - 1', key_bytes(q[0], 2**256 - 1), digest, signature, -1))
+    # x가 작은 곡선 위의 점에 p를 더한 key: mod p로는 같은 점이므로 범위 검사가 없으면 통과한다
+    low = next(point for point in (lift_x(x) for x in range(1, 64)) if point)
+    low_digest, low_signature = forge(low, 'low')
+    vectors.append(('edge: small-x key', key_bytes(*low), low_digest, low_signature, 0))
+    vectors.append(('edge: small-x key with x + p', key_bytes(low[0] + p, low[1]), low_digest, low_signature, -1))
+    low = next(point for point in (lift_y(y) for y in range(1, 64)) if point)
+    low_digest, low_signature = forge(low, 'low y')
+    vectors.append(('edge: small-y key', key_bytes(*low), low_digest, low_signature, 0))
+    vectors.append(('edge: small-y key with y + p', key_bytes(low[0], low[1] + p), low_digest, low_signature, -1))
+
+    # digest >= n: e = digest - n으로 서명
+    for name, value in (('digest = n', n), ('digest = n + 1', n + 1), ('digest = 2^256 - 1', 2**256 - 1)):
+        big = value.to_bytes(32, 'big')
+        vectors.append(('edge: %s' % name, key, big, p256.sign_digest(d, big), 0))
+    vectors.append(('edge: digest = 0', key, bytes(32), p256.sign_digest(d, bytes(32)), 0))
+    vectors.append(('edge: digest = n signed as 0', key, n.to_bytes(32, 'big'), p256.sign_digest(d, bytes(32)), 0))
+
+    # u1*G + u2*Q = 무한원점: e = -r*d mod n
+    e = (-r * d) % n
+    vectors.append(('edge: u1*G + u2*Q = infinity', key, e.to_bytes(32, 'big'), raw(r, s), -1))
+
+    # u1*G == u2*Q: e = r*d, s = k^-1 * 2*r*d
+    k = fixed_private('p256 edge nonce')
+    r2 = p256.point_mul(k, p256.G)[0] % n
+    e = r2 * d % n
+    s2 = pow(k, -1, n) * (e + r2 * d) % n
+    vectors.append(('edge: u1*G == u2*Q (doubling)', key, e.to_bytes(32, 'big'), raw(r2, s2), 0))
+
+    # Q = G (G + Q는 2G), Q = -G (G + Q는 무한원점)
+    for name, private in (('Q = G', 1), ('Q = -G', n - 1)):
+        vectors.append(('edge: %s' % name, p256.public_key(private), digest, p256.sign_digest(private, digest), 0))
+        flipped = bytes([digest[0] ^ 0x80]) + digest[1:]
+        vectors.append(('edge: %s, wrong digest' % name, p256.public_key(private), flipped,
+                        p256.sign_digest(private, digest), -1))
+
+    # x(R) >= n: r = x - n, 검사는 r + n < p일 때 r + n도 비교해야 한다.
+    # e, s를 정하고 Q = u2^-1 * (R - u1*G)로 공개키를 만든다
+    big_r = next(point for point in (lift_x(x) for x in range(n, p)) if point)
+    r3 = big_r[0] - n
+    s3 = fixed_private('p256 edge s')
+    e3 = fixed_private('p256 edge e')
+    w = pow(s3, -1, n)
+    u1, u2 = e3 * w % n, r3 * w % n
+    minus_u1_g = p256.point_mul(n - u1, p256.G)
+    q3 = p256.point_mul(pow(u2, -1, n), p256.point_add(big_r, minus_u1_g))
+    vectors.append(('edge: x(R) >= n, r = x - n', key_bytes(*q3), e3.to_bytes(32, 'big'), raw(r3, s3), 0))
+    vectors.append(('edge: x(R) >= n, r = x', key_bytes(*q3), e3.to_bytes(32, 'big'), raw(big_r[0], s3), -1))
+    return vectors
+
+
+def c_bytes(data):
+    return '{' + ', '.join('0x%02X' % b for b in data) + '}'
+
+
+def render(vectors, sources):
+    lines = ['/*',
+             ' * p256_vectors.h',
+             ' *',
+             ' *  Generated by Tools/gen_p256_vectors.py, do not edit.',
+             ' *  Sources: %s' % ', '.join(sources),
+             ' */',
+             '',
+             '#ifndef P256_VECTORS_H_',
+             '#define P256_VECTORS_H_',
+             '',
+             '#include <stdint.h>',
+             '',
+             'typedef struct',
+             '{',
+             '\tconst char *pName;',
+             '\tuint8_t sPublicKey[64];',
+             '\tuint8_t sDigest[32];',
+             '\tuint8_t sSignature[64];',
+             '\t// fP256Verify() 기대값, 0 = valid, -1 = invalid',
+             '\tint iExpected;',
+             '} P256VectorTypeDef;',
+             '',
+             'static const P256VectorTypeDef sP256Vectors[] =',
+             '{']
+    for name, key, digest, signature, expected in vectors:
+        lines.append('\t{"%s",' % name)
+        lines.append('\t\t%s,' % c_bytes(key))
+        lines.append('\t\t%s,' % c_bytes(digest))
+        lines.append('\t\t%s,' % c_bytes(signature))
+        lines.append('\t\t%d},' % expected)
+    lines += ['};',
+              '',
+              '#endif /* P256_VECTORS_H_ */',
+              '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--sigver', required=True, help='NIST CAVP SigVer.rsp (or .rsp.bz2)')
+    parser.add_argument('--wycheproof', help='Wycheproof ecdsa_secp256r1_sha256_test.json')
+    parser.add_argument('--check', action='store_true', help='only check that p256_vectors.h is up to date')
+    args = parser.parse_args()
+
+    vectors = load_sigver(args.sigver)
+    if not vectors:
+        sys.exit('gen_p256_vectors: no P-256 vectors in %s' % args.sigver)
+    sources = ['NIST CAVP SigVer.rsp (%d)' % len(vectors)]
+    if args.wycheproof:
+        wycheproof, skipped = load_wycheproof(args.wycheproof)
+        vectors += wycheproof
+        sources.append('Wycheproof (%d, %d skipped)' % (len(wycheproof), skipped))
+    edges = edge_cases()
+    vectors += edges
+    sources.append('edge cases (%d)' % len(edges))
+
+    # 만든 edge case가 정말 기대값대로인지 Python 구현으로 한 번 더 확인 (곡선 위의 키만)
+    for name, key, digest, signature, expected in edges:
+        x, y = int.from_bytes(key[:32], 'big'), int.from_bytes(key[32:], 'big')
+        if x < p256.P and y < p256.P and (y * y - x * x * x - p256.A * x - p256.B) % p256.P == 0:
+            if p256.verify_digest(key, digest, signature) != (expected == 0):
+                sys.exit('gen_p256_vectors: %s does not give the expected result' % name)
+
+    text = render(vectors, sources)
+    if args.check:
+        with open(VECTORS_H, encoding='utf-8') as f:
+            if f.read() != text:
+                sys.exit('gen_p256_vectors: %s is out of date, run Tools/gen_p256_vectors.py' % VECTORS_H)
+        return 0
+
+    with open(VECTORS_H, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+    print('%s: %d vectors (%s)' % (VECTORS_H, len(vectors), ', '.join(sources)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
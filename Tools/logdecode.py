@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+logdecode.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Decode tokenised bootloader log frames (Core/Inc/log.h) back into text.
+
+  usage: python3 Tools/logdecode.py capture.bin            # decode a raw UART capture
+         python3 Tools/logdecode.py - < /dev/ttyACM0       # decode a live stream
+         python3 Tools/logdecode.py --table                # print the ID table
+
+frame: 0xA5, id, argc, argc x uint32 (7 bits per byte, low first, bit 7 = more)
+The ID table is read from Core/Inc/logtable.h, so it always matches the firmware
+built from the same tree. Bytes outside frames are passed through unchanged.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+LOG_FRAME_SYNC = 0xA5
+DEFAULT_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Core', 'Inc', 'logtable.h')
+
+MESSAGE_RE = re.compile(r'^\s*LOG_MESSAGE\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', re.MULTILINE)
+SPEC_RE = re.compile(r'%(\d*)([duX])')
+
+
+def load_table(path):
+    with open(path, encoding='utf-8') as f:
+        return [(name, fmt) for name, fmt in MESSAGE_RE.findall(f.read())]
+
+
+def render(fmt, args):
+    """logtable.h format -> text. %d는 int32로 해석한다."""
+    values = iter(args)
+
+    def one(m):
+        value = next(values, None)
+        if value is None:
+            return m.group(0)
+        if m.group(2) == 'd' and value & 0x80000000:
+            value -= 1 << 32
+        return ('%' + m.group(1) + m.group(2)) % value
+
+    return SPEC_RE.sub(one, fmt)
+
+
+class Decoder:
+    def __init__(self, table):
+        self.table = table
+        self.frame = None
+
+    def feed(self, data):
+        """bytes -> decoded text"""
+        out = []
+        for b in data:
+            if self.frame is None:
+                if b == LOG_FRAME_SYNC:
+                    self.frame = {'id': None, 'argc': None, 'args': [], 'value': 0, 'shift': 0}
+                else:
+                    out.append(chr(b))
+                continue
+
+            f = self.frame
+            if f['id'] is None:
+                f['id'] = b
+            elif f['argc'] is None:
+                f['argc'] = b
+            else:
+                f['value'] |= (b & 0x7F) << f['shift']
+                f['shift'] += 7
+                if (b & 0x80) == 0:
+                    f['args'].append(f['value'] & 0xFFFFFFFF)
+                    f['value'] = 0
+                    f['shift'] = 0
+            if f['argc'] is not None and len(f['args']) == f['argc']:
+                out.append(self.line(f['id'], f['args']) + '\r\n')
+                self.frame = None
+        return ''.join(out)
+
+    def line(self, msg_id, args):
+        if msg_id >= len(self.table):
+            return '<unknown log id %d %s>' % (msg_id, ' '.join('%08X' % a for a in args))
+        return render(self.table[msg_id][1], args)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', nargs='?', default='-', help="raw capture file, '-' for stdin")
+    parser.add_argument('--logtable', default=DEFAULT_TABLE, help='path to logtable.h')
+    parser.add_argument('--table', action='store_true', help='print the ID table and exit')
+    args = parser.parse_args()
+
+    table = load_table(args.logtable)
+    if args.table:
+        for i, (name, fmt) in enumerate(table):
+            print('%3d  %-26s %s' % (i, name, fmt))
+        return 0
+
+    decoder = Decoder(table)
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+    with stream:
+        while True:
+            data = stream.read1(256) if hasattr(stream, 'read1') else stream.read(256)
+            if not data:
+                break
+            sys.stdout.write(decoder.feed(data))
+            sys.stdout.flush()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+map_summary.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Summarize a GNU ld .map file per module (object file / library member).
+
+  usage: python3 Tools/map_summary.py Debug/Nucleo-144-F429_Bootloader.map [--limit N]
+
+FLASH = .isr_vector + .text + .rodata + ARM.* + init/fini arrays + .data (load image)
+RAM   = .data + .bss + .ram_vector + heap/stack reservations
+"""
+
+import argparse
+import collections
+import os
+import re
+import sys
+
+# 출력 section 이름 -> (FLASH 포함 여부, RAM 포함 여부)
+FLASH_SECTIONS = ('.isr_vector', '.text', '.rodata', '.ARM', '.preinit_array', '.init_array', '.fini_array')
+RAM_ONLY_SECTIONS = ('.bss', '.ram_vector', '._user_heap_stack', '.noinit', '.ccmram')
+FLASH_AND_RAM_SECTIONS = ('.data',)
+
+# 입력 section: " .text.foo  0x08000198  0x2c ./Core/Src/main.o"
+# 이름이 길면 주소/크기/파일은 다음 줄에 나온다
+INPUT_RE = re.compile(r'^ (?P<name>\.\S+|COMMON)(?:\s+(?P<addr>0x[0-9a-fA-F]+)\s+(?P<size>0x[0-9a-fA-F]+)\s+(?P<file>\S.*))?$')
+CONTINUATION_RE = re.compile(r'^\s+(?P<addr>0x[0-9a-fA-F]+)\s+(?P<size>0x[0-9a-fA-F]+)\s+(?P<file>\S.*)$')
+# 출력 section: ".text  0x08000198  0x1234"
+OUTPUT_RE = re.compile(r'^(?P<name>\.\S+)')
+
+
+def module_name(path):
+    """'./Core/Src/main.o' -> 'main.o', 'libc.a(lib_a-printf.o)' -> 'libc.a(printf.o)'"""
+    path = path.strip()
+    m = re.match(r'.*?([^/\\]+\.a)\((?:lib_a-)?(.+)\)$', path)
+    if m:
+        return '%s(%s)' % (m.group(1), m.group(2))
+    return os.path.basename(path)
+
+
+def classify(output_section):
+    for s in FLASH_AND_RAM_SECTIONS:
+        if output_section == s:
+            return True, True
+    for s in FLASH_SECTIONS:
+        if output_section.startswith(s):
+            return True, False
+    for s in RAM_ONLY_SECTIONS:
+        if output_section.startswith(s):
+            return False, True
+    return False, False
+
+
+def parse(lines):
+    flash = collections.Counter()
+    ram = collections.Counter()
+    in_map = False
+    output_section = None
+    pending = False
+
+    for line in lines:
+        line = line.rstrip('\n')
+        if not in_map:
+            in_map = line.startswith('Linker script and memory map')
+            continue
+
+        m = OUTPUT_RE.match(line)
+        if m:
+            output_section = m.group('name')
+            pending = False
+            continue
+
+        m = INPUT_RE.match(line)
+        if m:
+            pending = m.group('size') is None
+            if pending:
+                continue
+        elif pending:
+            m = CONTINUATION_RE.match(line)
+            pending = False
+        else:
+            continue
+
+        if not m or output_section is None:
+            continue
+        size = int(m.group('size'), 16)
+        in_flash, in_ram = classify(output_section)
+        if size == 0 or not (in_flash or in_ram):
+            continue
+        name = module_name(m.group('file'))
+        if in_flash:
+            flash[name] += size
+        if in_ram:
+            ram[name] += size
+    return flash, ram
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('map', help='linker map file')
+    parser.add_argument('--limit', type=int, default=0, help='show only the N largest modules')
+    args = parser.parse_args()
+
+    with open(args.map, encoding='utf-8', errors='replace') as f:
+        flash, ram = parse(f)
+
+    modules = sorted(set(flash) | set(ram), key=lambda n: (-flash[n], -ram[n], n))
+    if args.limit > 0:
+        modules = modules[:args.limit]
+
+    width = max([len(n) for n in modules] + [6])
+    print('%-*s %8s %8s' % (width, 'module', 'flash', 'ram'))
+    print('-' * (width + 18))
+    for n in modules:
+        print('%-*s %8d %8d' % (width, n, flash[n], ram[n]))
+    print('-' * (width + 18))
+    print('%-*s %8d %8d' % (width, 'total', sum(flash.values()), sum(ram.values())))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+mkimage.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Prepend the bootloader image header (Core/Inc/image.h) to an application binary.
+
+  usage: python3 Tools/mkimage.py app.bin app.img --version 0x00010002 [--base 0x08010000 | --ram] [--key KEY]
+
+The application must be linked at base + 0x200 (its vector table follows the header).
+The output is what the host sends in DATA packets, starting at the application partition.
+
+With --ram the image is for RAM load-and-run (Core/Inc/ramload.h): the application is linked
+entirely into SRAM at 0x20000200, sent after a RAMLOAD command instead of INFO, and started
+without touching flash.
+
+With --key the image is signed (ECDSA P-256 over SHA-256 of the first 28 header bytes followed by
+the body, stored at header offset 28). The bootloader built with IMAGE_SIGNATURE_REQUIRED only
+runs images signed by the key in Core/Inc/signkey.h (Tools/signkey.py). A bare --key signs with the
+development key signkey.py --dev keeps in Tools/keys/ (never committed). For a LOADFILE update
+the bootloader writes the header itself: sign the flat image loadfile_sim writes (version 0,
+default base) and send the printed signature in a "[SIGNATURE]" command before the last DATA.
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+import p256
+
+IMAGE_MAGIC = 0x474D4942          # "BIMG"
+IMAGE_HEADER_SIZE = 0x200
+# PARTITION_APPLICATION_ADDRESS with the default PARTITION_APPLICATION_FIRST_SECTOR (4)
+DEFAULT_BASE = 0x08010000
+# RAMLOAD_ADDRESS (ramload.h)
+RAMLOAD_BASE = 0x20000000
+# IMAGE_SIGNED_HEADER_SIZE, the signature follows it
+SIGNED_HEADER_SIZE = 28
+DEV_KEY = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'keys', 'dev_sign.key')
+
+
+def stm32_crc(data):
+    """STM32 CRC unit: CRC-32/MPEG-2 fed with little endian words (see hwcrc.h)."""
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack('<I', data):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if (crc & 0x80000000) else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def make_header(body, version, base, private=None):
+    entry = base + IMAGE_HEADER_SIZE
+    fields = struct.pack('<6I', IMAGE_MAGIC, IMAGE_HEADER_SIZE, len(body), version, stm32_crc(body), entry)
+    header = fields + struct.pack('<I', stm32_crc(fields))
+    if private is not None:
+        header += p256.sign_digest(private, hashlib.sha256(header + body).digest())
+    return header + b'\xFF' * (IMAGE_HEADER_SIZE - len(header))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='application binary (objcopy -O binary)')
+    parser.add_argument('output', help='image to send to the bootloader')
+    parser.add_argument('--version', type=lambda v: int(v, 0), default=0, help='image version (uint32)')
+    parser.add_argument('--base', type=lambda v: int(v, 0), default=DEFAULT_BASE, help='application partition address')
+    parser.add_argument('--ram', action='store_true', help='RAM load-and-run image (base 0x%08X)' % RAMLOAD_BASE)
+    parser.add_argument('--key', nargs='?', const=DEV_KEY,
+                        help='sign with this private key (default Tools/keys/dev_sign.key from signkey.py --dev)')
+    args = parser.parse_args()
+    if args.ram:
+        args.base = RAMLOAD_BASE
+
+    with open(args.input, 'rb') as f:
+        body = f.read()
+    if not body:
+        sys.exit('mkimage: %s is empty' % args.input)
+
+    # 길이와 CRC 모두 word 단위이므로 Flash 지운 값(0xFF)으로 4의 배수를 맞춘다
+    body += b'\xFF' * (-len(body) % 4)
+
+    # vector table 첫 두 word: 초기 SP, Reset_Handler (thumb)
+    sp, reset = struct.unpack_from('<II', body)
+    if (reset & 1) == 0 or not (args.base + IMAGE_HEADER_SIZE <= (reset & ~1) < args.base + IMAGE_HEADER_SIZE + len(body)):
+        sys.exit('mkimage: reset vector 0x%08X is outside the image, link the application at 0x%08X'
+                 % (reset, args.base + IMAGE_HEADER_SIZE))
+
+    if args.key and not os.path.exists(args.key):
+        sys.exit('mkimage: %s not found, run Tools/signkey.py --dev or give the product key' % args.key)
+    private = p256.load_private(args.key) if args.key else None
+    header = make_header(body, args.version, args.base, private)
+    with open(args.output, 'wb') as f:
+        f.write(header + body)
+
+    print('%s: %d bytes, version 0x%08X, crc %08X, entry 0x%08X, sp 0x%08X'
+          % (args.output, len(header) + len(body), args.version, stm32_crc(body), args.base + IMAGE_HEADER_SIZE, sp))
+    if private is not None:
+        print('signature %s' % header[SIGNED_HEADER_SIZE:SIGNED_HEADER_SIZE + 64].hex().upper())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
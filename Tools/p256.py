@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+p256.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+ECDSA P-256 (secp256r1) with SHA-256 for signing bootloader images (Core/Src/p256.c verifies).
+Pure Python so the host tools need nothing beyond the standard library. Signatures are
+deterministic (RFC 6979), raw r || s, 32 bytes each, big endian.
+
+This runs on the build host only; it is not constant time and must not be used where an
+attacker can time the signing.
+"""
+
+import hashlib
+import hmac
+import secrets
+
+P = 2**256 - 2**224 + 2**192 + 2**96 - 1
+N = 0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+A = P - 3
+B = 0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B
+G = (0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+
+
+def point_add(p1, p2):
+    """Affine addition, None is the point at infinity."""
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    (x1, y1), (x2, y2) = p1, p2
+    if x1 == x2:
+        if (y1 + y2) % P == 0:
+            return None
+        lam = (3 * x1 * x1 + A) * pow(2 * y1, -1, P) % P
+    else:
+        lam = (y2 - y1) * pow(x2 - x1, -1, P) % P
+    x3 = (lam * lam - x1 - x2) % P
+    return (x3, (lam * (x1 - x3) - y1) % P)
+
+
+def point_mul(k, point):
+    result = None
+    while k:
+        if k & 1:
+            result = point_add(result, point)
+        point = point_add(point, point)
+        k >>= 1
+    return result
+
+
+def public_key(private):
+    """x || y, 64 bytes (the layout of sImagePublicKey in signkey.h)."""
+    x, y = point_mul(private, G)
+    return x.to_bytes(32, 'big') + y.to_bytes(32, 'big')
+
+
+def generate_private():
+    return secrets.randbelow(N - 1) + 1
+
+
+def _rfc6979_k(private, digest):
+    x = private.to_bytes(32, 'big')
+    h = (int.from_bytes(digest, 'big') % N).to_bytes(32, 'big')
+    v = b'\x01' * 32
+    k = b'\x00' * 32
+    k = hmac.new(k, v + b'\x00' + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b'\x01' + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        candidate = int.from_bytes(v, 'big')
+        if 1 <= candidate < N:
+            return candidate
+        k = hmac.new(k, v + b'\x00', hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def sign_digest(private, digest):
+    e = int.from_bytes(digest, 'big') % N
+    k = _rfc6979_k(private, digest)
+    r = point_mul(k, G)[0] % N
+    s = pow(k, -1, N) * (e + r * private) % N
+    return r.to_bytes(32, 'big') + s.to_bytes(32, 'big')
+
+
+def verify_digest(public, digest, signature):
+    qx, qy = int.from_bytes(public[:32], 'big'), int.from_bytes(public[32:], 'big')
+    r, s = int.from_bytes(signature[:32], 'big'), int.from_bytes(signature[32:], 'big')
+    if not (0 < r < N and 0 < s < N):
+        return False
+    w = pow(s, -1, N)
+    e = int.from_bytes(digest, 'big') % N
+    point = point_add(point_mul(e * w % N, G), point_mul(r * w % N, (qx, qy)))
+    return point is not None and point[0] % N == r
+
+
+def load_private(path):
+    """Private key file written by signkey.py: one line of 64 hex digits."""
+    with open(path) as f:
+        value = int(f.read().strip(), 16)
+    if not 0 < value < N:
+        raise ValueError('%s: private key out of range' % path)
+    return value
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+signkey.py
+
+  Created on: Oct 19, 2026
+      Author: ajg1079
+
+Generate the image signing key and Core/Inc/signkey.h (the public key the bootloader trusts).
+signkey.h is written at provisioning time and is not part of the repository.
+
+  usage: python3 Tools/signkey.py --dev                # development key -> Tools/keys/dev_sign.key
+         python3 Tools/signkey.py --key prod.key       # product key, signkey.h from an existing key
+         python3 Tools/signkey.py --key prod.key --new # new product key written to prod.key
+
+The private key file is one line of 64 hex digits. Private keys never go into the repository:
+Tools/keys/ is ignored by git, and a product key belongs on the signing host only.
+
+--dev makes a throwaway key per developer (created on first use) and marks signkey.h with
+SIGNKEY_DEVELOPMENT 1. image.c refuses to compile such a header without DEBUG, so a Release
+build always carries a provisioned key.
+"""
+
+import argparse
+import os
+import sys
+
+import p256
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+DEV_KEY = os.path.join(ROOT, 'Tools', 'keys', 'dev_sign.key')
+SIGNKEY_H = os.path.join(ROOT, 'Core', 'Inc', 'signkey.h')
+
+
+def render(public, key_name, development):
+    lines = ['/*',
+             ' * signkey.h',
+             ' *',
+             ' *  Generated by Tools/signkey.py from %s, do not edit.' % key_name,
+             ' */',
+             '',
+             '#ifndef INC_SIGNKEY_H_',
+             '#define INC_SIGNKEY_H_',
+             '',
+             '#include <stdint.h>',
+             '',
+             '/* 1이면 개발용 key, Release build (DEBUG 없음)에서는 image.c가 compile 에러를 낸다 */',
+             '#define SIGNKEY_DEVELOPMENT\t\t%d' % (1 if development else 0),
+             '',
+             '/* 이미지 서명 검증용 ECDSA P-256 공개키 x || y (각 32 Byte big endian) */',
+             'static const uint8_t sImagePublicKey[64] =',
+             '{']
+    for row in range(0, 64, 16):
+        lines.append('\t' + ' '.join('0x%02X,' % b for b in public[row:row + 16]))
+    lines += ['};', '', '#endif /* INC_SIGNKEY_H_ */', '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument('--dev', action='store_true', help='development key Tools/keys/dev_sign.key (Debug builds only)')
+    group.add_argument('--key', help='product private key file')
+    parser.add_argument('--new', action='store_true', help='generate a new key even if the file exists')
+    args = parser.parse_args()
+    key = DEV_KEY if args.dev else args.key
+
+    if args.new or (args.dev and not os.path.exists(key)):
+        private = p256.generate_private()
+        os.makedirs(os.path.dirname(os.path.abspath(key)), exist_ok=True)
+        with open(key, 'w') as f:
+            f.write('%064x\n' % private)
+        print('%s: new signing key' % key)
+    elif not os.path.exists(key):
+        sys.exit('signkey: %s not found, add --new to generate a product key' % key)
+    else:
+        private = p256.load_private(key)
+
+    public = p256.public_key(private)
+    with open(SIGNKEY_H, 'w', newline='\n') as f:
+        f.write(render(public, os.path.basename(key), args.dev))
+    print('%s: public key %s%s' % (SIGNKEY_H, public.hex(), ' (development)' if args.dev else ''))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,125 @@
+/*
+ * display_sim.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 업데이트 진행 표시를 흉내 낸다. 주어진 속도로 패킷을 받는다고 보고 bootcode.c와 같은 순서로
+ *	fProgressUpdate/fProgressDraw를 부른 뒤, 화면을 다시 그릴 때마다 보냈을 byte 수 (dirty 범위)를 세고
+ *	stop 패킷 시점의 그래픽 버퍼를 PBM 그림으로 저장한다.
+ *
+ *	gcc -O2 -I Core/Inc Tools/sim/display_sim.c Core/Src/display.c Core/Src/progress.c Core/Src/format.c -o display_sim
+ *	./display_sim progress.pbm [packet size] [packet count] [bytes/s] [stop packet]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "display.h"
+#include "progress.h"
+
+static uint8_t sBuffer[DISPLAY_BUFFER_SIZE];
+
+/*
+ *  @brief	ssd1306_drawingbuffer처럼 바뀐 범위를 가져가고 보냈을 data byte 수를 돌려준다
+ */
+static int fSimFlush(void)
+{
+	int iFirst, iLast;
+	int iBytes = 0;
+
+	for (int i = 0; i < DISPLAY_PAGES; i++)
+	{
+		if (fDisplayTakeDirty(i, &iFirst, &iLast) == 1)
+		{
+			iBytes += iLast - iFirst + 1;
+		}
+	}
+	return iBytes;
+}
+
+/*
+ *  @brief	그래픽 버퍼를 PBM (P1) 그림으로 저장
+ */
+static int fSimWritePbm(const char *sPath)
+{
+	FILE *pFile = fopen(sPath, "w");
+
+	if (pFile == NULL)
+	{
+		return -1;
+	}
+	fprintf(pFile, "P1\n%d %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	for (int y = 0; y < DISPLAY_HEIGHT; y++)
+	{
+		for (int x = 0; x < DISPLAY_WIDTH; x++)
+		{
+			fputc(((sBuffer[((y >> 3) * DISPLAY_WIDTH) + x] >> (y & 0x7)) & 0x1) ? '1' : '0', pFile);
+		}
+		fputc('\n', pFile);
+	}
+	return fclose(pFile);
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t iPacketSize = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1024;
+	uint32_t iPacketCount = (argc > 3) ? (uint32_t)atoi(argv[3]) : 448;
+	uint32_t iBytesPerSecond = (argc > 4) ? (uint32_t)atoi(argv[4]) : 11000;
+	uint32_t iStop = (argc > 5) ? (uint32_t)atoi(argv[5]) : iPacketCount / 3;
+	uint32_t iTick = 0;
+	int iRefresh = 0;
+	int iBytes = 0;
+	int iMaxBytes = 0;
+	int iFrame;
+
+	if ((argc < 2) || (iPacketSize == 0) || (iBytesPerSecond == 0))
+	{
+		fprintf(stderr, "usage: %s out.pbm [packet size] [packet count] [bytes/s] [stop packet]\n", argv[0]);
+		return 1;
+	}
+	if (iStop > iPacketCount)
+	{
+		iStop = iPacketCount;
+	}
+
+	// 시작 화면 ("Boot Loader") 후 INFO 수신
+	fDisplayClear(sBuffer);
+	fDisplayString(0, 0, sBuffer, "Boot Loader");
+	fSimFlush();
+	fProgressStart(iPacketSize, iPacketCount, 0, iTick);
+	fProgressDraw(sBuffer);
+	printf("start frame       %4d bytes\n", fSimFlush());
+
+	for (uint32_t i = 1; i <= iStop; i++)
+	{
+		iTick = (uint32_t)(((uint64_t)i * iPacketSize * 1000U) / iBytesPerSecond);
+		if (fProgressUpdate(i, iTick) == 1)
+		{
+			fProgressDraw(sBuffer);
+			iFrame = fSimFlush();
+			iRefresh++;
+			iBytes += iFrame;
+			if (iFrame > iMaxBytes)
+			{
+				iMaxBytes = iFrame;
+			}
+		}
+	}
+
+	printf("packets           %4u / %u (%u ms)\n", (unsigned int)iStop, (unsigned int)iPacketCount, (unsigned int)iTick);
+	printf("refreshes         %4d\n", iRefresh);
+	if (iRefresh != 0)
+	{
+		printf("bytes per refresh %4d avg, %d max (full frame %d)\n", iBytes / iRefresh, iMaxBytes, DISPLAY_BUFFER_SIZE);
+	}
+	printf("rate / eta        %u B/s, %u s\n", (unsigned int)fProgressGet()->iBytesPerSecond, (unsigned int)fProgressGet()->iEtaSeconds);
+
+	if (fSimWritePbm(argv[1]) != 0)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	return 0;
+}
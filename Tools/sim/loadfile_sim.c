@@ -0,0 +1,156 @@
+/*
+ * loadfile_sim.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ajg1079
+ */
+
+/*
+ *	host에서 LOADFILE 업데이트를 흉내 낸다. ELF 또는 Intel HEX 파일을 패킷 크기로 나눠 (마지막 패킷은 0xFF로
+ *	채움) bootcode.c와 같이 fLoadFileFeed에 넘기고, 기록 요청을 주소가 이어지는 범위로 묶어 출력한다.
+ *	끝나면 loadflash.c가 image header에 넣을 길이와 CRC (header 뒤부터 빈 곳을 0xFF로 채운 이미지)를 출력하므로
+ *	LOADFILE 명령의 이미지 CRC로 그대로 쓸 수 있다. 세 번째 인자를 주면 그 이미지를 binary로 저장한다.
+ *
+ *	gcc -O2 -I Core/Inc Tools/sim/loadfile_sim.c Core/Src/loadfile.c -o loadfile_sim
+ *	./loadfile_sim app.elf [packet size] [image.bin]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "partition.h"
+#include "image.h"
+#include "loadfile.h"
+
+#define SIM_ENTRY_ADDRESS		(PARTITION_APPLICATION_ADDRESS + IMAGE_HEADER_SIZE)
+#define SIM_IMAGE_MAX			(PARTITION_APPLICATION_SIZE - IMAGE_HEADER_SIZE)
+
+static uint8_t sImage[SIM_IMAGE_MAX];
+static uint32_t iImageEnd;
+// 출력용으로 묶고 있는 기록 범위
+static uint32_t iRunAddress, iRunLength;
+static uint32_t iWriteCount;
+
+/*
+ *  @brief	묶고 있던 기록 범위 출력
+ */
+static void fSimRunFlush(void)
+{
+	if (iRunLength > 0)
+	{
+		printf("  0x%08X - 0x%08X  %u bytes\n", iRunAddress, iRunAddress + iRunLength, iRunLength);
+	}
+	iRunLength = 0;
+}
+
+/*
+ *  @brief	loadflash.c처럼 Application partition (image header 뒤)만 허용하고 이미지에 복사
+ */
+static int fSimWrite(uint32_t Address, const uint8_t *sData, uint32_t iLength)
+{
+	if ((Address < SIM_ENTRY_ADDRESS) || (Address - SIM_ENTRY_ADDRESS > SIM_IMAGE_MAX - iLength) || (iLength > SIM_IMAGE_MAX))
+	{
+		fprintf(stderr, "write outside the application partition: 0x%08X, %u bytes\n", Address, iLength);
+		return LOADFILE_ERROR_ADDRESS;
+	}
+
+	memcpy(&sImage[Address - SIM_ENTRY_ADDRESS], sData, iLength);
+	if (Address - SIM_ENTRY_ADDRESS + iLength > iImageEnd)
+	{
+		iImageEnd = Address - SIM_ENTRY_ADDRESS + iLength;
+	}
+
+	if ((iRunLength == 0) || (Address != iRunAddress + iRunLength))
+	{
+		fSimRunFlush();
+		iRunAddress = Address;
+	}
+	iRunLength += iLength;
+	iWriteCount++;
+	return LOADFILE_OK;
+}
+
+/*
+ *  @brief	hwcrc.h의 CRC 유닛 계산 (CRC-32/MPEG-2, little endian word)
+ */
+static uint32_t fSimCrc(const uint8_t *sData, uint32_t iSize)
+{
+	uint32_t iCrc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i + 4 <= iSize; i += 4)
+	{
+		iCrc ^= (uint32_t)sData[i] | ((uint32_t)sData[i + 1] << 8) | ((uint32_t)sData[i + 2] << 16) | ((uint32_t)sData[i + 3] << 24);
+		for (int b = 0; b < 32; b++)
+		{
+			iCrc = (iCrc & 0x80000000) ? ((iCrc << 1) ^ 0x04C11DB7) : (iCrc << 1);
+		}
+	}
+	return iCrc;
+}
+
+int main(int argc, char **argv)
+{
+	static LoadFileTypeDef sLoad;
+	uint8_t sPacket[4096];
+	uint32_t iPacketSize = (argc > 2) ? (uint32_t)atoi(argv[2]) : 256;
+	uint32_t iPacketCount = 0;
+	uint32_t iFileSize = 0;
+	size_t iRead;
+	FILE *pFile;
+	int res = LOADFILE_OK;
+
+	if ((argc < 2) || (iPacketSize == 0) || (iPacketSize > sizeof(sPacket)))
+	{
+		fprintf(stderr, "usage: %s file.elf|file.hex [packet size] [image.bin]\n", argv[0]);
+		return 2;
+	}
+	pFile = fopen(argv[1], "rb");
+	if (pFile == NULL)
+	{
+		perror(argv[1]);
+		return 2;
+	}
+
+	// 지워진 Flash
+	memset(sImage, 0xFF, sizeof(sImage));
+	fLoadFileStart(&sLoad, fSimWrite);
+
+	printf("%s:\n", argv[1]);
+	while ((res == LOADFILE_OK) && ((iRead = fread(sPacket, 1, iPacketSize, pFile)) > 0))
+	{
+		memset(sPacket + iRead, 0xFF, iPacketSize - iRead);
+		iFileSize += (uint32_t)iRead;
+		iPacketCount++;
+		res = fLoadFileFeed(&sLoad, sPacket, iPacketSize);
+	}
+	fclose(pFile);
+	if (res == LOADFILE_OK)
+	{
+		res = fLoadFileFinish(&sLoad);
+	}
+	fSimRunFlush();
+
+	if (res != LOADFILE_OK)
+	{
+		printf("error %d at file offset %u\n", res, sLoad.iOffset);
+		return 1;
+	}
+
+	// loadflash.c는 마지막 word를 0xFF로 채워 기록한다
+	iImageEnd = (iImageEnd + 3) & ~3U;
+	printf("%s, %u bytes in %u packets of %u, %u writes\n", (sLoad.iFormat == LOADFILE_FORMAT_ELF) ? "ELF" : "HEX",
+		iFileSize, iPacketCount, iPacketSize, iWriteCount);
+	printf("image 0x%08X, %u bytes, crc %08X\n", SIM_ENTRY_ADDRESS, iImageEnd, fSimCrc(sImage, iImageEnd));
+
+	if (argc > 3)
+	{
+		pFile = fopen(argv[3], "wb");
+		if ((pFile == NULL) || (fwrite(sImage, 1, iImageEnd, pFile) != iImageEnd))
+		{
+			perror(argv[3]);
+			return 2;
+		}
+		fclose(pFile);
+	}
+	return 0;
+}